@@ -4,18 +4,21 @@ layout (location = 0) in vec3 inVertex;	// Vertex.
 layout (location = 1) in vec3 inNormal;	// Normal (not necessarily normalized).
 layout (location = 2) in vec3 inColor;	// Color (not necessarily normalized).
 layout (location = 3) in vec2 inUV;		// UV coordinates.
+layout (location = 4) in vec4 inJoints;	// Joints that move the vertex.
+layout (location = 5) in vec4 inWeights;	// Weight of every joint.
 
-uniform mat4 Model;			// Imports the model matrix.
+uniform samplerBuffer drawData;	// Imports the per-draw matrices of every draw.
+uniform int drawIndex;			// Index of this draw in drawData.
 uniform mat4 View;			// Imports the View matrix.
 uniform mat4 Projection;	// Imports the projection matrix.
-uniform mat4 modelView;		// Imports the modelView already multiplied.
-uniform mat4 normalMatrix;	// Imports the normal matrix.
 uniform vec3 lightPos;		// Light position.
 uniform float time;			// Time in seconds.
 uniform float jump_start;	// Imports the modelView already multiplied.
 uniform float jump_velocity;	// Imports the normal matrix.
 uniform float gravity;			// Light position.
 uniform float last_hit;		// The moment when the last hit ocurred.
+uniform sampler2D animation;	// Baked run cycle, one joint palette per row.
+uniform float animationDuration;	// Duration of the baked run cycle.
 
 out vec3 vertexNormal;		// Passes the normal to the fragment shader.
 out vec3 vertexColor;		// Passes the color to the fragment shader.
@@ -33,8 +36,54 @@ vec3 interpolate(vec3 a, vec3 b, float step) {
 
 }
 
+mat4 fetchMatrix(int matrix) {
+
+	// Each draw holds the Model, modelView and normal matrices, one column per texel.
+	int base = (drawIndex * 3 + matrix) * 4;
+
+	return mat4(texelFetch(drawData, base), texelFetch(drawData, base + 1),
+		texelFetch(drawData, base + 2), texelFetch(drawData, base + 3));
+
+}
+
+mat4 fetchJoint(float joint, int frame) {
+
+	// Each joint takes four texels of its frame, one column per texel.
+	ivec2 texel = ivec2(int(joint) * 4, frame);
+
+	return mat4(texelFetch(animation, texel, 0), texelFetch(animation, texel + ivec2(1, 0), 0),
+		texelFetch(animation, texel + ivec2(2, 0), 0), texelFetch(animation, texel + ivec2(3, 0), 0));
+
+}
+
+mat4 sampleJoint(float joint, int frame, int next, float blend) {
+
+	// Blend the joint between the frames around the time.
+	mat4 current = fetchJoint(joint, frame);
+
+	return current + (fetchJoint(joint, next) - current) * blend;
+
+}
+
 void main() {
 
+	// Get the matrices of this draw.
+	mat4 Model = fetchMatrix(0);
+	mat4 modelView = fetchMatrix(1);
+	mat4 normalMatrix = fetchMatrix(2);
+
+	// Find the baked frames around the time. The clip loops, so the last frame blends into the first.
+	int frames = textureSize(animation, 0).y;
+	float position = fract(time / animationDuration) * float(frames);
+	int frame = min(int(position), frames - 1);
+	int next = (frame + 1) % frames;
+	float blend = position - float(frame);
+
+	// Move the vertex with its joints. The joints are expected not to stretch, so they turn the normals as they are.
+	mat4 skin = inWeights.x * sampleJoint(inJoints.x, frame, next, blend) + inWeights.y * sampleJoint(inJoints.y, frame, next, blend) +
+		inWeights.z * sampleJoint(inJoints.z, frame, next, blend) + inWeights.w * sampleJoint(inJoints.w, frame, next, blend);
+	vec4 skinnedVertex = skin * vec4(inVertex, 1.0);
+
 	// Get step based on the last hit.
 	float step = time - last_hit;
 	if (step > 1.0 || step < 0.0) {
@@ -45,14 +94,14 @@ void main() {
 	vertexColor = interpolate(vec3(0.9, 0.1, 0.1), vec3(0.1, 0.1, 0.1), step);
 
 	// Assigns the direct passes.
-	vertexNormal = vec3(normalMatrix * vec4(inNormal, 0.0));
+	vertexNormal = vec3(normalMatrix * vec4(mat3(skin) * inNormal, 0.0));
 	vertexUV = mat2(0.0, -1.0, 1.0, 0.0) * inUV;
 
 	// Check if the character is jumping or not.
 	if (jump_start != -1) {
 	
 		// Get the point after applying Model transformations.
-		vec4 transformedPosition = Model * vec4(inVertex, 1.0);
+		vec4 transformedPosition = Model * skinnedVertex;
 
 		// Calculate the jump displacement.
 		float jump_time = time - jump_start;
@@ -71,11 +120,11 @@ void main() {
 	} else {
 	
 		// Calculates the vertex by applying the transforms to it.
-		vec4 tmpVertexPosition = modelView * vec4(inVertex, 1.0);
+		vec4 tmpVertexPosition = modelView * skinnedVertex;
 		vertexPosition = vec3(tmpVertexPosition) / tmpVertexPosition.w;
 
 		// Sets the visualized position by applying the camera matrix.
-		gl_Position = Projection * modelView * vec4(inVertex, 1.0);
+		gl_Position = Projection * modelView * skinnedVertex;
 	
 	}
 
@@ -5,11 +5,10 @@ layout (location = 1) in vec3 inNormal;	// Normal (not necessarily normalized).
 layout (location = 2) in vec3 inColor;	// Color (not necessarily normalized).
 layout (location = 3) in vec2 inUV;		// UV coordinates.
 
-uniform mat4 Model;			// Imports the model matrix.
+uniform samplerBuffer drawData;	// Imports the per-draw matrices of every draw.
+uniform int drawIndex;			// Index of this draw in drawData.
 uniform mat4 View;			// Imports the View matrix.
 uniform mat4 Projection;	// Imports the projection matrix.
-uniform mat4 modelView;		// Imports the modelView already multiplied.
-uniform mat4 normalMatrix;	// Imports the normal matrix.
 uniform vec3 lightPos;		// Light position.
 uniform float time;			// Time in seconds.
 uniform float velocity;		// Velocity in m/s.
@@ -19,8 +18,26 @@ out vec3 vertexColor;		// Passes the color to the fragment shader.
 out vec2 vertexUV;			// Passes the UV coordinates to the fragment shader.
 out vec3 vertexPosition;	// Passes the current vertex to the fragment shader.
 
+// Must match depth.vert exactly so that the colour pass can test with GL_EQUAL.
+invariant gl_Position;
+
+mat4 fetchMatrix(int matrix) {
+
+	// Each draw holds the Model, modelView and normal matrices, one column per texel.
+	int base = (drawIndex * 3 + matrix) * 4;
+
+	return mat4(texelFetch(drawData, base), texelFetch(drawData, base + 1),
+		texelFetch(drawData, base + 2), texelFetch(drawData, base + 3));
+
+}
+
 void main() {
 
+	// Get the matrices of this draw.
+	mat4 Model = fetchMatrix(0);
+	mat4 modelView = fetchMatrix(1);
+	mat4 normalMatrix = fetchMatrix(2);
+
 	// Assigns the direct passes.
 	vertexNormal = vec3(normalMatrix * vec4(inNormal, 0.0));
 	vertexColor = inColor;
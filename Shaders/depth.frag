@@ -0,0 +1,7 @@
+#version 330 core
+
+void main() {
+
+	// Only the depth is written in the pre-pass.
+
+}
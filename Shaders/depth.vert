@@ -0,0 +1,42 @@
+#version 330 core
+
+layout (location = 0) in vec3 inVertex;	// Vertex.
+
+uniform samplerBuffer drawData;	// Imports the per-draw matrices of every draw.
+uniform int drawIndex;			// Index of this draw in drawData.
+uniform mat4 View;			// Imports the View matrix.
+uniform mat4 Projection;	// Imports the projection matrix.
+uniform float time;			// Time in seconds.
+uniform float velocity;		// Velocity in m/s.
+
+// Must match default.vert exactly so that the colour pass can test with GL_EQUAL.
+invariant gl_Position;
+
+mat4 fetchMatrix(int matrix) {
+
+	// Each draw holds the Model, modelView and normal matrices, one column per texel.
+	int base = (drawIndex * 3 + matrix) * 4;
+
+	return mat4(texelFetch(drawData, base), texelFetch(drawData, base + 1),
+		texelFetch(drawData, base + 2), texelFetch(drawData, base + 3));
+
+}
+
+void main() {
+
+	// Get the model matrix of this draw.
+	mat4 Model = fetchMatrix(0);
+
+	// Make the MRU calculations.
+	float displacement = velocity * time;
+
+	// Get the point after applying Model transformations.
+	vec4 transformedPosition = Model * vec4(inVertex, 1.0);
+
+	// Make it move.
+	transformedPosition.z -= displacement;
+
+	// Sets the visualized position by applying the camera matrix.
+	gl_Position = Projection * View * transformedPosition;
+
+}
@@ -0,0 +1,91 @@
+#version 330 core
+
+layout (location = 0) in vec3 inVertex;	// Vertex.
+layout (location = 1) in vec3 inNormal;	// Normal (not necessarily normalized).
+layout (location = 2) in vec3 inColor;	// Color (not necessarily normalized).
+layout (location = 3) in vec2 inUV;		// UV coordinates.
+layout (location = 4) in vec4 inJoints;	// Joints that move the vertex.
+layout (location = 5) in vec4 inWeights;	// Weight of every joint.
+
+uniform samplerBuffer drawData;	// Imports the per-draw matrices of every draw.
+uniform int drawIndex;			// Index of the first guard in drawData.
+uniform int crowdSize;			// Number of guards, the clip times start right after them.
+uniform mat4 Projection;	// Imports the projection matrix.
+uniform sampler2D animation;	// Baked run cycle, one joint palette per row.
+uniform float animationDuration;	// Duration of the baked run cycle.
+
+out vec3 vertexNormal;		// Passes the normal to the fragment shader.
+out vec3 vertexColor;		// Passes the color to the fragment shader.
+out vec2 vertexUV;			// Passes the UV coordinates to the fragment shader.
+out vec3 vertexPosition;	// Passes the current vertex to the fragment shader.
+
+mat4 fetchMatrix(int texel) {
+
+	// Every matrix takes four texels, one column per texel.
+	return mat4(texelFetch(drawData, texel), texelFetch(drawData, texel + 1),
+		texelFetch(drawData, texel + 2), texelFetch(drawData, texel + 3));
+
+}
+
+float fetchClipTime() {
+
+	// The clip times of the guards come after the matrices of all of them, four per texel.
+	vec4 times = texelFetch(drawData, (drawIndex + crowdSize) * 12 + gl_InstanceID / 4);
+
+	return times[gl_InstanceID % 4];
+
+}
+
+mat4 fetchJoint(float joint, int frame) {
+
+	// Each joint takes four texels of its frame, one column per texel.
+	ivec2 texel = ivec2(int(joint) * 4, frame);
+
+	return mat4(texelFetch(animation, texel, 0), texelFetch(animation, texel + ivec2(1, 0), 0),
+		texelFetch(animation, texel + ivec2(2, 0), 0), texelFetch(animation, texel + ivec2(3, 0), 0));
+
+}
+
+mat4 sampleJoint(float joint, int frame, int next, float blend) {
+
+	// Blend the joint between the frames around the time.
+	mat4 current = fetchJoint(joint, frame);
+
+	return current + (fetchJoint(joint, next) - current) * blend;
+
+}
+
+void main() {
+
+	// Each guard holds the Model, modelView and normal matrices.
+	int base = (drawIndex + gl_InstanceID) * 12;
+	mat4 modelView = fetchMatrix(base + 4);
+	mat4 normalMatrix = fetchMatrix(base + 8);
+
+	// Find the baked frames around the clip time of this guard. The clip loops, so the last frame blends into the first.
+	int frames = textureSize(animation, 0).y;
+	float position = fract(fetchClipTime() / animationDuration) * float(frames);
+	int frame = min(int(position), frames - 1);
+	int next = (frame + 1) % frames;
+	float blend = position - float(frame);
+
+	// Move the vertex with its joints. The joints are expected not to stretch, so they turn the normals as they are.
+	mat4 skin = inWeights.x * sampleJoint(inJoints.x, frame, next, blend) + inWeights.y * sampleJoint(inJoints.y, frame, next, blend) +
+		inWeights.z * sampleJoint(inJoints.z, frame, next, blend) + inWeights.w * sampleJoint(inJoints.w, frame, next, blend);
+	vec4 skinnedVertex = skin * vec4(inVertex, 1.0);
+
+	// The guards wear the palace blue.
+	vertexColor = vec3(0.1, 0.15, 0.5);
+
+	// Assigns the direct passes.
+	vertexNormal = vec3(normalMatrix * vec4(mat3(skin) * inNormal, 0.0));
+	vertexUV = mat2(0.0, -1.0, 1.0, 0.0) * inUV;
+
+	// Calculates the vertex by applying the transforms to it.
+	vec4 tmpVertexPosition = modelView * skinnedVertex;
+	vertexPosition = vec3(tmpVertexPosition) / tmpVertexPosition.w;
+
+	// Sets the visualized position by applying the camera matrix.
+	gl_Position = Projection * tmpVertexPosition;
+
+}
@@ -0,0 +1,251 @@
+/**
+ * @file AllocationCounter.cpp
+ * @brief AllocationCounter class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "AllocationCounter.h"
+
+#include <stdlib.h>
+
+#include <new>
+
+namespace aladdin_3d {
+
+#ifdef ALADDIN_3D_COUNT_ALLOCATIONS
+
+	static thread_local unsigned long allocations = 0;	/// Allocations made by each thread.
+
+	/**
+	 * @brief Allocates memory and counts it.
+	 *
+	 * Allocates memory with malloc and counts the allocation for the calling thread.
+	 *
+	 * @param size The size in bytes.
+	 *
+	 * @returns The memory, or nullptr if there is none left.
+	 */
+	static void *allocate(size_t size) noexcept {
+
+		allocations++;
+
+		// Zero sized allocations still have to return a unique pointer.
+		return malloc(size > 0 ? size : 1);
+
+	}
+
+	/**
+	 * @brief Allocates aligned memory and counts it.
+	 *
+	 * Allocates memory with a stricter alignment than malloc gives and counts the
+	 * allocation for the calling thread.
+	 *
+	 * @param size The size in bytes.
+	 * @param alignment The alignment in bytes, a power of two.
+	 *
+	 * @returns The memory, or nullptr if there is none left.
+	 */
+	static void *allocateAligned(size_t size, std::align_val_t alignment) noexcept {
+
+		allocations++;
+
+		size_t bytes = (size_t)alignment;
+
+#ifdef _MSC_VER
+		return _aligned_malloc(size > 0 ? size : 1, bytes);
+#else
+		// aligned_alloc wants the size to be a multiple of the alignment.
+		return aligned_alloc(bytes, size > 0 ? (size + bytes - 1) / bytes * bytes : bytes);
+#endif
+
+	}
+
+	/**
+	 * @brief Frees aligned memory.
+	 *
+	 * Frees memory taken with allocateAligned.
+	 *
+	 * @param memory The memory.
+	 */
+	static void freeAligned(void *memory) noexcept {
+
+#ifdef _MSC_VER
+		_aligned_free(memory);
+#else
+		free(memory);
+#endif
+
+	}
+
+	unsigned long AllocationCounter::getCount() {
+
+		return allocations;
+
+	}
+
+	bool AllocationCounter::isEnabled() {
+
+		return true;
+
+	}
+
+#else
+
+	unsigned long AllocationCounter::getCount() {
+
+		return 0;
+
+	}
+
+	bool AllocationCounter::isEnabled() {
+
+		return false;
+
+	}
+
+#endif
+
+}  // namespace aladdin_3d
+
+#ifdef ALADDIN_3D_COUNT_ALLOCATIONS
+
+void *operator new(size_t size) {
+
+	void *memory = aladdin_3d::allocate(size);
+
+	if (memory == nullptr)
+		throw std::bad_alloc();
+
+	return memory;
+
+}
+
+void *operator new[](size_t size) {
+
+	return operator new(size);
+
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+
+	return aladdin_3d::allocate(size);
+
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+
+	return aladdin_3d::allocate(size);
+
+}
+
+void *operator new(size_t size, std::align_val_t alignment) {
+
+	void *memory = aladdin_3d::allocateAligned(size, alignment);
+
+	if (memory == nullptr)
+		throw std::bad_alloc();
+
+	return memory;
+
+}
+
+void *operator new[](size_t size, std::align_val_t alignment) {
+
+	return operator new(size, alignment);
+
+}
+
+void *operator new(size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+
+	return aladdin_3d::allocateAligned(size, alignment);
+
+}
+
+void *operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+
+	return aladdin_3d::allocateAligned(size, alignment);
+
+}
+
+void operator delete(void *memory) noexcept {
+
+	free(memory);
+
+}
+
+void operator delete[](void *memory) noexcept {
+
+	free(memory);
+
+}
+
+void operator delete(void *memory, size_t) noexcept {
+
+	free(memory);
+
+}
+
+void operator delete[](void *memory, size_t) noexcept {
+
+	free(memory);
+
+}
+
+void operator delete(void *memory, const std::nothrow_t &) noexcept {
+
+	free(memory);
+
+}
+
+void operator delete[](void *memory, const std::nothrow_t &) noexcept {
+
+	free(memory);
+
+}
+
+void operator delete(void *memory, std::align_val_t) noexcept {
+
+	aladdin_3d::freeAligned(memory);
+
+}
+
+void operator delete[](void *memory, std::align_val_t) noexcept {
+
+	aladdin_3d::freeAligned(memory);
+
+}
+
+void operator delete(void *memory, size_t, std::align_val_t) noexcept {
+
+	aladdin_3d::freeAligned(memory);
+
+}
+
+void operator delete[](void *memory, size_t, std::align_val_t) noexcept {
+
+	aladdin_3d::freeAligned(memory);
+
+}
+
+void operator delete(void *memory, std::align_val_t, const std::nothrow_t &) noexcept {
+
+	aladdin_3d::freeAligned(memory);
+
+}
+
+void operator delete[](void *memory, std::align_val_t, const std::nothrow_t &) noexcept {
+
+	aladdin_3d::freeAligned(memory);
+
+}
+
+#endif
@@ -0,0 +1,68 @@
+/**
+ * @file AllocationCounter.h
+ * @brief AllocationCounter class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_ALLOCATIONCOUNTER_H_
+#define ALADDIN_3D_CLASSES_ALLOCATIONCOUNTER_H_
+
+// Counting adds work to every allocation, so it is only built into debug builds or
+// builds that ask for it.
+#if defined(_DEBUG) && !defined(ALADDIN_3D_COUNT_ALLOCATIONS)
+#define ALADDIN_3D_COUNT_ALLOCATIONS
+#endif
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of an AllocationCounter class.
+	 *
+	 * Counts the heap allocations made through operator new. The global allocation
+	 * operators are replaced in its implementation file, and every thread keeps its
+	 * own count, so the render thread can tell how many allocations a frame made
+	 * without the simulation thread getting in the way.
+	 *
+	 * The operators are only replaced when ALADDIN_3D_COUNT_ALLOCATIONS is defined,
+	 * which debug builds do by default. Every form of operator new is counted, the
+	 * nothrow and aligned ones included. Memory taken with malloc directly is not.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class AllocationCounter {
+
+		public:
+
+			/**
+			 * @brief Get the number of allocations.
+			 *
+			 * Get the number of allocations made by the calling thread so far.
+			 *
+			 * @returns The number of allocations.
+			 */
+			static unsigned long getCount();
+
+			/**
+			 * @brief Check if the allocations are counted.
+			 *
+			 * Check if this build replaces the allocation operators. If not, the count
+			 * is always 0.
+			 *
+			 * @returns True if they are counted.
+			 */
+			static bool isEnabled();
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_ALLOCATIONCOUNTER_H_
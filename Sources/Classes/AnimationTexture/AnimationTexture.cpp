@@ -0,0 +1,104 @@
+/**
+ * @file AnimationTexture.cpp
+ * @brief AnimationTexture class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "AnimationTexture.h"
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "glew/glew.h"
+#include "glm/glm.hpp"
+
+#include "Classes/Animator/Animator.h"
+#include "Classes/GLHandle/GLHandle.h"
+#include "Classes/Object/Object.h"
+#include "Classes/ResourceTracker/ResourceTracker.h"
+#include "Classes/Shader/Shader.h"
+
+namespace aladdin_3d {
+
+	const GLuint AnimationTexture::slot;
+
+	AnimationTexture::AnimationTexture(Object &object, Animator &animator, GLsizei frames) {
+
+		this->joints = (GLsizei)object.getPalette().size();
+		this->frames = frames;
+		this->duration = animator.getDuration();
+
+		// Pose the object at every frame and keep the columns of its palette.
+		std::vector<glm::vec4> texels;
+		texels.reserve((size_t)this->joints * 4 * this->frames);
+
+		for (GLsizei i = 0; i < this->frames; i++) {
+
+			object.animate(animator, this->duration * i / this->frames);
+			const std::vector<glm::mat4> &palette = object.getPalette();
+
+			for (GLsizei j = 0; j < this->joints; j++) {
+
+				for (int k = 0; k < 4; k++)
+					texels.push_back(palette[j][k]);
+
+			}
+
+		}
+
+		// Generate the texture.
+		GLuint texture_name = 0;
+		glGenTextures(1, &texture_name);
+		this->ID = GLHandle(texture_name, ResourceTracker::textures, this->getGPUBytes());
+
+		// The shader reads exact texels and blends the frames itself.
+		glBindTexture(GL_TEXTURE_2D, texture_name);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA32F, this->joints * 4, this->frames, 0, GL_RGBA, GL_FLOAT, texels.data());
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+	}
+
+	void AnimationTexture::bind(Shader &shader) {
+
+		glActiveTexture(GL_TEXTURE0 + slot);
+		glBindTexture(GL_TEXTURE_2D, this->ID.get());
+
+		shader.activate();
+		shader.passInt("animation", slot);
+		shader.passFloat("animationDuration", this->duration);
+
+	}
+
+	float AnimationTexture::getDuration() const {
+
+		return this->duration;
+
+	}
+
+	size_t AnimationTexture::getGPUBytes() const {
+
+		return (size_t)this->joints * 4 * this->frames * sizeof(glm::vec4);
+
+	}
+
+	void AnimationTexture::remove() {
+
+		this->ID.reset();
+
+	}
+
+}  // namespace aladdin_3d
@@ -0,0 +1,112 @@
+/**
+ * @file AnimationTexture.h
+ * @brief AnimationTexture class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_ANIMATIONTEXTURE_H_
+#define ALADDIN_3D_CLASSES_ANIMATIONTEXTURE_H_
+
+#include <stddef.h>
+
+#include "glew/glew.h"
+
+#include "Classes/Animator/Animator.h"
+#include "Classes/GLHandle/GLHandle.h"
+#include "Classes/Object/Object.h"
+#include "Classes/Shader/Shader.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of an AnimationTexture class.
+	 *
+	 * Bakes a looping clip into a float texture once, so that playing it costs nothing
+	 * on the CPU. Every row of the texture is a frame of the clip, evenly spaced over
+	 * its duration, and holds the joint palette of that frame, one matrix column per
+	 * texel. The shader finds the frames around its time and blends them.
+	 *
+	 * The clip is baked for a skinned object, and any object with the same skin can
+	 * share the texture. It owns its OpenGL object, so it can be moved but not copied.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class AnimationTexture {
+
+		public:
+
+			/**
+			 * @brief Bakes a clip.
+			 *
+			 * Plays a clip on a skinned object at every frame and uploads the palettes
+			 * to a texture. The object is left at the pose of the last frame.
+			 *
+			 * @param object The skinned object.
+			 * @param animator The animator with the clip.
+			 * @param frames The number of frames to bake.
+			 */
+			AnimationTexture(Object &object, Animator &animator, GLsizei frames);
+
+			AnimationTexture(AnimationTexture&&) = default;
+			AnimationTexture &operator=(AnimationTexture&&) = default;
+			AnimationTexture(const AnimationTexture&) = delete;
+			AnimationTexture &operator=(const AnimationTexture&) = delete;
+
+			/**
+			 * @brief Binds the texture for a shader.
+			 *
+			 * Binds the texture in its slot and passes the slot and the duration of the
+			 * clip to the shader.
+			 *
+			 * @param shader The shader that plays the clip.
+			 */
+			void bind(Shader &shader);
+
+			/**
+			 * @brief Gets the duration of the clip.
+			 *
+			 * Gets the duration of the baked clip.
+			 *
+			 * @returns The duration in seconds.
+			 */
+			float getDuration() const;
+
+			/**
+			 * @brief Gets the memory used on the GPU.
+			 *
+			 * Gets the bytes of the baked palettes.
+			 *
+			 * @returns The number of bytes.
+			 */
+			size_t getGPUBytes() const;
+
+			/**
+			 * @brief Removes the texture from OpenGL.
+			 *
+			 * Removes the texture from OpenGL. It does nothing if it was already removed.
+			 */
+			void remove();
+
+			static const GLuint slot = 9;	/// Texture slot the shaders read the palettes from.
+
+		private:
+
+			GLHandle ID;				/// Texture OpenGL ID.
+			GLsizei joints = 0;			/// Number of joints of every palette.
+			GLsizei frames = 0;			/// Number of baked frames.
+			float duration = 0.0f;		/// Duration of the clip in seconds.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_ANIMATIONTEXTURE_H_
@@ -0,0 +1,165 @@
+/**
+ * @file Animator.cpp
+ * @brief Animator class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+
+#include "Animator.h"
+
+#include <math.h>
+#include <stddef.h>
+
+#include <memory>
+#include <vector>
+
+#include "glm/glm.hpp"
+#include "glm/gtc/quaternion.hpp"
+
+#include "Classes/BatchMaths/BatchMaths.h"
+#include "Classes/SceneGraph/SceneGraph.h"
+#include "Structs/AnimationClip/AnimationClip.h"
+
+namespace aladdin_3d {
+
+	const unsigned int Animator::translation;
+	const unsigned int Animator::rotation;
+	const unsigned int Animator::scale;
+
+	Animator::Animator(std::shared_ptr<const AnimationClip> clip) {
+
+		this->clip = clip;
+
+		// Lay the channels out with the rotations last, so that the linear blend only
+		// runs over the channels that keep it.
+		const std::vector<AnimationChannel> &channels = this->clip->channels;
+		this->channels.reserve(channels.size());
+
+		for (size_t i = 0; i < channels.size(); i++) {
+
+			if (channels[i].path != rotation)
+				this->channels.push_back(i);
+
+		}
+
+		this->vector_count = this->channels.size();
+
+		for (size_t i = 0; i < channels.size(); i++) {
+
+			if (channels[i].path == rotation)
+				this->channels.push_back(i);
+
+		}
+
+		// Make room for every channel once, sampling never allocates.
+		this->cursors = std::vector<size_t>(channels.size(), 0);
+		this->starts = std::vector<glm::vec4>(channels.size());
+		this->ends = std::vector<glm::vec4>(channels.size());
+		this->factors = std::vector<float>(channels.size(), 0.0f);
+		this->values = std::vector<glm::vec4>(channels.size());
+
+	}
+
+	void Animator::apply(float time, SceneGraph *graph) {
+
+		// Loop the clip.
+		float duration = this->clip->duration;
+		float local_time = duration > 0.0f ? fmodf(time, duration) : 0.0f;
+
+		if (local_time < 0.0f)
+			local_time += duration;
+
+		this->sample(local_time);
+
+		// Replace the animated transforms of the nodes.
+		const std::vector<AnimationChannel> &channels = this->clip->channels;
+
+		for (size_t i = 0; i < this->channels.size(); i++) {
+
+			const AnimationChannel &channel = channels[this->channels[i]];
+
+			glm::vec3 node_translation;
+			glm::quat node_rotation;
+			glm::vec3 node_scale;
+			graph->getTransforms(channel.node, &node_translation, &node_rotation, &node_scale);
+
+			const glm::vec4 &value = this->values[i];
+
+			if (channel.path == translation)
+				node_translation = glm::vec3(value);
+			else if (channel.path == rotation)
+				node_rotation = glm::normalize(glm::quat(value.w, value.x, value.y, value.z));
+			else
+				node_scale = glm::vec3(value);
+
+			graph->setTransforms(channel.node, node_translation, node_rotation, node_scale);
+
+		}
+
+	}
+
+	std::shared_ptr<const AnimationClip> Animator::getClip() const {
+
+		return this->clip;
+
+	}
+
+	float Animator::getDuration() const {
+
+		return this->clip->duration;
+
+	}
+
+	void Animator::sample(float time) {
+
+		const std::vector<AnimationChannel> &channels = this->clip->channels;
+
+		// Find the keys around the time. Time usually moves forward a little between
+		// samples, so the search starts from the previous keys.
+		for (size_t i = 0; i < this->channels.size(); i++) {
+
+			const AnimationChannel &channel = channels[this->channels[i]];
+			const std::vector<float> &times = channel.times;
+			size_t &cursor = this->cursors[i];
+
+			if (cursor >= times.size() || times[cursor] > time)
+				cursor = 0;
+
+			while (cursor + 1 < times.size() && times[cursor + 1] <= time)
+				cursor++;
+
+			size_t next = cursor + 1 < times.size() ? cursor + 1 : cursor;
+			float span = times[next] - times[cursor];
+
+			this->starts[i] = channel.values[cursor];
+			this->ends[i] = channel.values[next];
+			this->factors[i] = span > 0.0f ? glm::clamp((time - times[cursor]) / span, 0.0f, 1.0f) : 0.0f;
+
+		}
+
+		// Blend the translations and scales at once.
+		BatchMaths::lerp(this->starts.data(), this->ends.data(), this->factors.data(), this->values.data(), this->vector_count);
+
+		// The linear blend cuts through the arc between rotations, so take them along it.
+		for (size_t i = this->vector_count; i < this->channels.size(); i++) {
+
+			const glm::vec4 &start = this->starts[i];
+			const glm::vec4 &end = this->ends[i];
+			glm::quat value = glm::slerp(glm::quat(start.w, start.x, start.y, start.z), glm::quat(end.w, end.x, end.y, end.z), this->factors[i]);
+
+			this->values[i] = glm::vec4(value.x, value.y, value.z, value.w);
+
+		}
+
+	}
+
+}  // namespace aladdin_3d
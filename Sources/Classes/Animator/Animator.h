@@ -0,0 +1,118 @@
+/**
+ * @file Animator.h
+ * @brief Animator class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+
+#ifndef ALADDIN_3D_CLASSES_ANIMATOR_H_
+#define ALADDIN_3D_CLASSES_ANIMATOR_H_
+
+#include <stddef.h>
+
+#include <memory>
+#include <vector>
+
+#include "glm/glm.hpp"
+
+#include "Classes/SceneGraph/SceneGraph.h"
+#include "Structs/AnimationClip/AnimationClip.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of an Animator class.
+	 *
+	 * Plays an animation clip on the nodes of a scene graph. The clip is shared, so
+	 * any number of animators can play it, each one at its own time.
+	 *
+	 * Sampling runs in passes over all the channels at once. The first one finds the
+	 * keys around the time, starting from the keys of the previous sample, and gathers
+	 * them into contiguous arrays. The channels are laid out once, with the
+	 * translations and scales first and the rotations last. The second pass blends
+	 * the translations and scales with the SIMD kernels of BatchMaths, whole vectors
+	 * at a time. The last one takes the rotations along the shortest arc with a
+	 * spherical blend, so that they turn at a steady speed even between keys far apart.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class Animator {
+
+		public:
+
+			/**
+			 * @brief Builds an animator.
+			 *
+			 * Builds an animator for a clip.
+			 *
+			 * @param clip The clip to play.
+			 */
+			Animator(std::shared_ptr<const AnimationClip> clip);
+
+			/**
+			 * @brief Applies the clip to a scene graph.
+			 *
+			 * Samples the clip at a time, looping it, and replaces the transforms of the
+			 * animated nodes with the result. The rest of their transforms stay the same.
+			 *
+			 * @param time The time in seconds.
+			 * @param graph The scene graph with the animated nodes.
+			 */
+			void apply(float time, SceneGraph *graph);
+
+			/**
+			 * @brief Gets the clip.
+			 *
+			 * Gets the clip, so that other animators can play it too.
+			 *
+			 * @returns The clip.
+			 */
+			std::shared_ptr<const AnimationClip> getClip() const;
+
+			/**
+			 * @brief Gets the duration of the clip.
+			 *
+			 * Gets the duration of the clip.
+			 *
+			 * @returns The duration in seconds.
+			 */
+			float getDuration() const;
+
+			static const unsigned int translation = 0;	/// Path of the translation channels.
+			static const unsigned int rotation = 1;		/// Path of the rotation channels.
+			static const unsigned int scale = 2;		/// Path of the scale channels.
+
+		private:
+
+			/**
+			 * @brief Samples the clip.
+			 *
+			 * Computes the value of every channel at a time inside the clip.
+			 *
+			 * @param time The time in seconds, between 0 and the duration.
+			 */
+			void sample(float time);
+
+			std::shared_ptr<const AnimationClip> clip;	/// Clip being played.
+			std::vector<size_t> channels;				/// Channel in every slot, the rotations last.
+			size_t vector_count = 0;					/// Number of slots with a translation or a scale.
+			std::vector<size_t> cursors;				/// Key before the last sampled time of every slot.
+			std::vector<glm::vec4> starts;				/// Key before the time of every slot.
+			std::vector<glm::vec4> ends;				/// Key after the time of every slot.
+			std::vector<float> factors;					/// How far the time is between both keys of every slot.
+			std::vector<glm::vec4> values;				/// Sampled value of every slot.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_ANIMATOR_H_
@@ -0,0 +1,1459 @@
+/**
+ * @file BatchMaths.cpp
+ * @brief BatchMaths class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "BatchMaths.h"
+
+#include <math.h>
+#include <stddef.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ALADDIN_3D_BATCH_SSE
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define ALADDIN_3D_BATCH_AVX2
+#else
+#include <cpuid.h>
+#define ALADDIN_3D_BATCH_AVX2 __attribute__((target("avx2,fma")))
+#endif
+#endif
+
+#include "glm/glm.hpp"
+
+#include "Structs/BoundingBox/BoundingBox.h"
+#include "Structs/BoundingSphere/BoundingSphere.h"
+#include "Structs/Vertex/Vertex.h"
+
+namespace aladdin_3d {
+
+	// The kernels read the vectors and the boxes as plain arrays of floats.
+	static_assert(sizeof(glm::vec3) == 3 * sizeof(float), "glm::vec3 must be packed.");
+	static_assert(sizeof(glm::vec4) == 4 * sizeof(float), "glm::vec4 must be packed.");
+	static_assert(sizeof(BoundingBox) == 6 * sizeof(float), "BoundingBox must be packed.");
+	static_assert(sizeof(Vertex) == 11 * sizeof(float), "Vertex must be packed.");
+
+	namespace {
+
+		/**
+		 * @brief Finds the best instruction set.
+		 *
+		 * Asks the CPU, and the operating system for AVX, which instruction sets it supports.
+		 *
+		 * @returns The best instruction set.
+		 */
+		BatchMaths::InstructionSets detectInstructionSet() {
+
+#if defined(ALADDIN_3D_BATCH_SSE) && defined(_MSC_VER)
+
+			int info[4];
+			__cpuid(info, 0);
+
+			if (info[0] < 7)
+				return BatchMaths::SSE;
+
+			// AVX2 needs FMA too, and the operating system has to save the AVX registers.
+			__cpuid(info, 1);
+			bool fma = (info[2] & (1 << 12)) != 0;
+			bool os_saves = (info[2] & (1 << 27)) != 0;
+			bool avx = (info[2] & (1 << 28)) != 0;
+
+			if (!fma || !os_saves || !avx || (_xgetbv(0) & 6) != 6)
+				return BatchMaths::SSE;
+
+			__cpuidex(info, 7, 0);
+
+			return (info[1] & (1 << 5)) ? BatchMaths::AVX2 : BatchMaths::SSE;
+
+#elif defined(ALADDIN_3D_BATCH_SSE)
+
+			__builtin_cpu_init();
+
+			return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") ? BatchMaths::AVX2 : BatchMaths::SSE;
+
+#else
+
+			return BatchMaths::SCALAR;
+
+#endif
+
+		}
+
+		const BatchMaths::InstructionSets best_instruction_set = detectInstructionSet();	/// Best set the CPU supports.
+		BatchMaths::InstructionSets instruction_set = best_instruction_set;				/// Set the kernels use.
+
+		/**
+		 * @brief Multiplies matrices without SIMD.
+		 *
+		 * Multiplies pairs of column-major matrices.
+		 *
+		 * @param a The left matrices.
+		 * @param a_step The distance between the left matrices, 0 to use the same one.
+		 * @param b The right matrices.
+		 * @param out The products.
+		 * @param out_step The distance between the products.
+		 * @param count The number of matrices.
+		 */
+		void multiplyScalar(const float *a, size_t a_step, const float *b, float *out, size_t out_step, size_t count) {
+
+			for (size_t n = 0; n < count; n++, a += a_step, b += 16, out += out_step) {
+
+				float result[16];
+
+				for (int column = 0; column < 4; column++) {
+
+					for (int row = 0; row < 4; row++) {
+
+						result[column * 4 + row] = a[row] * b[column * 4] + a[4 + row] * b[column * 4 + 1] +
+							a[8 + row] * b[column * 4 + 2] + a[12 + row] * b[column * 4 + 3];
+
+					}
+
+				}
+
+				for (int i = 0; i < 16; i++)
+					out[i] = result[i];
+
+			}
+
+		}
+
+		/**
+		 * @brief Inverts an affine matrix without SIMD.
+		 *
+		 * The rows of the inverse of the upper 3x3 part are the cross products of its
+		 * columns over its determinant, and the translation goes back through them.
+		 *
+		 * @param m The matrix.
+		 * @param out The inverse.
+		 */
+		void inverseAffineScalar(const float *m, float *out) {
+
+			glm::vec3 c0(m[0], m[1], m[2]);
+			glm::vec3 c1(m[4], m[5], m[6]);
+			glm::vec3 c2(m[8], m[9], m[10]);
+			glm::vec3 t(m[12], m[13], m[14]);
+
+			glm::vec3 r0 = glm::cross(c1, c2);
+			glm::vec3 r1 = glm::cross(c2, c0);
+			glm::vec3 r2 = glm::cross(c0, c1);
+			float inverse_determinant = 1.0f / glm::dot(c0, r0);
+
+			r0 *= inverse_determinant;
+			r1 *= inverse_determinant;
+			r2 *= inverse_determinant;
+
+			float result[16] = {
+				r0.x, r1.x, r2.x, 0.0f,
+				r0.y, r1.y, r2.y, 0.0f,
+				r0.z, r1.z, r2.z, 0.0f,
+				-glm::dot(r0, t), -glm::dot(r1, t), -glm::dot(r2, t), 1.0f
+			};
+
+			for (int i = 0; i < 16; i++)
+				out[i] = result[i];
+
+		}
+
+		/**
+		 * @brief Transforms a point without SIMD.
+		 *
+		 * Transforms a point by an affine matrix.
+		 *
+		 * @param m The matrix.
+		 * @param point The point.
+		 * @param out The transformed point.
+		 */
+		void transformPointScalar(const float *m, const float *point, float *out) {
+
+			float x = point[0];
+			float y = point[1];
+			float z = point[2];
+
+			out[0] = m[0] * x + m[4] * y + m[8] * z + m[12];
+			out[1] = m[1] * x + m[5] * y + m[9] * z + m[13];
+			out[2] = m[2] * x + m[6] * y + m[10] * z + m[14];
+
+		}
+
+		/**
+		 * @brief Transforms a box without SIMD.
+		 *
+		 * Moves the centre of a box and projects its half size on the axes.
+		 *
+		 * @param m The matrix.
+		 * @param box The box, its minimum and its maximum.
+		 * @param out The transformed box.
+		 */
+		void transformBoxScalar(const float *m, const float *box, float *out) {
+
+			float centre[3];
+			float extent[3];
+
+			for (int i = 0; i < 3; i++) {
+
+				centre[i] = (box[i] + box[3 + i]) * 0.5f;
+				extent[i] = (box[3 + i] - box[i]) * 0.5f;
+
+			}
+
+			for (int i = 0; i < 3; i++) {
+
+				float c = m[i] * centre[0] + m[4 + i] * centre[1] + m[8 + i] * centre[2] + m[12 + i];
+				float e = fabsf(m[i]) * extent[0] + fabsf(m[4 + i]) * extent[1] + fabsf(m[8 + i]) * extent[2];
+
+				out[i] = c - e;
+				out[3 + i] = c + e;
+
+			}
+
+		}
+
+		/**
+		 * @brief Gets the bounds of vertices without SIMD.
+		 *
+		 * Gets the minimum and the maximum of the positions of the vertices.
+		 *
+		 * @param vertices The vertices, as floats.
+		 * @param count The number of vertices, at least one.
+		 * @param out The minimum and the maximum.
+		 */
+		void boundVerticesScalar(const float *vertices, size_t count, float *out) {
+
+			// Keep the bounds in locals, the output could alias the vertices.
+			float min_x = vertices[0], min_y = vertices[1], min_z = vertices[2];
+			float max_x = min_x, max_y = min_y, max_z = min_z;
+
+			for (size_t i = 1; i < count; i++) {
+
+				const float *position = vertices + i * 11;
+
+				min_x = position[0] < min_x ? position[0] : min_x;
+				min_y = position[1] < min_y ? position[1] : min_y;
+				min_z = position[2] < min_z ? position[2] : min_z;
+				max_x = position[0] > max_x ? position[0] : max_x;
+				max_y = position[1] > max_y ? position[1] : max_y;
+				max_z = position[2] > max_z ? position[2] : max_z;
+
+			}
+
+			out[0] = min_x;
+			out[1] = min_y;
+			out[2] = min_z;
+			out[3] = max_x;
+			out[4] = max_y;
+			out[5] = max_z;
+
+		}
+
+		/**
+		 * @brief Gets the farthest vertex without SIMD.
+		 *
+		 * Gets the largest squared distance from a point to the positions of the vertices.
+		 *
+		 * @param vertices The vertices, as floats.
+		 * @param count The number of vertices.
+		 * @param centre The point.
+		 *
+		 * @returns The squared distance.
+		 */
+		float farthestVertexScalar(const float *vertices, size_t count, const glm::vec3 &centre) {
+
+			float farthest = 0.0f;
+
+			for (size_t i = 0; i < count; i++) {
+
+				const float *position = vertices + i * 11;
+				float x = position[0] - centre.x;
+				float y = position[1] - centre.y;
+				float z = position[2] - centre.z;
+				float distance = x * x + y * y + z * z;
+
+				farthest = distance > farthest ? distance : farthest;
+
+			}
+
+			return farthest;
+
+		}
+
+		/**
+		 * @brief Tests a box against a frustum without SIMD.
+		 *
+		 * A box is outside if its corner furthest along the normal of a plane is behind it.
+		 *
+		 * @param planes The planes.
+		 * @param box The box, its minimum and its maximum.
+		 *
+		 * @returns 1 if the box may be inside, 0 otherwise.
+		 */
+		char cullBoxScalar(const glm::vec4 planes[6], const float *box) {
+
+			for (int i = 0; i < 6; i++) {
+
+				float x = planes[i].x >= 0.0f ? box[3] : box[0];
+				float y = planes[i].y >= 0.0f ? box[4] : box[1];
+				float z = planes[i].z >= 0.0f ? box[5] : box[2];
+
+				if (planes[i].x * x + planes[i].y * y + planes[i].z * z + planes[i].w < 0.0f)
+					return 0;
+
+			}
+
+			return 1;
+
+		}
+
+#ifdef ALADDIN_3D_BATCH_SSE
+
+		/**
+		 * @brief Multiplies matrices with SSE.
+		 *
+		 * Builds every column of the product from the columns of the left matrix.
+		 *
+		 * @param a The left matrices.
+		 * @param a_step The distance between the left matrices, 0 to use the same one.
+		 * @param b The right matrices.
+		 * @param out The products.
+		 * @param out_step The distance between the products.
+		 * @param count The number of matrices.
+		 */
+		void multiplySSE(const float *a, size_t a_step, const float *b, float *out, size_t out_step, size_t count) {
+
+			for (size_t n = 0; n < count; n++, a += a_step, b += 16, out += out_step) {
+
+				__m128 a0 = _mm_loadu_ps(a);
+				__m128 a1 = _mm_loadu_ps(a + 4);
+				__m128 a2 = _mm_loadu_ps(a + 8);
+				__m128 a3 = _mm_loadu_ps(a + 12);
+
+				// Every column of b is read before the same column of the product is written.
+				for (int i = 0; i < 4; i++) {
+
+					__m128 column = _mm_mul_ps(a0, _mm_set1_ps(b[i * 4]));
+					column = _mm_add_ps(column, _mm_mul_ps(a1, _mm_set1_ps(b[i * 4 + 1])));
+					column = _mm_add_ps(column, _mm_mul_ps(a2, _mm_set1_ps(b[i * 4 + 2])));
+					column = _mm_add_ps(column, _mm_mul_ps(a3, _mm_set1_ps(b[i * 4 + 3])));
+
+					_mm_storeu_ps(out + i * 4, column);
+
+				}
+
+			}
+
+		}
+
+		/**
+		 * @brief Gets a cross product with SSE.
+		 *
+		 * Gets the cross product of the first three lanes of two vectors. The last
+		 * lane is zero for finite vectors.
+		 *
+		 * @param a The first vector.
+		 * @param b The second vector.
+		 *
+		 * @returns The cross product.
+		 */
+		inline __m128 crossSSE(__m128 a, __m128 b) {
+
+			__m128 a_yzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+			__m128 b_yzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+			__m128 c = _mm_sub_ps(_mm_mul_ps(a, b_yzx), _mm_mul_ps(a_yzx, b));
+
+			return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+
+		}
+
+		/**
+		 * @brief Inverts an affine matrix with SSE.
+		 *
+		 * Same as the scalar version, with one column per register.
+		 *
+		 * @param m The matrix.
+		 * @param out The inverse.
+		 */
+		void inverseAffineSSE(const float *m, float *out) {
+
+			__m128 c0 = _mm_loadu_ps(m);
+			__m128 c1 = _mm_loadu_ps(m + 4);
+			__m128 c2 = _mm_loadu_ps(m + 8);
+			__m128 t = _mm_loadu_ps(m + 12);
+
+			__m128 r0 = crossSSE(c1, c2);
+			__m128 r1 = crossSSE(c2, c0);
+			__m128 r2 = crossSSE(c0, c1);
+			__m128 r3 = _mm_setzero_ps();
+
+			// Add up the lanes of the determinant in all of them.
+			__m128 d = _mm_mul_ps(c0, r0);
+			d = _mm_add_ps(_mm_add_ps(_mm_shuffle_ps(d, d, 0x00), _mm_shuffle_ps(d, d, 0x55)), _mm_shuffle_ps(d, d, 0xAA));
+			__m128 inverse_determinant = _mm_div_ps(_mm_set1_ps(1.0f), d);
+
+			r0 = _mm_mul_ps(r0, inverse_determinant);
+			r1 = _mm_mul_ps(r1, inverse_determinant);
+			r2 = _mm_mul_ps(r2, inverse_determinant);
+
+			// The rows become the columns.
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+			__m128 translation = _mm_mul_ps(r0, _mm_shuffle_ps(t, t, 0x00));
+			translation = _mm_add_ps(translation, _mm_mul_ps(r1, _mm_shuffle_ps(t, t, 0x55)));
+			translation = _mm_add_ps(translation, _mm_mul_ps(r2, _mm_shuffle_ps(t, t, 0xAA)));
+			translation = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), translation);
+
+			_mm_storeu_ps(out, r0);
+			_mm_storeu_ps(out + 4, r1);
+			_mm_storeu_ps(out + 8, r2);
+			_mm_storeu_ps(out + 12, translation);
+
+		}
+
+		/**
+		 * @brief Stores the first three lanes of a register.
+		 *
+		 * Stores the first three lanes of a register without touching the next float.
+		 *
+		 * @param out Where to store them.
+		 * @param v The register.
+		 */
+		inline void storeVec3SSE(float *out, __m128 v) {
+
+			_mm_storel_pi((__m64*)out, v);
+			_mm_store_ss(out + 2, _mm_movehl_ps(v, v));
+
+		}
+
+		/**
+		 * @brief Transforms points with SSE.
+		 *
+		 * Transforms every point with one register per column of the matrix.
+		 *
+		 * @param m The matrix.
+		 * @param points The points.
+		 * @param out The transformed points.
+		 * @param count The number of points.
+		 */
+		void transformPointsSSE(const float *m, const float *points, float *out, size_t count) {
+
+			__m128 c0 = _mm_loadu_ps(m);
+			__m128 c1 = _mm_loadu_ps(m + 4);
+			__m128 c2 = _mm_loadu_ps(m + 8);
+			__m128 c3 = _mm_loadu_ps(m + 12);
+
+			for (size_t i = 0; i < count; i++, points += 3, out += 3) {
+
+				__m128 result = _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(points[0])), c3);
+				result = _mm_add_ps(result, _mm_mul_ps(c1, _mm_set1_ps(points[1])));
+				result = _mm_add_ps(result, _mm_mul_ps(c2, _mm_set1_ps(points[2])));
+
+				storeVec3SSE(out, result);
+
+			}
+
+		}
+
+		/**
+		 * @brief Transforms boxes with SSE.
+		 *
+		 * Transforms every box with one register per column of the matrix.
+		 *
+		 * @param m The matrix.
+		 * @param boxes The boxes.
+		 * @param out The transformed boxes.
+		 * @param count The number of boxes.
+		 */
+		void transformBoxesSSE(const float *m, const float *boxes, float *out, size_t count) {
+
+			__m128 sign = _mm_set1_ps(-0.0f);
+			__m128 half = _mm_set1_ps(0.5f);
+			__m128 c0 = _mm_loadu_ps(m);
+			__m128 c1 = _mm_loadu_ps(m + 4);
+			__m128 c2 = _mm_loadu_ps(m + 8);
+			__m128 c3 = _mm_loadu_ps(m + 12);
+			__m128 a0 = _mm_andnot_ps(sign, c0);
+			__m128 a1 = _mm_andnot_ps(sign, c1);
+			__m128 a2 = _mm_andnot_ps(sign, c2);
+
+			for (size_t i = 0; i < count; i++, boxes += 6, out += 6) {
+
+				__m128 min = _mm_setr_ps(boxes[0], boxes[1], boxes[2], 0.0f);
+				__m128 max = _mm_setr_ps(boxes[3], boxes[4], boxes[5], 0.0f);
+				__m128 centre = _mm_mul_ps(_mm_add_ps(min, max), half);
+				__m128 extent = _mm_mul_ps(_mm_sub_ps(max, min), half);
+
+				__m128 c = _mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(centre, centre, 0x00)), c3);
+				c = _mm_add_ps(c, _mm_mul_ps(c1, _mm_shuffle_ps(centre, centre, 0x55)));
+				c = _mm_add_ps(c, _mm_mul_ps(c2, _mm_shuffle_ps(centre, centre, 0xAA)));
+
+				__m128 e = _mm_mul_ps(a0, _mm_shuffle_ps(extent, extent, 0x00));
+				e = _mm_add_ps(e, _mm_mul_ps(a1, _mm_shuffle_ps(extent, extent, 0x55)));
+				e = _mm_add_ps(e, _mm_mul_ps(a2, _mm_shuffle_ps(extent, extent, 0xAA)));
+
+				storeVec3SSE(out, _mm_sub_ps(c, e));
+				storeVec3SSE(out + 3, _mm_add_ps(c, e));
+
+			}
+
+		}
+
+		/**
+		 * @brief Tests boxes against a frustum with SSE.
+		 *
+		 * Tests four boxes at once, with one register per coordinate.
+		 *
+		 * @param planes The planes.
+		 * @param boxes The boxes.
+		 * @param inside The results.
+		 * @param count The number of boxes.
+		 */
+		void cullBoxesSSE(const glm::vec4 planes[6], const float *boxes, char *inside, size_t count) {
+
+			size_t i = 0;
+
+			for (; i + 4 <= count; i += 4) {
+
+				const float *b = boxes + i * 6;
+				__m128 min_x = _mm_setr_ps(b[0], b[6], b[12], b[18]);
+				__m128 min_y = _mm_setr_ps(b[1], b[7], b[13], b[19]);
+				__m128 min_z = _mm_setr_ps(b[2], b[8], b[14], b[20]);
+				__m128 max_x = _mm_setr_ps(b[3], b[9], b[15], b[21]);
+				__m128 max_y = _mm_setr_ps(b[4], b[10], b[16], b[22]);
+				__m128 max_z = _mm_setr_ps(b[5], b[11], b[17], b[23]);
+				__m128 outside = _mm_setzero_ps();
+
+				// The sign of every plane picks the corner to test, the same for all the boxes.
+				for (int j = 0; j < 6; j++) {
+
+					__m128 distance = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes[j].x), planes[j].x >= 0.0f ? max_x : min_x),
+						_mm_set1_ps(planes[j].w));
+					distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(planes[j].y), planes[j].y >= 0.0f ? max_y : min_y));
+					distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(planes[j].z), planes[j].z >= 0.0f ? max_z : min_z));
+					outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, _mm_setzero_ps()));
+
+				}
+
+				int mask = _mm_movemask_ps(outside);
+
+				for (int k = 0; k < 4; k++)
+					inside[i + k] = (mask & (1 << k)) ? 0 : 1;
+
+			}
+
+			for (; i < count; i++)
+				inside[i] = cullBoxScalar(planes, boxes + i * 6);
+
+		}
+
+		/**
+		 * @brief Gets the bounds of vertices with SSE.
+		 *
+		 * Loads every position in a register, with two pairs of accumulators to
+		 * overlap the loads.
+		 *
+		 * @param vertices The vertices, as floats.
+		 * @param count The number of vertices, at least one.
+		 * @param out The minimum and the maximum.
+		 */
+		void boundVerticesSSE(const float *vertices, size_t count, float *out) {
+
+			// The fourth lane reads the normal, which is ignored.
+			__m128 min0 = _mm_loadu_ps(vertices);
+			__m128 max0 = min0;
+			__m128 min1 = min0;
+			__m128 max1 = min0;
+			size_t i = 1;
+
+			for (; i + 2 <= count; i += 2) {
+
+				__m128 a = _mm_loadu_ps(vertices + i * 11);
+				__m128 b = _mm_loadu_ps(vertices + (i + 1) * 11);
+
+				min0 = _mm_min_ps(min0, a);
+				max0 = _mm_max_ps(max0, a);
+				min1 = _mm_min_ps(min1, b);
+				max1 = _mm_max_ps(max1, b);
+
+			}
+
+			if (i < count) {
+
+				__m128 a = _mm_loadu_ps(vertices + i * 11);
+				min0 = _mm_min_ps(min0, a);
+				max0 = _mm_max_ps(max0, a);
+
+			}
+
+			storeVec3SSE(out, _mm_min_ps(min0, min1));
+			storeVec3SSE(out + 3, _mm_max_ps(max0, max1));
+
+		}
+
+		/**
+		 * @brief Gets the farthest vertex with SSE.
+		 *
+		 * Measures four vertices at once, with one register per coordinate.
+		 *
+		 * @param vertices The vertices, as floats.
+		 * @param count The number of vertices.
+		 * @param centre The point.
+		 *
+		 * @returns The squared distance.
+		 */
+		float farthestVertexSSE(const float *vertices, size_t count, const glm::vec3 &centre) {
+
+			__m128 centre_x = _mm_set1_ps(centre.x);
+			__m128 centre_y = _mm_set1_ps(centre.y);
+			__m128 centre_z = _mm_set1_ps(centre.z);
+			__m128 farthest = _mm_setzero_ps();
+			size_t i = 0;
+
+			for (; i + 4 <= count; i += 4) {
+
+				const float *v = vertices + i * 11;
+				__m128 x = _mm_sub_ps(_mm_setr_ps(v[0], v[11], v[22], v[33]), centre_x);
+				__m128 y = _mm_sub_ps(_mm_setr_ps(v[1], v[12], v[23], v[34]), centre_y);
+				__m128 z = _mm_sub_ps(_mm_setr_ps(v[2], v[13], v[24], v[35]), centre_z);
+				__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+
+				farthest = _mm_max_ps(farthest, distance);
+
+			}
+
+			farthest = _mm_max_ps(farthest, _mm_movehl_ps(farthest, farthest));
+			farthest = _mm_max_ss(farthest, _mm_shuffle_ps(farthest, farthest, 0x55));
+
+			float result = _mm_cvtss_f32(farthest);
+			float rest = farthestVertexScalar(vertices + i * 11, count - i, centre);
+
+			return rest > result ? rest : result;
+
+		}
+
+		/**
+		 * @brief Blends vectors with SSE.
+		 *
+		 * Blends a whole vector at once, with its factor in every lane.
+		 *
+		 * @param starts The starts, as floats.
+		 * @param ends The ends, as floats.
+		 * @param factors The factor of every vector.
+		 * @param out The blended vectors, as floats.
+		 * @param count The number of vectors.
+		 */
+		void lerpSSE(const float *starts, const float *ends, const float *factors, float *out, size_t count) {
+
+			for (size_t i = 0; i < count; i++, starts += 4, ends += 4, out += 4) {
+
+				__m128 start = _mm_loadu_ps(starts);
+				__m128 end = _mm_loadu_ps(ends);
+
+				_mm_storeu_ps(out, _mm_add_ps(start, _mm_mul_ps(_mm_sub_ps(end, start), _mm_set1_ps(factors[i]))));
+
+			}
+
+		}
+
+		/**
+		 * @brief Multiplies matrices with AVX2.
+		 *
+		 * Builds two columns of the product at once, with the columns of the left
+		 * matrix in both halves of the registers.
+		 *
+		 * @param a The left matrices.
+		 * @param a_step The distance between the left matrices, 0 to use the same one.
+		 * @param b The right matrices.
+		 * @param out The products.
+		 * @param out_step The distance between the products.
+		 * @param count The number of matrices.
+		 */
+		ALADDIN_3D_BATCH_AVX2 void multiplyAVX2(const float *a, size_t a_step, const float *b, float *out, size_t out_step, size_t count) {
+
+			for (size_t n = 0; n < count; n++, a += a_step, b += 16, out += out_step) {
+
+				__m256 a0 = _mm256_broadcast_ps((const __m128*)a);
+				__m256 a1 = _mm256_broadcast_ps((const __m128*)(a + 4));
+				__m256 a2 = _mm256_broadcast_ps((const __m128*)(a + 8));
+				__m256 a3 = _mm256_broadcast_ps((const __m128*)(a + 12));
+
+				for (int i = 0; i < 4; i += 2) {
+
+					// Spread every element of both columns of b over its own half.
+					__m256 columns = _mm256_loadu_ps(b + i * 4);
+					__m256 result = _mm256_mul_ps(a0, _mm256_shuffle_ps(columns, columns, 0x00));
+					result = _mm256_fmadd_ps(a1, _mm256_shuffle_ps(columns, columns, 0x55), result);
+					result = _mm256_fmadd_ps(a2, _mm256_shuffle_ps(columns, columns, 0xAA), result);
+					result = _mm256_fmadd_ps(a3, _mm256_shuffle_ps(columns, columns, 0xFF), result);
+
+					_mm256_storeu_ps(out + i * 4, result);
+
+				}
+
+			}
+
+			_mm256_zeroupper();
+
+		}
+
+		/**
+		 * @brief Loads a column of two matrices.
+		 *
+		 * Loads the same column of two matrices, one in every half of a register.
+		 *
+		 * @param first The column of the first matrix.
+		 * @param second The column of the second matrix.
+		 *
+		 * @returns The register.
+		 */
+		ALADDIN_3D_BATCH_AVX2 inline __m256 loadPairAVX2(const float *first, const float *second) {
+
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(first)), _mm_loadu_ps(second), 1);
+
+		}
+
+		/**
+		 * @brief Stores a column of two matrices.
+		 *
+		 * Stores every half of a register in the same column of two matrices.
+		 *
+		 * @param first The column of the first matrix.
+		 * @param second The column of the second matrix.
+		 * @param v The register.
+		 */
+		ALADDIN_3D_BATCH_AVX2 inline void storePairAVX2(float *first, float *second, __m256 v) {
+
+			_mm_storeu_ps(first, _mm256_castps256_ps128(v));
+			_mm_storeu_ps(second, _mm256_extractf128_ps(v, 1));
+
+		}
+
+		/**
+		 * @brief Gets two cross products with AVX2.
+		 *
+		 * Gets the cross products of both halves of two registers.
+		 *
+		 * @param a The first vectors.
+		 * @param b The second vectors.
+		 *
+		 * @returns The cross products.
+		 */
+		ALADDIN_3D_BATCH_AVX2 inline __m256 crossAVX2(__m256 a, __m256 b) {
+
+			__m256 a_yzx = _mm256_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+			__m256 b_yzx = _mm256_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+			__m256 c = _mm256_fmsub_ps(a, b_yzx, _mm256_mul_ps(a_yzx, b));
+
+			return _mm256_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+
+		}
+
+		/**
+		 * @brief Inverts affine matrices with AVX2.
+		 *
+		 * Inverts two matrices at once, one in every half of the registers.
+		 *
+		 * @param matrices The matrices.
+		 * @param out The inverses.
+		 * @param count The number of matrices.
+		 */
+		ALADDIN_3D_BATCH_AVX2 void inverseAffineAVX2(const float *matrices, float *out, size_t count) {
+
+			size_t i = 0;
+
+			for (; i + 2 <= count; i += 2) {
+
+				const float *m0 = matrices + i * 16;
+				const float *m1 = m0 + 16;
+				float *out0 = out + i * 16;
+				float *out1 = out0 + 16;
+
+				__m256 c0 = loadPairAVX2(m0, m1);
+				__m256 c1 = loadPairAVX2(m0 + 4, m1 + 4);
+				__m256 c2 = loadPairAVX2(m0 + 8, m1 + 8);
+				__m256 t = loadPairAVX2(m0 + 12, m1 + 12);
+
+				__m256 r0 = crossAVX2(c1, c2);
+				__m256 r1 = crossAVX2(c2, c0);
+				__m256 r2 = crossAVX2(c0, c1);
+				__m256 r3 = _mm256_setzero_ps();
+
+				__m256 d = _mm256_mul_ps(c0, r0);
+				d = _mm256_add_ps(_mm256_add_ps(_mm256_shuffle_ps(d, d, 0x00), _mm256_shuffle_ps(d, d, 0x55)), _mm256_shuffle_ps(d, d, 0xAA));
+				__m256 inverse_determinant = _mm256_div_ps(_mm256_set1_ps(1.0f), d);
+
+				r0 = _mm256_mul_ps(r0, inverse_determinant);
+				r1 = _mm256_mul_ps(r1, inverse_determinant);
+				r2 = _mm256_mul_ps(r2, inverse_determinant);
+
+				// Transpose both halves, the rows become the columns.
+				__m256 t0 = _mm256_unpacklo_ps(r0, r1);
+				__m256 t1 = _mm256_unpacklo_ps(r2, r3);
+				__m256 t2 = _mm256_unpackhi_ps(r0, r1);
+				__m256 t3 = _mm256_unpackhi_ps(r2, r3);
+				r0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+				r1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+				r2 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+
+				__m256 translation = _mm256_mul_ps(r0, _mm256_shuffle_ps(t, t, 0x00));
+				translation = _mm256_fmadd_ps(r1, _mm256_shuffle_ps(t, t, 0x55), translation);
+				translation = _mm256_fmadd_ps(r2, _mm256_shuffle_ps(t, t, 0xAA), translation);
+				translation = _mm256_sub_ps(_mm256_setr_ps(0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f), translation);
+
+				storePairAVX2(out0, out1, r0);
+				storePairAVX2(out0 + 4, out1 + 4, r1);
+				storePairAVX2(out0 + 8, out1 + 8, r2);
+				storePairAVX2(out0 + 12, out1 + 12, translation);
+
+			}
+
+			_mm256_zeroupper();
+
+			for (; i < count; i++)
+				inverseAffineSSE(matrices + i * 16, out + i * 16);
+
+		}
+
+		/**
+		 * @brief Transforms points with AVX2.
+		 *
+		 * Transforms eight points at once, gathering every coordinate in its own register.
+		 *
+		 * @param m The matrix.
+		 * @param points The points.
+		 * @param out The transformed points.
+		 * @param count The number of points.
+		 */
+		ALADDIN_3D_BATCH_AVX2 void transformPointsAVX2(const float *m, const float *points, float *out, size_t count) {
+
+			const __m256i offsets = _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21);
+			size_t i = 0;
+
+			for (; i + 8 <= count; i += 8) {
+
+				const float *p = points + i * 3;
+				__m256 x = _mm256_i32gather_ps(p, offsets, 4);
+				__m256 y = _mm256_i32gather_ps(p + 1, offsets, 4);
+				__m256 z = _mm256_i32gather_ps(p + 2, offsets, 4);
+
+				float result[3][8];
+
+				for (int j = 0; j < 3; j++) {
+
+					__m256 r = _mm256_fmadd_ps(_mm256_set1_ps(m[j]), x, _mm256_set1_ps(m[12 + j]));
+					r = _mm256_fmadd_ps(_mm256_set1_ps(m[4 + j]), y, r);
+					r = _mm256_fmadd_ps(_mm256_set1_ps(m[8 + j]), z, r);
+					_mm256_storeu_ps(result[j], r);
+
+				}
+
+				float *o = out + i * 3;
+
+				for (int k = 0; k < 8; k++) {
+
+					o[k * 3] = result[0][k];
+					o[k * 3 + 1] = result[1][k];
+					o[k * 3 + 2] = result[2][k];
+
+				}
+
+			}
+
+			_mm256_zeroupper();
+
+			transformPointsSSE(m, points + i * 3, out + i * 3, count - i);
+
+		}
+
+		/**
+		 * @brief Transforms boxes with AVX2.
+		 *
+		 * Transforms eight boxes at once, gathering every coordinate in its own register.
+		 *
+		 * @param m The matrix.
+		 * @param boxes The boxes.
+		 * @param out The transformed boxes.
+		 * @param count The number of boxes.
+		 */
+		ALADDIN_3D_BATCH_AVX2 void transformBoxesAVX2(const float *m, const float *boxes, float *out, size_t count) {
+
+			const __m256i offsets = _mm256_setr_epi32(0, 6, 12, 18, 24, 30, 36, 42);
+			const __m256 half = _mm256_set1_ps(0.5f);
+			size_t i = 0;
+
+			for (; i + 8 <= count; i += 8) {
+
+				const float *b = boxes + i * 6;
+				__m256 centre[3];
+				__m256 extent[3];
+
+				for (int j = 0; j < 3; j++) {
+
+					__m256 min = _mm256_i32gather_ps(b + j, offsets, 4);
+					__m256 max = _mm256_i32gather_ps(b + 3 + j, offsets, 4);
+					centre[j] = _mm256_mul_ps(_mm256_add_ps(min, max), half);
+					extent[j] = _mm256_mul_ps(_mm256_sub_ps(max, min), half);
+
+				}
+
+				float result[6][8];
+
+				for (int j = 0; j < 3; j++) {
+
+					__m256 c = _mm256_fmadd_ps(_mm256_set1_ps(m[j]), centre[0], _mm256_set1_ps(m[12 + j]));
+					c = _mm256_fmadd_ps(_mm256_set1_ps(m[4 + j]), centre[1], c);
+					c = _mm256_fmadd_ps(_mm256_set1_ps(m[8 + j]), centre[2], c);
+
+					__m256 e = _mm256_mul_ps(_mm256_set1_ps(fabsf(m[j])), extent[0]);
+					e = _mm256_fmadd_ps(_mm256_set1_ps(fabsf(m[4 + j])), extent[1], e);
+					e = _mm256_fmadd_ps(_mm256_set1_ps(fabsf(m[8 + j])), extent[2], e);
+
+					_mm256_storeu_ps(result[j], _mm256_sub_ps(c, e));
+					_mm256_storeu_ps(result[3 + j], _mm256_add_ps(c, e));
+
+				}
+
+				float *o = out + i * 6;
+
+				for (int k = 0; k < 8; k++)
+					for (int j = 0; j < 6; j++)
+						o[k * 6 + j] = result[j][k];
+
+			}
+
+			_mm256_zeroupper();
+
+			transformBoxesSSE(m, boxes + i * 6, out + i * 6, count - i);
+
+		}
+
+		/**
+		 * @brief Tests boxes against a frustum with AVX2.
+		 *
+		 * Tests eight boxes at once, gathering every coordinate in its own register.
+		 *
+		 * @param planes The planes.
+		 * @param boxes The boxes.
+		 * @param inside The results.
+		 * @param count The number of boxes.
+		 */
+		ALADDIN_3D_BATCH_AVX2 void cullBoxesAVX2(const glm::vec4 planes[6], const float *boxes, char *inside, size_t count) {
+
+			const __m256i offsets = _mm256_setr_epi32(0, 6, 12, 18, 24, 30, 36, 42);
+			size_t i = 0;
+
+			for (; i + 8 <= count; i += 8) {
+
+				const float *b = boxes + i * 6;
+				__m256 min[3];
+				__m256 max[3];
+
+				for (int j = 0; j < 3; j++) {
+
+					min[j] = _mm256_i32gather_ps(b + j, offsets, 4);
+					max[j] = _mm256_i32gather_ps(b + 3 + j, offsets, 4);
+
+				}
+
+				__m256 outside = _mm256_setzero_ps();
+
+				for (int j = 0; j < 6; j++) {
+
+					__m256 distance = _mm256_fmadd_ps(_mm256_set1_ps(planes[j].x), planes[j].x >= 0.0f ? max[0] : min[0],
+						_mm256_set1_ps(planes[j].w));
+					distance = _mm256_fmadd_ps(_mm256_set1_ps(planes[j].y), planes[j].y >= 0.0f ? max[1] : min[1], distance);
+					distance = _mm256_fmadd_ps(_mm256_set1_ps(planes[j].z), planes[j].z >= 0.0f ? max[2] : min[2], distance);
+					outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, _mm256_setzero_ps(), _CMP_LT_OQ));
+
+				}
+
+				int mask = _mm256_movemask_ps(outside);
+
+				for (int k = 0; k < 8; k++)
+					inside[i + k] = (mask & (1 << k)) ? 0 : 1;
+
+			}
+
+			_mm256_zeroupper();
+
+			cullBoxesSSE(planes, boxes + i * 6, inside + i, count - i);
+
+		}
+
+		/**
+		 * @brief Gets the bounds of vertices with AVX2.
+		 *
+		 * Loads two positions in every register, with two pairs of accumulators to
+		 * overlap the loads.
+		 *
+		 * @param vertices The vertices, as floats.
+		 * @param count The number of vertices, at least one.
+		 * @param out The minimum and the maximum.
+		 */
+		ALADDIN_3D_BATCH_AVX2 void boundVerticesAVX2(const float *vertices, size_t count, float *out) {
+
+			__m256 min0 = loadPairAVX2(vertices, vertices);
+			__m256 max0 = min0;
+			__m256 min1 = min0;
+			__m256 max1 = min0;
+			size_t i = 1;
+
+			for (; i + 4 <= count; i += 4) {
+
+				const float *v = vertices + i * 11;
+				__m256 a = loadPairAVX2(v, v + 11);
+				__m256 b = loadPairAVX2(v + 22, v + 33);
+
+				min0 = _mm256_min_ps(min0, a);
+				max0 = _mm256_max_ps(max0, a);
+				min1 = _mm256_min_ps(min1, b);
+				max1 = _mm256_max_ps(max1, b);
+
+			}
+
+			for (; i < count; i++) {
+
+				const float *v = vertices + i * 11;
+				__m256 a = loadPairAVX2(v, v);
+
+				min0 = _mm256_min_ps(min0, a);
+				max0 = _mm256_max_ps(max0, a);
+
+			}
+
+			// Merge both halves.
+			min0 = _mm256_min_ps(min0, min1);
+			max0 = _mm256_max_ps(max0, max1);
+			__m128 min = _mm_min_ps(_mm256_castps256_ps128(min0), _mm256_extractf128_ps(min0, 1));
+			__m128 max = _mm_max_ps(_mm256_castps256_ps128(max0), _mm256_extractf128_ps(max0, 1));
+
+			_mm256_zeroupper();
+
+			storeVec3SSE(out, min);
+			storeVec3SSE(out + 3, max);
+
+		}
+
+		/**
+		 * @brief Gets the farthest vertex with AVX2.
+		 *
+		 * Measures eight vertices at once, gathering every coordinate in its own register.
+		 *
+		 * @param vertices The vertices, as floats.
+		 * @param count The number of vertices.
+		 * @param centre The point.
+		 *
+		 * @returns The squared distance.
+		 */
+		ALADDIN_3D_BATCH_AVX2 float farthestVertexAVX2(const float *vertices, size_t count, const glm::vec3 &centre) {
+
+			const __m256i offsets = _mm256_setr_epi32(0, 11, 22, 33, 44, 55, 66, 77);
+			__m256 centre_x = _mm256_set1_ps(centre.x);
+			__m256 centre_y = _mm256_set1_ps(centre.y);
+			__m256 centre_z = _mm256_set1_ps(centre.z);
+			__m256 farthest = _mm256_setzero_ps();
+			size_t i = 0;
+
+			for (; i + 8 <= count; i += 8) {
+
+				const float *v = vertices + i * 11;
+				__m256 x = _mm256_sub_ps(_mm256_i32gather_ps(v, offsets, 4), centre_x);
+				__m256 y = _mm256_sub_ps(_mm256_i32gather_ps(v + 1, offsets, 4), centre_y);
+				__m256 z = _mm256_sub_ps(_mm256_i32gather_ps(v + 2, offsets, 4), centre_z);
+				__m256 distance = _mm256_fmadd_ps(z, z, _mm256_fmadd_ps(y, y, _mm256_mul_ps(x, x)));
+
+				farthest = _mm256_max_ps(farthest, distance);
+
+			}
+
+			float lanes[8];
+			_mm256_storeu_ps(lanes, farthest);
+
+			_mm256_zeroupper();
+
+			float result = farthestVertexSSE(vertices + i * 11, count - i, centre);
+
+			for (int k = 0; k < 8; k++)
+				result = lanes[k] > result ? lanes[k] : result;
+
+			return result;
+
+		}
+
+		/**
+		 * @brief Blends vectors with AVX2.
+		 *
+		 * Blends two vectors at once, one in every half of the registers, with a fused
+		 * multiply and add.
+		 *
+		 * @param starts The starts, as floats.
+		 * @param ends The ends, as floats.
+		 * @param factors The factor of every vector.
+		 * @param out The blended vectors, as floats.
+		 * @param count The number of vectors.
+		 */
+		ALADDIN_3D_BATCH_AVX2 void lerpAVX2(const float *starts, const float *ends, const float *factors, float *out, size_t count) {
+
+			size_t i = 0;
+
+			for (; i + 2 <= count; i += 2) {
+
+				__m256 start = _mm256_loadu_ps(starts + i * 4);
+				__m256 end = _mm256_loadu_ps(ends + i * 4);
+				__m256 factor = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(factors[i])), _mm_set1_ps(factors[i + 1]), 1);
+
+				_mm256_storeu_ps(out + i * 4, _mm256_fmadd_ps(_mm256_sub_ps(end, start), factor, start));
+
+			}
+
+			_mm256_zeroupper();
+
+			lerpSSE(starts + i * 4, ends + i * 4, factors + i, out + i * 4, count - i);
+
+		}
+
+#endif
+
+		/**
+		 * @brief Multiplies matrices.
+		 *
+		 * Multiplies matrices with the instruction set in use.
+		 *
+		 * @param a The left matrices.
+		 * @param a_step The distance between the left matrices, 0 to use the same one.
+		 * @param b The right matrices.
+		 * @param out The products.
+		 * @param out_step The distance between the products, in matrices.
+		 * @param count The number of matrices.
+		 */
+		void multiplyMatrices(const glm::mat4 *a, size_t a_step, const glm::mat4 *b, glm::mat4 *out, size_t out_step, size_t count) {
+
+			const float *a_floats = &(*a)[0][0];
+			const float *b_floats = &(*b)[0][0];
+			float *out_floats = &(*out)[0][0];
+
+			switch (instruction_set) {
+
+#ifdef ALADDIN_3D_BATCH_SSE
+
+				case BatchMaths::AVX2:
+					multiplyAVX2(a_floats, a_step * 16, b_floats, out_floats, out_step * 16, count);
+					break;
+
+				case BatchMaths::SSE:
+					multiplySSE(a_floats, a_step * 16, b_floats, out_floats, out_step * 16, count);
+					break;
+
+#endif
+
+				default:
+					multiplyScalar(a_floats, a_step * 16, b_floats, out_floats, out_step * 16, count);
+					break;
+
+			}
+
+		}
+
+	}  // namespace
+
+	void BatchMaths::cullBoxes(const glm::vec4 planes[6], const BoundingBox *boxes, char *inside, size_t count) {
+
+		if (count == 0)
+			return;
+
+		const float *floats = &boxes[0].min.x;
+
+		switch (instruction_set) {
+
+#ifdef ALADDIN_3D_BATCH_SSE
+
+			case AVX2:
+				cullBoxesAVX2(planes, floats, inside, count);
+				break;
+
+			case SSE:
+				cullBoxesSSE(planes, floats, inside, count);
+				break;
+
+#endif
+
+			default:
+				for (size_t i = 0; i < count; i++)
+					inside[i] = cullBoxScalar(planes, floats + i * 6);
+				break;
+
+		}
+
+	}
+
+	BatchMaths::InstructionSets BatchMaths::getBestInstructionSet() {
+
+		return best_instruction_set;
+
+	}
+
+	BoundingBox BatchMaths::getBoundingBox(const Vertex *vertices, size_t count) {
+
+		BoundingBox box = { glm::vec3(0.0f), glm::vec3(0.0f) };
+
+		if (count == 0)
+			return box;
+
+		const float *floats = &vertices[0].position.x;
+		float *out = &box.min.x;
+
+		switch (instruction_set) {
+
+#ifdef ALADDIN_3D_BATCH_SSE
+
+			case AVX2:
+				boundVerticesAVX2(floats, count, out);
+				break;
+
+			case SSE:
+				boundVerticesSSE(floats, count, out);
+				break;
+
+#endif
+
+			default:
+				boundVerticesScalar(floats, count, out);
+				break;
+
+		}
+
+		return box;
+
+	}
+
+	BoundingSphere BatchMaths::getBoundingSphere(const Vertex *vertices, size_t count, const BoundingBox &box) {
+
+		BoundingSphere sphere;
+		sphere.centre = (box.min + box.max) * 0.5f;
+
+		if (count == 0)
+			return sphere;
+
+		const float *floats = &vertices[0].position.x;
+		float farthest;
+
+		switch (instruction_set) {
+
+#ifdef ALADDIN_3D_BATCH_SSE
+
+			case AVX2:
+				farthest = farthestVertexAVX2(floats, count, sphere.centre);
+				break;
+
+			case SSE:
+				farthest = farthestVertexSSE(floats, count, sphere.centre);
+				break;
+
+#endif
+
+			default:
+				farthest = farthestVertexScalar(floats, count, sphere.centre);
+				break;
+
+		}
+
+		sphere.radius = sqrtf(farthest);
+
+		return sphere;
+
+	}
+
+	void BatchMaths::getFrustumPlanes(const glm::mat4 &view_projection, glm::vec4 planes[6]) {
+
+		// A point is inside while -w <= x, y, z <= w in clip space.
+		glm::vec4 row_x(view_projection[0][0], view_projection[1][0], view_projection[2][0], view_projection[3][0]);
+		glm::vec4 row_y(view_projection[0][1], view_projection[1][1], view_projection[2][1], view_projection[3][1]);
+		glm::vec4 row_z(view_projection[0][2], view_projection[1][2], view_projection[2][2], view_projection[3][2]);
+		glm::vec4 row_w(view_projection[0][3], view_projection[1][3], view_projection[2][3], view_projection[3][3]);
+
+		planes[0] = row_w + row_x;
+		planes[1] = row_w - row_x;
+		planes[2] = row_w + row_y;
+		planes[3] = row_w - row_y;
+		planes[4] = row_w + row_z;
+		planes[5] = row_w - row_z;
+
+	}
+
+	BatchMaths::InstructionSets BatchMaths::getInstructionSet() {
+
+		return instruction_set;
+
+	}
+
+	const char *BatchMaths::getInstructionSetName(InstructionSets set) {
+
+		switch (set) {
+
+			case AVX2:
+				return "AVX2";
+
+			case SSE:
+				return "SSE";
+
+			default:
+				return "Scalar";
+
+		}
+
+	}
+
+	void BatchMaths::inverseAffine(const glm::mat4 *matrices, glm::mat4 *out, size_t count) {
+
+		if (count == 0)
+			return;
+
+		const float *floats = &matrices[0][0][0];
+		float *out_floats = &out[0][0][0];
+
+		switch (instruction_set) {
+
+#ifdef ALADDIN_3D_BATCH_SSE
+
+			case AVX2:
+				inverseAffineAVX2(floats, out_floats, count);
+				break;
+
+			case SSE:
+				for (size_t i = 0; i < count; i++)
+					inverseAffineSSE(floats + i * 16, out_floats + i * 16);
+				break;
+
+#endif
+
+			default:
+				for (size_t i = 0; i < count; i++)
+					inverseAffineScalar(floats + i * 16, out_floats + i * 16);
+				break;
+
+		}
+
+	}
+
+	void BatchMaths::lerp(const glm::vec4 *starts, const glm::vec4 *ends, const float *factors, glm::vec4 *out, size_t count) {
+
+		if (count == 0)
+			return;
+
+		switch (instruction_set) {
+
+#ifdef ALADDIN_3D_BATCH_SSE
+
+			case AVX2:
+				lerpAVX2(&starts[0].x, &ends[0].x, factors, &out[0].x, count);
+				break;
+
+			case SSE:
+				lerpSSE(&starts[0].x, &ends[0].x, factors, &out[0].x, count);
+				break;
+
+#endif
+
+			default:
+				for (size_t i = 0; i < count; i++)
+					out[i] = starts[i] + (ends[i] - starts[i]) * factors[i];
+				break;
+
+		}
+
+	}
+
+	void BatchMaths::multiply(const glm::mat4 *a, const glm::mat4 *b, glm::mat4 *out, size_t count) {
+
+		if (count > 0)
+			multiplyMatrices(a, 1, b, out, 1, count);
+
+	}
+
+	void BatchMaths::multiply(const glm::mat4 &a, const glm::mat4 *b, glm::mat4 *out, size_t count, size_t out_stride) {
+
+		if (count > 0)
+			multiplyMatrices(&a, 0, b, out, out_stride, count);
+
+	}
+
+	void BatchMaths::setInstructionSet(InstructionSets set) {
+
+		instruction_set = set <= best_instruction_set ? set : best_instruction_set;
+
+	}
+
+	void BatchMaths::transformBoxes(const glm::mat4 &matrix, const BoundingBox *boxes, BoundingBox *out, size_t count) {
+
+		if (count == 0)
+			return;
+
+		const float *m = &matrix[0][0];
+		const float *floats = &boxes[0].min.x;
+		float *out_floats = &out[0].min.x;
+
+		switch (instruction_set) {
+
+#ifdef ALADDIN_3D_BATCH_SSE
+
+			case AVX2:
+				transformBoxesAVX2(m, floats, out_floats, count);
+				break;
+
+			case SSE:
+				transformBoxesSSE(m, floats, out_floats, count);
+				break;
+
+#endif
+
+			default:
+				for (size_t i = 0; i < count; i++)
+					transformBoxScalar(m, floats + i * 6, out_floats + i * 6);
+				break;
+
+		}
+
+	}
+
+	void BatchMaths::transformPoints(const glm::mat4 &matrix, const glm::vec3 *points, glm::vec3 *out, size_t count) {
+
+		if (count == 0)
+			return;
+
+		const float *m = &matrix[0][0];
+		const float *floats = &points[0].x;
+		float *out_floats = &out[0].x;
+
+		switch (instruction_set) {
+
+#ifdef ALADDIN_3D_BATCH_SSE
+
+			case AVX2:
+				transformPointsAVX2(m, floats, out_floats, count);
+				break;
+
+			case SSE:
+				transformPointsSSE(m, floats, out_floats, count);
+				break;
+
+#endif
+
+			default:
+				for (size_t i = 0; i < count; i++)
+					transformPointScalar(m, floats + i * 3, out_floats + i * 3);
+				break;
+
+		}
+
+	}
+
+}  // namespace aladdin_3d
@@ -0,0 +1,219 @@
+/**
+ * @file BatchMaths.h
+ * @brief BatchMaths class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_BATCHMATHS_H_
+#define ALADDIN_3D_CLASSES_BATCHMATHS_H_
+
+#include <stddef.h>
+
+#include "glm/glm.hpp"
+
+#include "Structs/BoundingBox/BoundingBox.h"
+#include "Structs/BoundingSphere/BoundingSphere.h"
+#include "Structs/Vertex/Vertex.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of a BatchMaths class.
+	 *
+	 * Groups the maths kernels that work on whole arrays at once: multiplying and
+	 * inverting matrices, transforming points and bounding boxes, testing boxes
+	 * against the planes of a frustum, finding the bounds of meshes and blending vectors. Every kernel has a scalar version, an SSE one
+	 * and an AVX2 one, and the best one the CPU supports is picked when the program
+	 * starts. The results of all of them match up to rounding.
+	 *
+	 * The outputs can be the same arrays as the inputs, but they must not overlap
+	 * them in any other way.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class BatchMaths {
+
+		public:
+
+			enum InstructionSets { SCALAR, SSE, AVX2 };
+
+			/**
+			 * @brief Tests boxes against a frustum.
+			 *
+			 * Checks for every box whether any part of it is inside all the planes. The
+			 * test is conservative, so a few boxes near the corners of the frustum pass.
+			 *
+			 * @param planes The planes of the frustum, pointing inwards.
+			 * @param boxes The boxes.
+			 * @param inside Outputs 1 for every box that may be inside, and 0 for the rest.
+			 * @param count The number of boxes.
+			 */
+			static void cullBoxes(const glm::vec4 planes[6], const BoundingBox *boxes, char *inside, size_t count);
+
+			/**
+			 * @brief Gets the best instruction set.
+			 *
+			 * Gets the best instruction set supported by both the build and the CPU.
+			 *
+			 * @returns The instruction set.
+			 */
+			static InstructionSets getBestInstructionSet();
+
+			/**
+			 * @brief Gets the bounding box of some vertices.
+			 *
+			 * Gets the smallest box that contains the positions of the vertices.
+			 *
+			 * @param vertices The vertices.
+			 * @param count The number of vertices.
+			 *
+			 * @returns The bounding box, empty at the origin if there are no vertices.
+			 */
+			static BoundingBox getBoundingBox(const Vertex *vertices, size_t count);
+
+			/**
+			 * @brief Gets the bounding sphere of some vertices.
+			 *
+			 * Gets the smallest sphere centred on the bounding box of the vertices that
+			 * contains their positions.
+			 *
+			 * @param vertices The vertices.
+			 * @param count The number of vertices.
+			 * @param box The bounding box of the vertices.
+			 *
+			 * @returns The bounding sphere.
+			 */
+			static BoundingSphere getBoundingSphere(const Vertex *vertices, size_t count, const BoundingBox &box);
+
+			/**
+			 * @brief Gets the planes of a frustum.
+			 *
+			 * Gets the six planes of the frustum of a view projection matrix, pointing
+			 * inwards and without normalizing.
+			 *
+			 * @param view_projection The view projection matrix.
+			 * @param planes Outputs the left, right, bottom, top, near and far planes.
+			 */
+			static void getFrustumPlanes(const glm::mat4 &view_projection, glm::vec4 planes[6]);
+
+			/**
+			 * @brief Gets the instruction set in use.
+			 *
+			 * Gets the instruction set the kernels are using.
+			 *
+			 * @returns The instruction set.
+			 */
+			static InstructionSets getInstructionSet();
+
+			/**
+			 * @brief Gets the name of an instruction set.
+			 *
+			 * Gets the name of an instruction set.
+			 *
+			 * @param set The instruction set.
+			 *
+			 * @returns The name.
+			 */
+			static const char *getInstructionSetName(InstructionSets set);
+
+			/**
+			 * @brief Inverts affine matrices.
+			 *
+			 * Inverts matrices whose last row is (0, 0, 0, 1), with any rotation, scale
+			 * and shear, much faster than a general inverse. They must be invertible.
+			 *
+			 * @param matrices The matrices.
+			 * @param out Outputs the inverses.
+			 * @param count The number of matrices.
+			 */
+			static void inverseAffine(const glm::mat4 *matrices, glm::mat4 *out, size_t count);
+
+			/**
+			 * @brief Blends vectors.
+			 *
+			 * Blends every start towards the end at the same place, by its own factor.
+			 *
+			 * @param starts The starts.
+			 * @param ends The ends.
+			 * @param factors How far to blend every vector, 0 for the start and 1 for the end.
+			 * @param out Outputs the blended vectors.
+			 * @param count The number of vectors.
+			 */
+			static void lerp(const glm::vec4 *starts, const glm::vec4 *ends, const float *factors, glm::vec4 *out, size_t count);
+
+			/**
+			 * @brief Multiplies pairs of matrices.
+			 *
+			 * Multiplies every matrix of an array by the matrix at the same place of
+			 * another array.
+			 *
+			 * @param a The left matrices.
+			 * @param b The right matrices.
+			 * @param out Outputs the products.
+			 * @param count The number of matrices.
+			 */
+			static void multiply(const glm::mat4 *a, const glm::mat4 *b, glm::mat4 *out, size_t count);
+
+			/**
+			 * @brief Multiplies a matrix by many others.
+			 *
+			 * Multiplies the same matrix by every matrix of an array. The products can be
+			 * spread out, to write them straight into larger structures.
+			 *
+			 * @param a The left matrix.
+			 * @param b The right matrices.
+			 * @param out Outputs the products.
+			 * @param count The number of matrices.
+			 * @param out_stride The distance between the products, in matrices.
+			 */
+			static void multiply(const glm::mat4 &a, const glm::mat4 *b, glm::mat4 *out, size_t count, size_t out_stride = 1);
+
+			/**
+			 * @brief Sets the instruction set.
+			 *
+			 * Makes the kernels use an instruction set, or the best supported one if the
+			 * CPU does not have it. Only meant to compare them, not while they run.
+			 *
+			 * @param set The instruction set.
+			 */
+			static void setInstructionSet(InstructionSets set);
+
+			/**
+			 * @brief Transforms bounding boxes.
+			 *
+			 * Gets the boxes that contain some boxes after an affine transform, moving
+			 * their centres and projecting their half sizes on the axes (Arvo's method).
+			 *
+			 * @param matrix The affine matrix.
+			 * @param boxes The boxes.
+			 * @param out Outputs the transformed boxes.
+			 * @param count The number of boxes.
+			 */
+			static void transformBoxes(const glm::mat4 &matrix, const BoundingBox *boxes, BoundingBox *out, size_t count);
+
+			/**
+			 * @brief Transforms points.
+			 *
+			 * Transforms points by an affine matrix.
+			 *
+			 * @param matrix The affine matrix.
+			 * @param points The points.
+			 * @param out Outputs the transformed points.
+			 * @param count The number of points.
+			 */
+			static void transformPoints(const glm::mat4 &matrix, const glm::vec3 *points, glm::vec3 *out, size_t count);
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_BATCHMATHS_H_
@@ -0,0 +1,1115 @@
+/**
+ * @file Benchmark.cpp
+ * @brief Benchmark class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "glm/glm.hpp"
+#include "glm/gtc/matrix_transform.hpp"
+
+#include "Classes/BatchMaths/BatchMaths.h"
+#include "Classes/Broadphase/Broadphase.h"
+#include "Classes/EntityStore/EntityStore.h"
+#include "Classes/FlowField/FlowField.h"
+#include "Classes/Geometry/Geometry.h"
+#include "Classes/Object/Object.h"
+#include "Classes/SceneGraph/SceneGraph.h"
+#include "Classes/SweptCollision/SweptCollision.h"
+#include "Classes/ThreadPool/ThreadPool.h"
+#include "Classes/TransformBatch/TransformBatch.h"
+#include "Structs/BoundingBox/BoundingBox.h"
+#include "Structs/BoundingSphere/BoundingSphere.h"
+#include "Structs/DrawData/DrawData.h"
+#include "Structs/Vertex/Vertex.h"
+
+namespace aladdin_3d {
+
+	namespace {
+
+		/**
+		 * @brief An entity kept as a single record.
+		 *
+		 * This Struct holds every component of an entity next to the cold data of an
+		 * object, its matrices and its name, as the scene used to keep them.
+		 */
+		struct EntityRecord {
+			std::string name;				/// Name of the object.
+			glm::mat4 model;				/// Model matrix of the object.
+			glm::mat4 normal;				/// Normal matrix of the object.
+			size_t mesh = 0;				/// Mesh of the entity.
+			unsigned int shader = 0;		/// Shader of the entity.
+			unsigned int object_class = 0;	/// Class of the entity.
+			unsigned int flags = 0;			/// Flags of the entity.
+			BoundingBox bounds;				/// World bounds of the entity.
+			glm::vec3 position;				/// World position of the entity.
+			bool visible = true;			/// Whether the entity is visible this frame.
+			GLint draw_index = 0;			/// Draw index of the entity.
+		};
+
+		/**
+		 * @brief Checks if an obstacle is in a range with a linear scan.
+		 *
+		 * Checks if the position of any obstacle of a store is strictly inside a range
+		 * along Z, testing every entity, as the game did before it sorted the obstacles.
+		 *
+		 * @param store The entities.
+		 * @param min_z The start of the range.
+		 * @param max_z The end of the range.
+		 *
+		 * @returns True if there is an obstacle in the range.
+		 */
+		bool scanObstacles(const EntityStore &store, double min_z, double max_z) {
+
+			for (size_t i = 0; i < store.size(); i++) {
+
+				double z = store.getPosition(i).z;
+
+				if ((store.getFlags(i) & EntityStore::obstacle) && z > min_z && z < max_z)
+					return true;
+
+			}
+
+			return false;
+
+		}
+
+	}  // namespace
+
+	void Benchmark::bounds(const std::vector<std::string> &files, size_t reps) {
+
+		BatchMaths::InstructionSets best = BatchMaths::getBestInstructionSet();
+
+		for (size_t f = 0; f < files.size(); f++) {
+
+			Object object(files[f].c_str(), "GLTF");
+			const std::vector<Geometry> &geometries = object.getGeometries();
+
+			size_t vertex_count = 0;
+
+			for (size_t i = 0; i < geometries.size(); i++)
+				vertex_count += geometries[i].getVertices().size();
+
+			std::cout << "Bounds: " << files[f] << ", " << geometries.size() << " geometries, " << vertex_count << " vertices." << std::endl;
+
+			if (vertex_count == 0)
+				continue;
+
+			// Scan the vertices one by one with glm, as the meshes used to.
+			std::vector<BoundingBox> expected(geometries.size());
+
+			auto start = std::chrono::high_resolution_clock::now();
+
+			for (size_t rep = 0; rep < reps; rep++) {
+
+				for (size_t i = 0; i < geometries.size(); i++) {
+
+					const std::vector<Vertex> &vertices = geometries[i].getVertices();
+					BoundingBox bb = { vertices[0].position, vertices[0].position };
+
+					for (size_t j = 1; j < vertices.size(); j++) {
+
+						bb.min = glm::min(bb.min, vertices[j].position);
+						bb.max = glm::max(bb.max, vertices[j].position);
+
+					}
+
+					expected[i] = bb;
+
+				}
+
+			}
+
+			auto end = std::chrono::high_resolution_clock::now();
+
+			double glm_time = std::chrono::duration<double, std::nano>(end - start).count() / (reps * vertex_count);
+			std::cout << "  glm scan:         " << glm_time << " ns/vertex." << std::endl;
+
+			// Then with every instruction set, the box and the sphere.
+			for (int set = BatchMaths::SCALAR; set <= best; set++) {
+
+				BatchMaths::setInstructionSet((BatchMaths::InstructionSets)set);
+
+				std::vector<BoundingBox> boxes(geometries.size());
+				float radius = 0.0f;
+
+				auto box_start = std::chrono::high_resolution_clock::now();
+
+				for (size_t rep = 0; rep < reps; rep++) {
+
+					for (size_t i = 0; i < geometries.size(); i++)
+						boxes[i] = BatchMaths::getBoundingBox(geometries[i].getVertices().data(), geometries[i].getVertices().size());
+
+				}
+
+				auto box_end = std::chrono::high_resolution_clock::now();
+
+				for (size_t rep = 0; rep < reps; rep++) {
+
+					for (size_t i = 0; i < geometries.size(); i++) {
+
+						BoundingSphere sphere = BatchMaths::getBoundingSphere(geometries[i].getVertices().data(), geometries[i].getVertices().size(), boxes[i]);
+						radius = std::max(radius, sphere.radius);
+
+					}
+
+				}
+
+				auto sphere_end = std::chrono::high_resolution_clock::now();
+
+				bool same = true;
+
+				for (size_t i = 0; i < geometries.size(); i++)
+					same = same && boxes[i].min == expected[i].min && boxes[i].max == expected[i].max;
+
+				double box_time = std::chrono::duration<double, std::nano>(box_end - box_start).count() / (reps * vertex_count);
+				double sphere_time = std::chrono::duration<double, std::nano>(sphere_end - box_end).count() / (reps * vertex_count);
+
+				std::string name = BatchMaths::getInstructionSetName((BatchMaths::InstructionSets)set);
+				name += " scan:";
+				name.resize(18, ' ');
+
+				std::cout << "  " << name << box_time << " ns/vertex (" << glm_time / box_time << "x), sphere " << sphere_time;
+				std::cout << " ns/vertex, same box: " << (same ? "yes" : "no") << ", largest radius " << radius << "." << std::endl;
+
+			}
+
+			BatchMaths::setInstructionSet(best);
+
+			// Transform the boxes of the geometries through their corners and through their centres.
+			std::mt19937 generator(42);
+			std::uniform_real_distribution<float> angle(0.0f, 360.0f);
+			glm::mat4 transforms = glm::rotate(glm::mat4(1.0f), glm::radians(angle(generator)), glm::vec3(0.0f, 1.0f, 0.0f));
+			transforms = glm::scale(glm::translate(transforms, glm::vec3(3.0f, 0.0f, -5.0f)), glm::vec3(2.0f, 1.0f, 0.5f));
+
+			std::vector<BoundingBox> corners_bb(geometries.size());
+			std::vector<BoundingBox> centres_bb(geometries.size());
+
+			auto corners_start = std::chrono::high_resolution_clock::now();
+
+			for (size_t rep = 0; rep < reps; rep++) {
+
+				for (size_t i = 0; i < geometries.size(); i++) {
+
+					BoundingBox bb = { glm::vec3(1e30f), glm::vec3(-1e30f) };
+
+					for (int corner = 0; corner < 8; corner++) {
+
+						glm::vec3 point((corner & 1) ? expected[i].max.x : expected[i].min.x,
+							(corner & 2) ? expected[i].max.y : expected[i].min.y,
+							(corner & 4) ? expected[i].max.z : expected[i].min.z);
+						point = glm::vec3(transforms * glm::vec4(point, 1.0f));
+
+						bb.min = glm::min(bb.min, point);
+						bb.max = glm::max(bb.max, point);
+
+					}
+
+					corners_bb[i] = bb;
+
+				}
+
+			}
+
+			auto corners_end = std::chrono::high_resolution_clock::now();
+
+			for (size_t rep = 0; rep < reps; rep++)
+				for (size_t i = 0; i < geometries.size(); i++)
+					centres_bb[i] = Geometry::transformBoundingBox(transforms, expected[i]);
+
+			auto centres_end = std::chrono::high_resolution_clock::now();
+
+			float max_error = 0.0f;
+
+			for (size_t i = 0; i < geometries.size(); i++)
+				max_error = std::max(max_error, glm::length(corners_bb[i].min - centres_bb[i].min) + glm::length(corners_bb[i].max - centres_bb[i].max));
+
+			double corners_time = std::chrono::duration<double, std::nano>(corners_end - corners_start).count() / (reps * geometries.size());
+			double centres_time = std::chrono::duration<double, std::nano>(centres_end - corners_end).count() / (reps * geometries.size());
+
+			std::cout << "  Eight corners:    " << corners_time << " ns/box." << std::endl;
+			std::cout << "  Centre and size:  " << centres_time << " ns/box, max error " << max_error << "." << std::endl;
+
+			// Query the bounds of the object, and after moving it every time. It does not
+			// really move, so both must give the same box.
+			BoundingBox kept_bb;
+			BoundingBox moved_bb;
+
+			auto query_start = std::chrono::high_resolution_clock::now();
+
+			for (size_t rep = 0; rep < reps; rep++)
+				kept_bb = object.getWorldBoundingBox();
+
+			auto query_end = std::chrono::high_resolution_clock::now();
+
+			for (size_t rep = 0; rep < reps; rep++) {
+
+				object.translate(0.0f, 0.0f, 0.0f);
+				moved_bb = object.getWorldBoundingBox();
+
+			}
+
+			auto moved_end = std::chrono::high_resolution_clock::now();
+
+			double query_time = std::chrono::duration<double, std::nano>(query_end - query_start).count() / reps;
+			double moved_time = std::chrono::duration<double, std::nano>(moved_end - query_end).count() / reps;
+
+			std::cout << "  Kept bounds:      " << query_time << " ns/query." << std::endl;
+			std::cout << "  After a move:     " << moved_time << " ns/query, same box: ";
+			std::cout << (kept_bb.min == moved_bb.min && kept_bb.max == moved_bb.max ? "yes" : "no") << "." << std::endl;
+
+		}
+
+	}
+
+	void Benchmark::broadphase(size_t count, size_t frames) {
+
+		// Boxes and runners spread along a corridor of a metre per proxy.
+		std::mt19937 generator(42);
+		std::uniform_real_distribution<float> side(-1.5f, 1.5f);
+		std::uniform_real_distribution<float> depth(0.0f, (float)count);
+		std::uniform_real_distribution<float> speed(4.0f, 6.0f);
+
+		Broadphase broadphase;
+		broadphase.reserve(count);
+		std::vector<BoundingBox> bounds(count);
+		std::vector<float> speeds(count, 0.0f);
+
+		for (size_t i = 0; i < count; i++) {
+
+			glm::vec3 position(side(generator), 0.0f, depth(generator));
+
+			if (i % 2 == 0) {
+
+				bounds[i] = { position - glm::vec3(0.5f, 0.0f, 0.5f), position + glm::vec3(0.5f, 1.0f, 0.5f) };
+				broadphase.add(bounds[i], Broadphase::obstacle, Broadphase::guard);
+
+			} else {
+
+				bounds[i] = { position - glm::vec3(0.3f, 0.0f, 0.3f), position + glm::vec3(0.3f, 1.8f, 0.3f) };
+				speeds[i] = speed(generator);
+				broadphase.add(bounds[i], Broadphase::guard, Broadphase::obstacle | Broadphase::guard);
+
+			}
+
+		}
+
+		// The first update sorts everything, it is not part of the steady cost.
+		broadphase.update();
+
+		const float step = 1.0f / 60.0f;
+		size_t swaps = 0;
+		size_t events = 0;
+
+		auto start = std::chrono::high_resolution_clock::now();
+
+		for (size_t frame = 0; frame < frames; frame++) {
+
+			for (size_t i = 1; i < count; i += 2) {
+
+				bounds[i].min.z += speeds[i] * step;
+				bounds[i].max.z += speeds[i] * step;
+				broadphase.move(i, bounds[i]);
+
+			}
+
+			broadphase.update();
+			swaps += broadphase.getSwaps();
+			events += broadphase.getEvents().size();
+
+		}
+
+		auto end = std::chrono::high_resolution_clock::now();
+
+		// Test every pair of the last frame, but only where it does not take forever.
+		std::string same = "skipped";
+
+		if (count <= 10000) {
+
+			std::vector<std::pair<size_t, size_t>> pairs;
+
+			for (size_t i = 0; i < count; i++) {
+
+				for (size_t j = i + 1; j < count; j++) {
+
+					if (i % 2 == 0 && j % 2 == 0)
+						continue;
+
+					if (bounds[i].min.x < bounds[j].max.x && bounds[j].min.x < bounds[i].max.x &&
+						bounds[i].min.y < bounds[j].max.y && bounds[j].min.y < bounds[i].max.y &&
+						bounds[i].min.z < bounds[j].max.z && bounds[j].min.z < bounds[i].max.z)
+						pairs.push_back(std::make_pair(i, j));
+
+				}
+
+			}
+
+			same = pairs == broadphase.getContacts() ? "yes" : "no";
+
+		}
+
+		// Print the results.
+		double frame_time = std::chrono::duration<double, std::micro>(end - start).count() / frames;
+
+		std::cout << "Broadphase: " << count << " proxies, " << frames << " frames." << std::endl;
+		std::cout << "  Update:           " << frame_time << " us/frame, " << frame_time * 1000.0 / count << " ns/proxy." << std::endl;
+		std::cout << "  Swaps:            " << (double)swaps / frames << " per frame." << std::endl;
+		std::cout << "  Contacts:         " << broadphase.getContacts().size() << ", " << (double)events / frames << " events per frame." << std::endl;
+		std::cout << "  Same pairs:       " << same << "." << std::endl;
+
+	}
+
+	bool Benchmark::collisions(float length) {
+
+		const float velocity = 5.0f;
+		const float jump_velocity = 4.0f;
+		const float gravity = -10.0f;
+		const float clearance = 0.5f;
+		const double cooldown = 1.0;
+
+		// The boxes of the game, closer and closer towards the door.
+		std::vector<BoundingBox> boxes;
+		float box_dist = 1.0f;
+
+		for (float z = length - 3.0f; z >= 5.0f; z -= box_dist, box_dist += 0.2f)
+			boxes.push_back({ glm::vec3(-0.5f, 0.0f, z - 0.5f), glm::vec3(0.5f, 1.0f, z + 0.5f) });
+
+		BoundingBox character = { glm::vec3(-0.3f, 0.0f, -0.3f), glm::vec3(0.3f, 1.8f, 0.3f) };
+		SweptCollision swept(velocity, jump_velocity, gravity, clearance, cooldown);
+
+		// Try to jump two times out of three, every 0.6 seconds, which is a whole number
+		// of ticks at every rate. The slowest rates take whole boxes in a single tick.
+		const size_t rates[] = { 5, 10, 30, 60, 120, 240 };
+		std::vector<double> first_hits;
+		bool same = true;
+
+		std::cout << "Collisions: " << length << " m corridor, " << boxes.size() << " boxes." << std::endl;
+
+		for (size_t rate : rates) {
+
+			Broadphase broadphase;
+
+			for (size_t i = 0; i < boxes.size(); i++)
+				broadphase.add(boxes[i], Broadphase::obstacle, Broadphase::character);
+
+			size_t proxy = broadphase.add(character, Broadphase::character, Broadphase::obstacle);
+
+			size_t jump_ticks = 18 * rate / 30;
+			size_t ticks = (size_t)(length / velocity * rate);
+			double jump_start = -1.0;
+			double swept_hit = -10.0;
+			std::vector<double> hits;
+
+			for (size_t tick = 1; tick <= ticks; tick++) {
+
+				double start = (double)(tick - 1) / rate;
+				double end = (double)tick / rate;
+
+				if ((tick - 1) % jump_ticks == 0 && ((tick - 1) / jump_ticks) % 3 != 0 && jump_start < 0.0)
+					jump_start = start;
+
+				double jump_time = end - jump_start;
+				double char_y = jump_velocity * jump_time + 0.5 * gravity * jump_time * jump_time;
+
+				// Follow the whole tick.
+				broadphase.move(proxy, swept.getSweptBounds(character, start, end));
+				broadphase.update();
+
+				double time = 0.0;
+
+				while (swept.findHit(broadphase, proxy, start, end, jump_start, swept_hit, &time)) {
+
+					hits.push_back(time);
+					swept_hit = time;
+
+				}
+
+				if (jump_start >= 0.0 && char_y <= 0.0)
+					jump_start = -1.0;
+
+			}
+
+			// Every rate has to hit the same boxes at the same moments.
+			if (first_hits.empty())
+				first_hits = hits;
+
+			double error = 0.0;
+
+			if (hits.size() != first_hits.size())
+				same = false;
+			else
+				for (size_t i = 0; i < hits.size(); i++)
+					error = std::max(error, std::abs(hits[i] - first_hits[i]));
+
+			if (error > 1e-6)
+				same = false;
+
+			std::cout << "  " << rate << " Hz: " << hits.size() << " swept hits, ";
+			std::cout << error * 1000.0 << " ms from " << rates[0] << " Hz." << std::endl;
+
+		}
+
+		std::cout << "  Same hits:        " << (same ? "yes" : "no") << "." << std::endl;
+
+		return same;
+
+	}
+
+	void Benchmark::entities(size_t count, size_t frames) {
+
+		// Scatter the entities along a corridor, like the game does.
+		std::mt19937 generator(42);
+		std::uniform_real_distribution<float> side(-10.0f, 10.0f);
+		std::uniform_real_distribution<float> depth(0.0f, (float)count);
+		std::uniform_real_distribution<float> size(0.5f, 4.0f);
+		std::uniform_int_distribution<unsigned int> object_class(0, 3);
+
+		EntityStore store;
+		std::vector<EntityRecord> records(count);
+		store.reserve(count);
+
+		for (size_t i = 0; i < count; i++) {
+
+			EntityRecord &record = records[i];
+			record.name = "Entity";
+			record.position = glm::vec3(side(generator), 0.0f, depth(generator));
+			record.bounds.min = record.position - size(generator) / 2.0f;
+			record.bounds.max = record.position + size(generator) / 2.0f;
+			record.model = glm::translate(glm::mat4(1.0f), record.position);
+			record.normal = glm::mat4(1.0f);
+			record.mesh = i;
+			record.object_class = object_class(generator);
+			record.flags = EntityStore::in_world | (record.object_class == 1 ? EntityStore::obstacle : 0);
+
+			store.add(record.mesh, record.shader, record.object_class, record.flags, record.bounds, record.position, i);
+			store.addTransform(record.model, record.normal);
+
+		}
+
+		std::vector<std::pair<float, size_t>> store_order;
+		std::vector<std::pair<float, size_t>> record_order;
+		store_order.reserve(count);
+		record_order.reserve(count);
+		size_t store_hits = 0;
+		size_t record_hits = 0;
+
+		TransformBatch batch;
+		batch.reserve(count);
+
+		// Time the passes over the component arrays.
+		auto start = std::chrono::high_resolution_clock::now();
+
+		for (size_t frame = 0; frame < frames; frame++) {
+
+			glm::vec3 camera((float)(frame % 3), 2.0f, (float)(frame * count / frames));
+
+			store.updateVisibility(nullptr);
+			store.sort(camera, true, &store_order);
+
+			batch.clear();
+			store.stage(batch);
+
+			if (scanObstacles(store, camera.z - 0.5, camera.z + 0.5))
+				store_hits++;
+
+		}
+
+		auto middle = std::chrono::high_resolution_clock::now();
+
+		// Time the same passes over the records.
+		for (size_t frame = 0; frame < frames; frame++) {
+
+			glm::vec3 camera((float)(frame % 3), 2.0f, (float)(frame * count / frames));
+
+			for (size_t i = 0; i < count; i++)
+				records[i].visible = true;
+
+			batch.clear();
+
+			for (size_t i = 0; i < count; i++) {
+
+				if (records[i].visible)
+					batch.add(&records[i].model, &records[i].normal, &records[i].draw_index);
+
+			}
+
+			record_order.clear();
+
+			for (size_t i = 0; i < count; i++) {
+
+				if (!records[i].visible)
+					continue;
+
+				glm::vec3 offset = glm::clamp(camera, records[i].bounds.min, records[i].bounds.max) - camera;
+				record_order.push_back(std::make_pair(glm::dot(offset, offset), i));
+
+			}
+
+			std::sort(record_order.begin(), record_order.end(), [&records](const std::pair<float, size_t> &a, const std::pair<float, size_t> &b) {
+
+				if (records[a.second].object_class != records[b.second].object_class)
+					return records[a.second].object_class < records[b.second].object_class;
+
+				return a < b;
+
+			});
+
+			for (size_t i = 0; i < count; i++) {
+
+				if ((records[i].flags & EntityStore::obstacle) && records[i].position.z > camera.z - 0.5 && records[i].position.z < camera.z + 0.5) {
+
+					record_hits++;
+					break;
+
+				}
+
+			}
+
+		}
+
+		auto end = std::chrono::high_resolution_clock::now();
+
+		// Both layouts must give the same order and collisions.
+		bool same = store_hits == record_hits && store_order == record_order;
+
+		// Print the results.
+		double store_time = std::chrono::duration<double, std::micro>(middle - start).count() / frames;
+		double record_time = std::chrono::duration<double, std::micro>(end - middle).count() / frames;
+
+		std::cout << "Entity systems: " << count << " entities, " << frames << " frames." << std::endl;
+		std::cout << "  Records:          " << record_time << " us/frame, " << sizeof(EntityRecord) << " bytes/entity." << std::endl;
+		std::cout << "  Component arrays: " << store_time << " us/frame, " << store.getCPUBytes() / count << " bytes/entity." << std::endl;
+		std::cout << "  Speed-up:         " << record_time / store_time << "x." << std::endl;
+		std::cout << "  Same results:     " << (same ? "yes" : "no") << "." << std::endl;
+
+	}
+
+	void Benchmark::flowField(float length, size_t ticks) {
+
+		// A corridor like the one of the game, with a box every few metres.
+		std::mt19937 generator(42);
+		std::uniform_real_distribution<float> gap(2.0f, 6.0f);
+		std::uniform_real_distribution<float> side(-1.5f, 1.5f);
+
+		glm::vec2 min(-2.0f, 0.0f);
+		glm::vec2 max(2.0f, length);
+		FlowField serial_field(min, max, 0.5f, 32.0f);
+		FlowField parallel_field(min, max, 0.5f, 32.0f);
+
+		for (float z = 5.0f; z < length - 3.0f; z += gap(generator)) {
+
+			float x = side(generator);
+			BoundingBox box = { glm::vec3(x - 0.5f, 0.0f, z - 0.5f), glm::vec3(x + 0.5f, 1.0f, z + 0.5f) };
+			serial_field.addObstacle(box, 0.3f);
+			parallel_field.addObstacle(box, 0.3f);
+
+		}
+
+		// A pool without workers runs everything on this thread.
+		ThreadPool serial;
+		ThreadPool parallel;
+		unsigned int cores = std::thread::hardware_concurrency();
+		parallel.start(cores > 1 ? cores - 1 : 0);
+
+		const int builds = 5;
+		auto start = std::chrono::high_resolution_clock::now();
+
+		for (int i = 0; i < builds; i++)
+			serial_field.build(serial);
+
+		auto middle = std::chrono::high_resolution_clock::now();
+
+		for (int i = 0; i < builds; i++)
+			parallel_field.build(parallel);
+
+		auto end = std::chrono::high_resolution_clock::now();
+
+		// Stopping the pool drops its workers, so count them first.
+		size_t threads = parallel.getWorkerCount() + 1;
+		parallel.stop();
+
+		// Both builds must lead the same way from the centre of every cell.
+		bool same = true;
+
+		for (float z = 0.25f; z < length; z += 0.5f) {
+
+			for (float x = -1.75f; x < 2.0f; x += 0.5f) {
+
+				glm::vec3 position(x, 0.0f, z);
+
+				if (serial_field.getDirection(position) != parallel_field.getDirection(position))
+					same = false;
+
+			}
+
+		}
+
+		double serial_time = std::chrono::duration<double, std::milli>(middle - start).count() / builds;
+		double parallel_time = std::chrono::duration<double, std::milli>(end - middle).count() / builds;
+
+		std::cout << "Flow field: " << length << " m corridor, " << parallel_field.getCellCount() << " cells in ";
+		std::cout << parallel_field.getSegmentCount() << " segments." << std::endl;
+		std::cout << "  Build, 1 thread:   " << serial_time << " ms." << std::endl;
+		std::cout << "  Build, " << threads << " threads:  " << parallel_time << " ms." << std::endl;
+		std::cout << "  Speed-up:          " << serial_time / parallel_time << "x." << std::endl;
+		std::cout << "  Same field:        " << (same ? "yes" : "no") << "." << std::endl;
+
+		// Move the agents along the field, one lookup per agent and tick.
+		const size_t agent_counts[] = { 100, 1000, 10000 };
+		const float step = 6.0f / 120.0f;
+		std::uniform_real_distribution<float> depth(0.0f, length);
+
+		for (size_t count : agent_counts) {
+
+			std::vector<glm::vec3> agents(count);
+
+			for (size_t i = 0; i < count; i++)
+				agents[i] = glm::vec3(side(generator), 0.0f, depth(generator));
+
+			auto agents_start = std::chrono::high_resolution_clock::now();
+
+			for (size_t tick = 0; tick < ticks; tick++) {
+
+				for (size_t i = 0; i < count; i++) {
+
+					glm::vec2 direction = parallel_field.getDirection(agents[i]);
+					agents[i] += glm::vec3(direction.x, 0.0f, direction.y) * step;
+
+				}
+
+			}
+
+			auto agents_end = std::chrono::high_resolution_clock::now();
+			double tick_time = std::chrono::duration<double, std::micro>(agents_end - agents_start).count() / ticks;
+
+			// Use the result, so that the loop is not optimised away.
+			float sum = 0.0f;
+			for (size_t i = 0; i < count; i++)
+				sum += agents[i].z;
+
+			std::cout << "  " << count << " agents: " << tick_time << " us/tick, " << tick_time * 1000.0 / count << " ns/agent";
+			std::cout << (sum > 0.0f ? "." : "!") << std::endl;
+
+		}
+
+	}
+
+	void Benchmark::maths(size_t count, size_t reps) {
+
+		// Build transforms, points and boxes similar to the game.
+		std::mt19937 generator(42);
+		std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+		std::uniform_real_distribution<float> angle(0.0f, 360.0f);
+		std::uniform_real_distribution<float> size(0.5f, 4.0f);
+
+		std::vector<glm::mat4> models(count);
+		std::vector<glm::vec3> points(count);
+		std::vector<BoundingBox> boxes(count);
+
+		for (size_t i = 0; i < count; i++) {
+
+			models[i] = glm::translate(glm::mat4(1.0f), glm::vec3(position(generator), 0.0f, position(generator)));
+			models[i] = glm::rotate(models[i], glm::radians(angle(generator)), glm::vec3(0.0f, 1.0f, 0.0f));
+			models[i] = glm::scale(models[i], glm::vec3(size(generator), size(generator), size(generator)));
+
+			points[i] = glm::vec3(position(generator), position(generator), position(generator));
+			boxes[i].min = points[i] - size(generator);
+			boxes[i].max = points[i] + size(generator);
+
+		}
+
+		glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 5.0f, 10.0f), glm::vec3(0.0f, 0.0f, -10.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+		glm::mat4 view_projection = glm::perspective(glm::radians(45.0f), 1.25f, 0.1f, 100.0f) * view;
+		glm::mat4 model = models[0];
+
+		glm::vec4 planes[6];
+		BatchMaths::getFrustumPlanes(view_projection, planes);
+
+		// The glm results, one item at a time.
+		std::vector<glm::mat4> expected_products(count);
+		std::vector<glm::mat4> expected_inverses(count);
+		std::vector<glm::vec3> expected_points(count);
+		std::vector<BoundingBox> expected_boxes(count);
+		std::vector<char> expected_inside(count);
+		double glm_times[5];
+
+		auto start = std::chrono::high_resolution_clock::now();
+
+		for (size_t rep = 0; rep < reps; rep++)
+			for (size_t i = 0; i < count; i++)
+				expected_products[i] = view * models[i];
+
+		auto products_end = std::chrono::high_resolution_clock::now();
+
+		for (size_t rep = 0; rep < reps; rep++)
+			for (size_t i = 0; i < count; i++)
+				expected_inverses[i] = glm::inverse(models[i]);
+
+		auto inverses_end = std::chrono::high_resolution_clock::now();
+
+		for (size_t rep = 0; rep < reps; rep++)
+			for (size_t i = 0; i < count; i++)
+				expected_points[i] = glm::vec3(model * glm::vec4(points[i], 1.0f));
+
+		auto points_end = std::chrono::high_resolution_clock::now();
+
+		// Boxes go through their eight corners, like the geometries do.
+		for (size_t rep = 0; rep < reps; rep++) {
+
+			for (size_t i = 0; i < count; i++) {
+
+				BoundingBox result = { glm::vec3(1e30f), glm::vec3(-1e30f) };
+
+				for (int corner = 0; corner < 8; corner++) {
+
+					glm::vec3 point((corner & 1) ? boxes[i].max.x : boxes[i].min.x,
+						(corner & 2) ? boxes[i].max.y : boxes[i].min.y,
+						(corner & 4) ? boxes[i].max.z : boxes[i].min.z);
+					point = glm::vec3(model * glm::vec4(point, 1.0f));
+
+					result.min = glm::min(result.min, point);
+					result.max = glm::max(result.max, point);
+
+				}
+
+				expected_boxes[i] = result;
+
+			}
+
+		}
+
+		auto boxes_end = std::chrono::high_resolution_clock::now();
+
+		// And the frustum test projects the eight corners, like the occlusion culler does.
+		for (size_t rep = 0; rep < reps; rep++) {
+
+			for (size_t i = 0; i < count; i++) {
+
+				bool out[6] = {true, true, true, true, true, true};
+
+				for (int corner = 0; corner < 8; corner++) {
+
+					glm::vec4 point = view_projection * glm::vec4((corner & 1) ? boxes[i].max.x : boxes[i].min.x,
+						(corner & 2) ? boxes[i].max.y : boxes[i].min.y, (corner & 4) ? boxes[i].max.z : boxes[i].min.z, 1.0f);
+
+					out[0] = out[0] && point.x < -point.w;
+					out[1] = out[1] && point.x > point.w;
+					out[2] = out[2] && point.y < -point.w;
+					out[3] = out[3] && point.y > point.w;
+					out[4] = out[4] && point.z < -point.w;
+					out[5] = out[5] && point.z > point.w;
+
+				}
+
+				expected_inside[i] = !(out[0] || out[1] || out[2] || out[3] || out[4] || out[5]);
+
+			}
+
+		}
+
+		auto cull_end = std::chrono::high_resolution_clock::now();
+
+		glm_times[0] = std::chrono::duration<double, std::nano>(products_end - start).count() / (reps * count);
+		glm_times[1] = std::chrono::duration<double, std::nano>(inverses_end - products_end).count() / (reps * count);
+		glm_times[2] = std::chrono::duration<double, std::nano>(points_end - inverses_end).count() / (reps * count);
+		glm_times[3] = std::chrono::duration<double, std::nano>(boxes_end - points_end).count() / (reps * count);
+		glm_times[4] = std::chrono::duration<double, std::nano>(cull_end - boxes_end).count() / (reps * count);
+
+		BatchMaths::InstructionSets best = BatchMaths::getBestInstructionSet();
+
+		std::cout << "Batch maths: " << count << " items, " << reps << " reps, best set " << BatchMaths::getInstructionSetName(best) << "." << std::endl;
+		std::cout << "  glm:              " << glm_times[0] << " / " << glm_times[1] << " / " << glm_times[2] << " / " << glm_times[3] << " / ";
+		std::cout << glm_times[4] << " ns/item (multiply / inverse / points / boxes / cull)." << std::endl;
+
+		// Run the kernels with every instruction set up to the best one.
+		std::vector<glm::mat4> products(count);
+		std::vector<glm::mat4> inverses(count);
+		std::vector<glm::vec3> transformed_points(count);
+		std::vector<BoundingBox> transformed_boxes(count);
+		std::vector<char> inside(count);
+
+		for (int set = BatchMaths::SCALAR; set <= best; set++) {
+
+			BatchMaths::setInstructionSet((BatchMaths::InstructionSets)set);
+
+			auto set_start = std::chrono::high_resolution_clock::now();
+
+			for (size_t rep = 0; rep < reps; rep++)
+				BatchMaths::multiply(view, models.data(), products.data(), count);
+
+			auto set_products_end = std::chrono::high_resolution_clock::now();
+
+			for (size_t rep = 0; rep < reps; rep++)
+				BatchMaths::inverseAffine(models.data(), inverses.data(), count);
+
+			auto set_inverses_end = std::chrono::high_resolution_clock::now();
+
+			for (size_t rep = 0; rep < reps; rep++)
+				BatchMaths::transformPoints(model, points.data(), transformed_points.data(), count);
+
+			auto set_points_end = std::chrono::high_resolution_clock::now();
+
+			for (size_t rep = 0; rep < reps; rep++)
+				BatchMaths::transformBoxes(model, boxes.data(), transformed_boxes.data(), count);
+
+			auto set_boxes_end = std::chrono::high_resolution_clock::now();
+
+			for (size_t rep = 0; rep < reps; rep++)
+				BatchMaths::cullBoxes(planes, boxes.data(), inside.data(), count);
+
+			auto set_cull_end = std::chrono::high_resolution_clock::now();
+
+			// Compare with glm, relative to the size of the values.
+			float max_error = 0.0f;
+			size_t mismatches = 0;
+
+			for (size_t i = 0; i < count; i++) {
+
+				for (int column = 0; column < 4; column++) {
+
+					max_error = glm::max(max_error, glm::length(products[i][column] - expected_products[i][column]) /
+						glm::max(1.0f, glm::length(expected_products[i][column])));
+					max_error = glm::max(max_error, glm::length(inverses[i][column] - expected_inverses[i][column]) /
+						glm::max(1.0f, glm::length(expected_inverses[i][column])));
+
+				}
+
+				max_error = glm::max(max_error, glm::length(transformed_points[i] - expected_points[i]) / glm::max(1.0f, glm::length(expected_points[i])));
+				max_error = glm::max(max_error, glm::length(transformed_boxes[i].min - expected_boxes[i].min) / glm::max(1.0f, glm::length(expected_boxes[i].min)));
+				max_error = glm::max(max_error, glm::length(transformed_boxes[i].max - expected_boxes[i].max) / glm::max(1.0f, glm::length(expected_boxes[i].max)));
+
+				if (inside[i] != expected_inside[i])
+					mismatches++;
+
+			}
+
+			double times[5];
+			times[0] = std::chrono::duration<double, std::nano>(set_products_end - set_start).count() / (reps * count);
+			times[1] = std::chrono::duration<double, std::nano>(set_inverses_end - set_products_end).count() / (reps * count);
+			times[2] = std::chrono::duration<double, std::nano>(set_points_end - set_inverses_end).count() / (reps * count);
+			times[3] = std::chrono::duration<double, std::nano>(set_boxes_end - set_points_end).count() / (reps * count);
+			times[4] = std::chrono::duration<double, std::nano>(set_cull_end - set_boxes_end).count() / (reps * count);
+
+			std::string name = BatchMaths::getInstructionSetName((BatchMaths::InstructionSets)set);
+			name += ":";
+			name.resize(18, ' ');
+
+			std::cout << "  " << name << times[0] << " / " << times[1] << " / " << times[2] << " / " << times[3] << " / " << times[4] << " ns/item, ";
+			std::cout << "max error " << max_error << ", " << mismatches << " cull mismatches." << std::endl;
+
+		}
+
+		BatchMaths::setInstructionSet(best);
+
+	}
+
+	void Benchmark::sceneGraph(size_t count, size_t frames) {
+
+		// Place geometries like the game does: translated, rotated and scaled.
+		std::mt19937 generator(42);
+		std::uniform_real_distribution<float> position(-1.0f, 1.0f);
+		std::uniform_real_distribution<float> angle(0.0f, 360.0f);
+
+		std::vector<glm::vec3> offsets(count);
+		std::vector<glm::vec3> axes(count);
+		std::vector<float> angles(count);
+
+		for (size_t i = 0; i < count; i++) {
+
+			offsets[i] = glm::vec3(position(generator), position(generator), position(generator));
+			axes[i] = glm::vec3(position(generator), 1.0f, position(generator));
+			angles[i] = angle(generator);
+
+		}
+
+		// The geometries have no mesh, only their transforms are used.
+		std::vector<glm::mat4> matrices(count, glm::mat4(1.0f));
+		std::vector<Geometry> geometries(count, Geometry(std::shared_ptr<MeshAsset>()));
+
+		// Multiply a whole matrix for every move, as the geometries used to.
+		auto start = std::chrono::high_resolution_clock::now();
+
+		for (size_t frame = 0; frame < frames; frame++) {
+
+			for (size_t i = 0; i < count; i++) {
+
+				matrices[i] = glm::mat4(1.0f);
+				matrices[i] *= glm::translate(glm::mat4(1.0f), offsets[i]);
+				matrices[i] *= glm::rotate(glm::mat4(1.0f), glm::radians(angles[i]), axes[i]);
+				matrices[i] *= glm::scale(glm::mat4(1.0f), glm::vec3(1.5f, 1.0f, 0.8f));
+
+			}
+
+		}
+
+		auto middle = std::chrono::high_resolution_clock::now();
+
+		// Update only the columns each move changes.
+		for (size_t frame = 0; frame < frames; frame++) {
+
+			for (size_t i = 0; i < count; i++) {
+
+				geometries[i].resetTransforms();
+				geometries[i].translate(offsets[i].x, offsets[i].y, offsets[i].z);
+				geometries[i].rotate(axes[i].x, axes[i].y, axes[i].z, angles[i]);
+				geometries[i].scale(1.5f, 1.0f, 0.8f);
+
+			}
+
+		}
+
+		auto end = std::chrono::high_resolution_clock::now();
+
+		float max_error = 0.0f;
+
+		for (size_t i = 0; i < count; i++)
+			for (int column = 0; column < 4; column++)
+				max_error = std::max(max_error, glm::length(geometries[i].getTransforms()[column] - matrices[i][column]));
+
+		// Turn a node a degree at a time for a hundred turns, with matrices and with the graph.
+		const int steps = 36000;
+		glm::vec3 axis = glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f));
+		glm::mat4 turned(1.0f);
+		SceneGraph turning;
+		turning.addNode(-1);
+
+		for (int step = 0; step < steps; step++) {
+
+			turned = turned * glm::rotate(glm::mat4(1.0f), glm::radians(1.0f), axis);
+			turning.rotate(0, axis, 1.0f);
+
+		}
+
+		turning.update();
+
+		// A rotation times its transpose is the identity, and a hundred turns leave nothing.
+		glm::mat3 turned_axes = glm::mat3(turned);
+		glm::mat3 graph_axes = glm::mat3(turning.getWorld(0));
+		float matrix_drift = 0.0f;
+		float graph_drift = 0.0f;
+
+		for (int column = 0; column < 3; column++) {
+
+			matrix_drift = std::max(matrix_drift, glm::length((glm::transpose(turned_axes) * turned_axes)[column] - glm::mat3(1.0f)[column]));
+			graph_drift = std::max(graph_drift, glm::length((glm::transpose(graph_axes) * graph_axes)[column] - glm::mat3(1.0f)[column]));
+
+		}
+
+		float matrix_turn = glm::length(turned_axes[0] - glm::vec3(1.0f, 0.0f, 0.0f));
+		float graph_turn = glm::length(graph_axes[0] - glm::vec3(1.0f, 0.0f, 0.0f));
+
+		// Print the results.
+		double matrix_time = std::chrono::duration<double, std::micro>(middle - start).count() / frames;
+		double column_time = std::chrono::duration<double, std::micro>(end - middle).count() / frames;
+
+		std::cout << "Transforms: " << count << " geometries, " << frames << " frames." << std::endl;
+		std::cout << "  Full matrices:    " << matrix_time << " us/frame." << std::endl;
+		std::cout << "  Columns:          " << column_time << " us/frame." << std::endl;
+		std::cout << "  Speed-up:         " << matrix_time / column_time << "x." << std::endl;
+		std::cout << "  Max error:        " << max_error << "." << std::endl;
+		std::cout << "  Drift, matrices:  " << matrix_drift << " off orthogonal, " << matrix_turn << " off the start." << std::endl;
+		std::cout << "  Drift, graph:     " << graph_drift << " off orthogonal, " << graph_turn << " off the start." << std::endl;
+
+	}
+
+	void Benchmark::transforms(size_t count, size_t frames) {
+
+		// Build a scene similar to the game: translated, rotated and scaled geometries.
+		std::mt19937 generator(42);
+		std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+		std::uniform_real_distribution<float> angle(0.0f, 360.0f);
+		std::uniform_real_distribution<float> size(0.5f, 4.0f);
+
+		std::vector<glm::mat4> models(count);
+		std::vector<glm::mat4> normals(count);
+		std::vector<const glm::mat4*> model_pointers(count);
+		std::vector<const glm::mat4*> normal_pointers(count);
+
+		for (size_t i = 0; i < count; i++) {
+
+			models[i] = glm::translate(glm::mat4(1.0f), glm::vec3(position(generator), 0.0f, position(generator)));
+			models[i] = glm::rotate(models[i], glm::radians(angle(generator)), glm::vec3(0.0f, 1.0f, 0.0f));
+			models[i] = glm::scale(models[i], glm::vec3(size(generator), size(generator), size(generator)));
+
+			// This is what the geometries cache when their transforms change.
+			normals[i] = glm::mat4(glm::transpose(glm::inverse(glm::mat3(models[i]))));
+
+			model_pointers[i] = &models[i];
+			normal_pointers[i] = &normals[i];
+
+		}
+
+		glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 5.0f, 10.0f), glm::vec3(0.0f, 0.0f, -10.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+		std::vector<DrawData> per_draw(count);
+		std::vector<DrawData> batched(count);
+
+		// Time the previous per draw path.
+		auto start = std::chrono::high_resolution_clock::now();
+
+		for (size_t frame = 0; frame < frames; frame++) {
+
+			for (size_t i = 0; i < count; i++) {
+
+				per_draw[i].model = models[i];
+				per_draw[i].model_view = view * models[i];
+				per_draw[i].normal_matrix = glm::transpose(glm::inverse(per_draw[i].model_view));
+
+			}
+
+		}
+
+		auto middle = std::chrono::high_resolution_clock::now();
+
+		// Time the batched path.
+		for (size_t frame = 0; frame < frames; frame++)
+			TransformBatch::transform(view, model_pointers.data(), normal_pointers.data(), batched.data(), count);
+
+		auto end = std::chrono::high_resolution_clock::now();
+
+		// Both normal matrices must give the same directions.
+		float max_error = 0.0f;
+
+		for (size_t i = 0; i < count; i++) {
+
+			glm::vec3 normal = glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f));
+			glm::vec3 expected = glm::normalize(glm::mat3(per_draw[i].normal_matrix) * normal);
+			glm::vec3 obtained = glm::normalize(glm::mat3(batched[i].normal_matrix) * normal);
+
+			max_error = glm::max(max_error, glm::length(expected - obtained));
+
+		}
+
+		// Print the results.
+		double per_draw_time = std::chrono::duration<double, std::micro>(middle - start).count() / frames;
+		double batched_time = std::chrono::duration<double, std::micro>(end - middle).count() / frames;
+
+		std::cout << "Transform stage: " << count << " draws, " << frames << " frames." << std::endl;
+		std::cout << "  Per draw inverse: " << per_draw_time << " us/frame." << std::endl;
+		std::cout << "  Batched:          " << batched_time << " us/frame." << std::endl;
+		std::cout << "  Speed-up:         " << per_draw_time / batched_time << "x." << std::endl;
+		std::cout << "  Max normal error: " << max_error << "." << std::endl;
+
+	}
+
+}  // namespace aladdin_3d
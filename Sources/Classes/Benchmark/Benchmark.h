@@ -0,0 +1,137 @@
+/**
+ * @file Benchmark.h
+ * @brief Benchmark class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_BENCHMARK_H_
+#define ALADDIN_3D_CLASSES_BENCHMARK_H_
+
+#include <stddef.h>
+
+#include <string>
+#include <vector>
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of a Benchmark class.
+	 *
+	 * Groups the micro-benchmarks of the engine. They run on synthetic data, without
+	 * a window or an OpenGL context, and print their results to the standard output.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class Benchmark {
+
+		public:
+
+			/**
+			 * @brief Benchmarks the bounds of the models.
+			 *
+			 * Loads every model and compares scanning its vertices with glm one by one with
+			 * the batch reductions, transforming the boxes of its geometries through their
+			 * eight corners with transforming their centres and half sizes, and querying the
+			 * bounds of the object with merging them again after a move. It needs OpenGL.
+			 *
+			 * @param files The paths of the glTF models.
+			 * @param reps The number of times every measure is repeated.
+			 */
+			static void bounds(const std::vector<std::string> &files, size_t reps);
+
+			/**
+			 * @brief Benchmarks the broadphase.
+			 *
+			 * Times the updates of the broadphase with half of the proxies standing still
+			 * and the other half running along the corridor, and checks the contacts of
+			 * the last update against testing every pair.
+			 *
+			 * @param count The number of proxies.
+			 * @param frames The number of frames to time.
+			 */
+			static void broadphase(size_t count, size_t frames);
+
+			/**
+			 * @brief Checks the collisions at several tick rates.
+			 *
+			 * Runs the character along a corridor with the boxes of the game, jumping on
+			 * a fixed schedule, from 5 to 240 ticks per second, and compares the hits
+			 * of the swept test at every rate.
+			 *
+			 * @param length The length of the corridor.
+			 *
+			 * @returns True if the swept test gives the same hits at every rate.
+			 */
+			static bool collisions(float length);
+
+			/**
+			 * @brief Benchmarks the entity systems.
+			 *
+			 * Compares the visibility, staging, sorting and collision passes over the component
+			 * arrays of the entity store with the same passes over one large record per
+			 * entity, like the objects used to be.
+			 *
+			 * @param count The number of entities.
+			 * @param frames The number of frames to time.
+			 */
+			static void entities(size_t count, size_t frames);
+
+			/**
+			 * @brief Benchmarks the flow field.
+			 *
+			 * Times building the flow field of a corridor with boxes on one thread and on
+			 * every core, and moving growing numbers of agents along it.
+			 *
+			 * @param length The length of the corridor.
+			 * @param ticks The number of ticks to move the agents.
+			 */
+			static void flowField(float length, size_t ticks);
+
+			/**
+			 * @brief Benchmarks the batch maths kernels.
+			 *
+			 * Compares every kernel of the batch maths, with every instruction set the CPU
+			 * supports, with the same maths written with glm one item at a time.
+			 *
+			 * @param count The number of items of every batch.
+			 * @param reps The number of times every batch is run.
+			 */
+			static void maths(size_t count, size_t reps);
+
+			/**
+			 * @brief Benchmarks the scene graph.
+			 *
+			 * Compares moving geometries with whole matrix products and with the column
+			 * updates they do now, and checks how far repeated rotations drift with a
+			 * matrix and with the quaternions of the scene graph.
+			 *
+			 * @param count The number of geometries.
+			 * @param frames The number of frames to time.
+			 */
+			static void sceneGraph(size_t count, size_t frames);
+
+			/**
+			 * @brief Benchmarks the transform stage.
+			 *
+			 * Compares computing the modelView and a general 4x4 inverse per draw with the
+			 * batched pass over cached world matrices, and checks that both give the same normals.
+			 *
+			 * @param count The number of draws per frame.
+			 * @param frames The number of frames to time.
+			 */
+			static void transforms(size_t count, size_t frames);
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_BENCHMARK_H_
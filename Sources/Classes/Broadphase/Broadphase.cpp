@@ -0,0 +1,305 @@
+/**
+ * @file Broadphase.cpp
+ * @brief Broadphase class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+
+#include "Broadphase.h"
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "glm/glm.hpp"
+
+#include "Structs/BoundingBox/BoundingBox.h"
+#include "Structs/ContactEvent/ContactEvent.h"
+
+namespace aladdin_3d {
+
+	const unsigned int Broadphase::character;
+	const unsigned int Broadphase::obstacle;
+	const unsigned int Broadphase::pickup;
+	const unsigned int Broadphase::guard;
+
+	size_t Broadphase::add(const BoundingBox &bounds, unsigned int layer, unsigned int mask) {
+
+		this->bounds_min.push_back(bounds.min);
+		this->bounds_max.push_back(bounds.max);
+		this->layers.push_back(layer);
+		this->masks.push_back(mask);
+		this->removed.push_back(0);
+		this->touching.push_back(std::vector<size_t>());
+
+		// It goes at the end of the order, and the next update sorts everything again.
+		this->order.push_back(this->bounds_min.size() - 1);
+		this->added = true;
+
+		return this->bounds_min.size() - 1;
+
+	}
+
+	void Broadphase::clear() {
+
+		this->bounds_min.clear();
+		this->bounds_max.clear();
+		this->layers.clear();
+		this->masks.clear();
+		this->removed.clear();
+		this->order.clear();
+		this->active.clear();
+		this->contacts.clear();
+		this->previous.clear();
+		this->events.clear();
+		this->touching.clear();
+		this->swaps = 0;
+		this->added = false;
+
+	}
+
+	BoundingBox Broadphase::getBounds(size_t proxy) const {
+
+		BoundingBox bounds;
+		bounds.min = this->bounds_min[proxy];
+		bounds.max = this->bounds_max[proxy];
+
+		return bounds;
+
+	}
+
+	const std::vector<std::pair<size_t, size_t>> &Broadphase::getContacts() const {
+
+		return this->contacts;
+
+	}
+
+	const std::vector<size_t> &Broadphase::getContacts(size_t proxy) const {
+
+		return this->touching[proxy];
+
+	}
+
+	size_t Broadphase::getCPUBytes() const {
+
+		size_t bytes = (this->bounds_min.capacity() + this->bounds_max.capacity()) * sizeof(glm::vec3) +
+			(this->layers.capacity() + this->masks.capacity()) * sizeof(unsigned int) +
+			this->removed.capacity() * sizeof(unsigned char) +
+			(this->order.capacity() + this->active.capacity()) * sizeof(size_t) +
+			(this->contacts.capacity() + this->previous.capacity()) * sizeof(std::pair<size_t, size_t>) +
+			this->events.capacity() * sizeof(ContactEvent) +
+			this->touching.capacity() * sizeof(std::vector<size_t>);
+
+		for (size_t i = 0; i < this->touching.size(); i++)
+			bytes += this->touching[i].capacity() * sizeof(size_t);
+
+		return bytes;
+
+	}
+
+	const std::vector<ContactEvent> &Broadphase::getEvents() const {
+
+		return this->events;
+
+	}
+
+	unsigned int Broadphase::getLayer(size_t proxy) const {
+
+		return this->layers[proxy];
+
+	}
+
+	size_t Broadphase::getSwaps() const {
+
+		return this->swaps;
+
+	}
+
+	void Broadphase::move(size_t proxy, const BoundingBox &bounds) {
+
+		this->bounds_min[proxy] = bounds.min;
+		this->bounds_max[proxy] = bounds.max;
+
+	}
+
+	void Broadphase::remove(size_t proxy) {
+
+		if (this->removed[proxy])
+			return;
+
+		this->removed[proxy] = 1;
+		this->order.erase(std::find(this->order.begin(), this->order.end(), proxy));
+
+	}
+
+	void Broadphase::reserve(size_t count) {
+
+		this->bounds_min.reserve(count);
+		this->bounds_max.reserve(count);
+		this->layers.reserve(count);
+		this->masks.reserve(count);
+		this->removed.reserve(count);
+		this->touching.reserve(count);
+		this->order.reserve(count);
+		this->active.reserve(count);
+
+	}
+
+	size_t Broadphase::size() const {
+
+		return this->bounds_min.size();
+
+	}
+
+	void Broadphase::update() {
+
+		// Put the proxies back in order. They were in order last time and have barely
+		// moved since, so every one is only a few places away from where it belongs.
+		// The new ones come in any order, so after adding them everything is sorted once.
+		this->swaps = 0;
+
+		if (this->added) {
+
+			const std::vector<glm::vec3> &bounds_min = this->bounds_min;
+
+			std::sort(this->order.begin(), this->order.end(), [&bounds_min](size_t a, size_t b) {
+
+				return bounds_min[a].z < bounds_min[b].z;
+
+			});
+
+			this->added = false;
+
+		}
+
+		for (size_t i = 1; i < this->order.size(); i++) {
+
+			size_t proxy = this->order[i];
+			float start = this->bounds_min[proxy].z;
+			size_t j = i;
+
+			while (j > 0 && this->bounds_min[this->order[j - 1]].z > start) {
+
+				this->order[j] = this->order[j - 1];
+				j--;
+
+			}
+
+			this->order[j] = proxy;
+			this->swaps += i - j;
+
+		}
+
+		// Sweep along Z, keeping the proxies whose interval is still open.
+		this->previous.swap(this->contacts);
+		this->contacts.clear();
+		this->active.clear();
+
+		for (size_t i = 0; i < this->order.size(); i++) {
+
+			size_t proxy = this->order[i];
+			glm::vec3 min = this->bounds_min[proxy];
+			glm::vec3 max = this->bounds_max[proxy];
+
+			for (size_t j = 0; j < this->active.size();) {
+
+				size_t other = this->active[j];
+
+				// Close the intervals that end before this one starts.
+				if (this->bounds_max[other].z <= min.z) {
+
+					this->active[j] = this->active.back();
+					this->active.pop_back();
+					continue;
+
+				}
+
+				j++;
+
+				if (!(this->layers[proxy] & this->masks[other]) || !(this->layers[other] & this->masks[proxy]))
+					continue;
+
+				if (this->bounds_min[other].z < max.z &&
+					this->bounds_min[other].x < max.x && min.x < this->bounds_max[other].x &&
+					this->bounds_min[other].y < max.y && min.y < this->bounds_max[other].y)
+					this->contacts.push_back(std::make_pair(std::min(proxy, other), std::max(proxy, other)));
+
+			}
+
+			this->active.push_back(proxy);
+
+		}
+
+		// Compare both sorted sets of pairs to find the contacts that began or ended.
+		std::sort(this->contacts.begin(), this->contacts.end());
+		this->events.clear();
+
+		size_t a = 0;
+		size_t b = 0;
+
+		while (a < this->previous.size() || b < this->contacts.size()) {
+
+			ContactEvent event;
+
+			if (b == this->contacts.size() || (a < this->previous.size() && this->previous[a] < this->contacts[b])) {
+
+				event.first = this->previous[a].first;
+				event.second = this->previous[a].second;
+				event.begin = false;
+				this->events.push_back(event);
+				a++;
+
+			} else if (a == this->previous.size() || this->contacts[b] < this->previous[a]) {
+
+				event.first = this->contacts[b].first;
+				event.second = this->contacts[b].second;
+				event.begin = true;
+				this->events.push_back(event);
+				b++;
+
+			} else {
+
+				a++;
+				b++;
+
+			}
+
+		}
+
+		// Apply the events to the contacts of every proxy.
+		for (size_t i = 0; i < this->events.size(); i++) {
+
+			const ContactEvent &event = this->events[i];
+			std::vector<size_t> &first = this->touching[event.first];
+			std::vector<size_t> &second = this->touching[event.second];
+
+			if (event.begin) {
+
+				first.push_back(event.second);
+				second.push_back(event.first);
+
+			} else {
+
+				*std::find(first.begin(), first.end(), event.second) = first.back();
+				first.pop_back();
+				*std::find(second.begin(), second.end(), event.first) = second.back();
+				second.pop_back();
+
+			}
+
+		}
+
+	}
+
+}  // namespace aladdin_3d
@@ -0,0 +1,215 @@
+/**
+ * @file Broadphase.h
+ * @brief Broadphase class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_BROADPHASE_H_
+#define ALADDIN_3D_CLASSES_BROADPHASE_H_
+
+#include <stddef.h>
+
+#include <utility>
+#include <vector>
+
+#include "glm/glm.hpp"
+
+#include "Structs/BoundingBox/BoundingBox.h"
+#include "Structs/ContactEvent/ContactEvent.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of a Broadphase class.
+	 *
+	 * Finds the pairs of proxies whose bounding boxes overlap with sweep and prune
+	 * along Z, the axis of the corridor. The proxies stay sorted by the start of their
+	 * bounds between updates, and since they barely move from one update to the next,
+	 * an insertion sort puts them back in order in close to linear time. A sweep over
+	 * that order then only tests the proxies whose intervals along Z overlap.
+	 *
+	 * Every proxy has a layer and a mask of the layers it collides with, and a pair is
+	 * only reported if each one is in the mask of the other. The update compares the
+	 * new pairs with the old ones and reports the contacts that began or ended, and
+	 * applies those events to a list of contacts per proxy, so that the game only
+	 * looks at the contacts of the proxies it cares about.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class Broadphase {
+
+		public:
+
+			/**
+			 * @brief Adds a proxy.
+			 *
+			 * Adds a proxy. Its contacts are reported from the next update.
+			 *
+			 * @param bounds The bounding box of the proxy.
+			 * @param layer The layer of the proxy.
+			 * @param mask The layers the proxy collides with.
+			 *
+			 * @returns The index of the new proxy.
+			 */
+			size_t add(const BoundingBox &bounds, unsigned int layer, unsigned int mask);
+
+			/**
+			 * @brief Removes every proxy.
+			 *
+			 * Removes every proxy, its contacts and its events.
+			 */
+			void clear();
+
+			/**
+			 * @brief Gets the bounding box of a proxy.
+			 *
+			 * Gets the bounding box of a proxy.
+			 *
+			 * @param proxy The index of the proxy.
+			 *
+			 * @returns The bounding box.
+			 */
+			BoundingBox getBounds(size_t proxy) const;
+
+			/**
+			 * @brief Gets the contacts.
+			 *
+			 * Gets the pairs of proxies that overlapped in the last update, lower proxy
+			 * first and in order.
+			 *
+			 * @returns The contacts.
+			 */
+			const std::vector<std::pair<size_t, size_t>> &getContacts() const;
+
+			/**
+			 * @brief Gets the contacts of a proxy.
+			 *
+			 * Gets the proxies that overlapped a proxy in the last update, in no
+			 * particular order.
+			 *
+			 * @param proxy The index of the proxy.
+			 *
+			 * @returns The proxies in contact.
+			 */
+			const std::vector<size_t> &getContacts(size_t proxy) const;
+
+			/**
+			 * @brief Gets the memory used on the CPU.
+			 *
+			 * Gets the bytes reserved by the proxies, the contacts and the events.
+			 *
+			 * @returns The number of bytes.
+			 */
+			size_t getCPUBytes() const;
+
+			/**
+			 * @brief Gets the events.
+			 *
+			 * Gets the contacts that began or ended in the last update.
+			 *
+			 * @returns The events.
+			 */
+			const std::vector<ContactEvent> &getEvents() const;
+
+			/**
+			 * @brief Gets the layer of a proxy.
+			 *
+			 * Gets the layer of a proxy.
+			 *
+			 * @param proxy The index of the proxy.
+			 *
+			 * @returns The layer.
+			 */
+			unsigned int getLayer(size_t proxy) const;
+
+			/**
+			 * @brief Gets the number of swaps.
+			 *
+			 * Gets the number of swaps the insertion sort did in the last update.
+			 *
+			 * @returns The number of swaps.
+			 */
+			size_t getSwaps() const;
+
+			/**
+			 * @brief Moves a proxy.
+			 *
+			 * Changes the bounding box of a proxy. The order and the contacts are
+			 * updated in the next update.
+			 *
+			 * @param proxy The index of the proxy.
+			 * @param bounds The new bounding box.
+			 */
+			void move(size_t proxy, const BoundingBox &bounds);
+
+			/**
+			 * @brief Removes a proxy.
+			 *
+			 * Takes a proxy out of the broadphase. Its contacts end in the next update,
+			 * and its index is not used again until the broadphase is cleared.
+			 *
+			 * @param proxy The index of the proxy.
+			 */
+			void remove(size_t proxy);
+
+			/**
+			 * @brief Reserves memory for a number of proxies.
+			 *
+			 * Reserves every array for a number of proxies.
+			 *
+			 * @param count The number of proxies.
+			 */
+			void reserve(size_t count);
+
+			/**
+			 * @brief Gets the number of proxies.
+			 *
+			 * Gets the number of proxies added, including the removed ones.
+			 *
+			 * @returns The number of proxies.
+			 */
+			size_t size() const;
+
+			/**
+			 * @brief Updates the contacts.
+			 *
+			 * Sorts the proxies again, sweeps them to find the pairs that overlap and
+			 * fills the events with the contacts that began or ended since the last update.
+			 */
+			void update();
+
+			static const unsigned int character = 1;	/// Layer of the characters.
+			static const unsigned int obstacle = 2;		/// Layer of the obstacles.
+			static const unsigned int pickup = 4;		/// Layer of the pickups.
+			static const unsigned int guard = 8;		/// Layer of the guards.
+
+		private:
+
+			std::vector<glm::vec3> bounds_min;			/// Minimum corner of the bounds of every proxy.
+			std::vector<glm::vec3> bounds_max;			/// Maximum corner of the bounds of every proxy.
+			std::vector<unsigned int> layers;			/// Layer of every proxy.
+			std::vector<unsigned int> masks;			/// Layers every proxy collides with.
+			std::vector<unsigned char> removed;			/// Whether every proxy was removed.
+			std::vector<size_t> order;					/// Proxies sorted by the start of their bounds along Z.
+			std::vector<size_t> active;					/// Scratch space with the proxies open in the sweep.
+			std::vector<std::pair<size_t, size_t>> contacts;	/// Pairs that overlapped in the last update.
+			std::vector<std::pair<size_t, size_t>> previous;	/// Pairs that overlapped in the update before.
+			std::vector<ContactEvent> events;			/// Contacts that began or ended in the last update.
+			std::vector<std::vector<size_t>> touching;	/// Proxies in contact with every proxy.
+			size_t swaps = 0;							/// Swaps done by the last insertion sort.
+			bool added = false;							/// Whether proxies were added since the last update.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_BROADPHASE_H_
@@ -0,0 +1,218 @@
+/**
+ * @file Crowd.cpp
+ * @brief Crowd class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "Crowd.h"
+
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "glew/glew.h"
+#include "glm/glm.hpp"
+#include "glm/gtc/matrix_transform.hpp"
+
+#include "Classes/AnimationTexture/AnimationTexture.h"
+#include "Classes/FlowField/FlowField.h"
+#include "Classes/Object/Object.h"
+#include "Classes/Shader/Shader.h"
+#include "Classes/StreamBuffer/StreamBuffer.h"
+#include "Structs/DrawData/DrawData.h"
+
+namespace aladdin_3d {
+
+	const float Crowd::near_distance = 15.0f;
+	const float Crowd::far_distance = 40.0f;
+
+	Crowd::Crowd(const Object &member, const AnimationTexture &animation) : member(member), duration(animation.getDuration()) {
+
+	}
+
+	void Crowd::draw(Shader &shader, AnimationTexture &animation) {
+
+		if (this->positions.empty())
+			return;
+
+		// Tell the shader where the matrices and the clip times are, and where to pose them from.
+		animation.bind(shader);
+		shader.passDrawIndex(this->draw_index);
+		shader.passInt("crowdSize", (int)this->positions.size());
+
+		this->member.drawInstanced(shader, (GLsizei)this->positions.size());
+
+	}
+
+	size_t Crowd::getCount() const {
+
+		return this->positions.size();
+
+	}
+
+	size_t Crowd::getCPUBytes() const {
+
+		return sizeof(Crowd) + (this->slots.capacity() + this->positions.capacity()) * sizeof(glm::vec3) + this->offsets.capacity() * sizeof(float) +
+			this->intervals.capacity() * sizeof(unsigned char) + this->clip_times.capacity() * sizeof(float);
+
+	}
+
+	GLuint Crowd::getDraws() const {
+
+		// The clip times are packed after the matrices, as many as the floats of a draw.
+		const size_t times_per_draw = sizeof(DrawData) / sizeof(float);
+		size_t count = this->positions.size();
+
+		return (GLuint)(count + (count + times_per_draw - 1) / times_per_draw);
+
+	}
+
+	size_t Crowd::getPosedCount() const {
+
+		return this->posed;
+
+	}
+
+	void Crowd::populate(size_t count, const glm::vec3 &front, size_t row_size, float spacing) {
+
+		this->slots.resize(count);
+		this->offsets.resize(count);
+		this->intervals.assign(count, 1);
+		this->clip_times.assign(count, 0.0f);
+
+		// The same crowd every time, so that the runs can be compared.
+		std::default_random_engine generator(1);
+		std::uniform_real_distribution<float> offset(0.0f, this->duration);
+
+		for (size_t i = 0; i < count; i++) {
+
+			size_t row = i / row_size;
+			size_t column = i % row_size;
+
+			float x = ((float)column - (row_size - 1) / 2.0f) * spacing;
+			this->slots[i] = front + glm::vec3(x, 0.0f, -(float)row * spacing);
+			this->offsets[i] = offset(generator);
+
+		}
+
+		// Everyone starts in their slot, and is posed in the first update.
+		this->positions = this->slots;
+		this->steering = false;
+		this->frame = 0;
+
+	}
+
+	void Crowd::steer(const FlowField &field, float time, float leader_speed, float speed) {
+
+		float step = time - this->steer_time;
+		this->steer_time = time;
+
+		// Start again from the slots when the time jumps back.
+		if (!this->steering || step < 0.0f) {
+
+			std::copy(this->slots.begin(), this->slots.end(), this->positions.begin());
+			this->steering = true;
+			return;
+
+		}
+
+		glm::vec3 leader(0.0f, 0.0f, leader_speed * time);
+
+		for (size_t i = 0; i < this->positions.size(); i++) {
+
+			glm::vec3 &position = this->positions[i];
+			glm::vec3 world = position + leader;
+			glm::vec2 motion = field.getDirection(world) * speed * step;
+
+			// On a clear way, drift back to the lane of the slot at half the speed.
+			float lane = this->slots[i].x - position.x;
+
+			if (motion.x == 0.0f && lane != 0.0f && !field.isBlocked(world + glm::vec3(lane, 0.0f, 0.0f)))
+				motion.x = glm::clamp(lane, -0.5f * speed * step, 0.5f * speed * step);
+
+			// The positions follow the character, so it takes its own run away from them.
+			position.x += motion.x;
+			position.z = std::min(position.z + motion.y - leader_speed * step, this->slots[i].z);
+
+		}
+
+	}
+
+	void Crowd::update(float time, const glm::vec3 &camera_position) {
+
+		const float near_squared = near_distance * near_distance;
+		const float far_squared = far_distance * far_distance;
+
+		// Choose how often the clip time of every member advances.
+		for (size_t i = 0; i < this->positions.size(); i++) {
+
+			glm::vec3 offset = this->positions[i] - camera_position;
+			float distance_squared = glm::dot(offset, offset);
+
+			this->intervals[i] = distance_squared < near_squared ? 1 : (distance_squared < far_squared ? 2 : 4);
+
+		}
+
+		// Move on the members that are due, shifted by their index so that every frame
+		// gets a share of the far ones. The shader poses them from the baked clip.
+		this->posed = 0;
+
+		for (size_t i = 0; i < this->positions.size(); i++) {
+
+			if (this->frame != 0 && (this->frame + i) % this->intervals[i] != 0)
+				continue;
+
+			this->clip_times[i] = time + this->offsets[i];
+			this->posed++;
+
+		}
+
+		this->frame++;
+
+	}
+
+	void Crowd::upload(const glm::mat4 &view, StreamBuffer &stream) {
+
+		if (this->positions.empty())
+			return;
+
+		size_t count = this->positions.size();
+		DrawData *out = stream.reserve(this->getDraws(), &this->draw_index);
+
+		// Every member is the character moved, and none of them turns, so they share the
+		// normal matrix.
+		const glm::mat4 &root = this->member.getSceneGraph().getWorld(0);
+		glm::mat4 view_rotation = view;
+		view_rotation[3] = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+		glm::mat4 normal_matrix = view_rotation * glm::transpose(glm::inverse(root));
+		normal_matrix[3] = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+
+		for (size_t i = 0; i < count; i++) {
+
+			glm::mat4 model = glm::translate(glm::mat4(1.0f), this->positions[i]) * root;
+
+			out[i].model = model;
+			out[i].model_view = view * model;
+			out[i].normal_matrix = normal_matrix;
+
+		}
+
+		// The clip times follow as a plain array of floats.
+		memcpy(&out[count], this->clip_times.data(), count * sizeof(float));
+
+	}
+
+}  // namespace aladdin_3d
@@ -0,0 +1,185 @@
+/**
+ * @file Crowd.h
+ * @brief Crowd class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_CROWD_H_
+#define ALADDIN_3D_CLASSES_CROWD_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "glew/glew.h"
+#include "glm/glm.hpp"
+
+#include "Classes/AnimationTexture/AnimationTexture.h"
+#include "Classes/FlowField/FlowField.h"
+#include "Classes/Object/Object.h"
+#include "Classes/Shader/Shader.h"
+#include "Classes/StreamBuffer/StreamBuffer.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of a Crowd class.
+	 *
+	 * Runs many copies of a skinned character that share its meshes and one baked clip.
+	 * The state of every member lives in its own contiguous array: its position, the
+	 * offset of its clip, how often its clip time advances and the time itself. The
+	 * shader samples the pose of every member from the baked clip at its time, so no
+	 * palette is computed on the CPU. The clip time of the members far from the camera
+	 * advances less often, and the ones that are not due in a frame hold their pose.
+	 *
+	 * Every member has a slot in rows behind the character and runs after it, following
+	 * a flow field around the obstacles. Once the way is clear it goes back to its slot.
+	 *
+	 * The whole crowd is drawn with one instanced call per geometry. Its matrices and
+	 * clip times are streamed to the shader with the rest of the per-draw data.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class Crowd {
+
+		public:
+
+			/**
+			 * @brief Constructs an empty crowd.
+			 *
+			 * Constructs a crowd of a skinned character. It has no members until it is populated.
+			 *
+			 * @param member The character every member is a copy of. It has to be skinned.
+			 * @param animation The baked clip every member plays.
+			 */
+			Crowd(const Object &member, const AnimationTexture &animation);
+
+			/**
+			 * @brief Draws the crowd.
+			 *
+			 * Draws every member of the crowd with the data of the last upload, posed
+			 * from the baked clip.
+			 *
+			 * @param shader The shader used to draw the crowd.
+			 * @param animation The baked clip the crowd was made with.
+			 */
+			void draw(Shader &shader, AnimationTexture &animation);
+
+			/**
+			 * @brief Get the number of members.
+			 *
+			 * Get the number of members of the crowd.
+			 *
+			 * @returns The number of members.
+			 */
+			size_t getCount() const;
+
+			/**
+			 * @brief Gets the memory used on the CPU.
+			 *
+			 * Gets the bytes used by the state of the members in main memory. The meshes
+			 * are shared with the character.
+			 *
+			 * @returns The number of bytes.
+			 */
+			size_t getCPUBytes() const;
+
+			/**
+			 * @brief Get the room needed in the stream buffer.
+			 *
+			 * Get the number of draws the crowd takes in the stream buffer every frame.
+			 *
+			 * @returns The number of draws.
+			 */
+			GLuint getDraws() const;
+
+			/**
+			 * @brief Get the number of members posed in the last update.
+			 *
+			 * Get the number of members whose clip time advanced in the last update.
+			 *
+			 * @returns The number of members.
+			 */
+			size_t getPosedCount() const;
+
+			/**
+			 * @brief Places the members.
+			 *
+			 * Replaces the members of the crowd with a new number of them, in rows behind
+			 * a point. Every member starts its clip at a different time.
+			 *
+			 * @param count The number of members.
+			 * @param front The centre of the first row, relative to the character.
+			 * @param row_size The number of members in every row.
+			 * @param spacing The distance between the members.
+			 */
+			void populate(size_t count, const glm::vec3 &front, size_t row_size, float spacing);
+
+			/**
+			 * @brief Moves the members.
+			 *
+			 * Moves every member along the flow field for the time since the last call,
+			 * never getting ahead of its slot. The first call, and any call that goes back
+			 * in time, puts every member back in its slot.
+			 *
+			 * @param field The flow field around the obstacles.
+			 * @param time The time in seconds.
+			 * @param leader_speed The speed of the character, which starts at the origin.
+			 * @param speed The speed of the members.
+			 */
+			void steer(const FlowField &field, float time, float leader_speed, float speed);
+
+			/**
+			 * @brief Updates the poses.
+			 *
+			 * Advances the clip time of the members that are due this frame. The members
+			 * close to the camera move on every frame, and the ones further away every 2
+			 * or 4 frames, spread over the frames. The rest hold their last time.
+			 *
+			 * @param time The time in seconds.
+			 * @param camera_position The position of the camera.
+			 */
+			void update(float time, const glm::vec3 &camera_position);
+
+			/**
+			 * @brief Uploads the crowd.
+			 *
+			 * Writes the matrices and the clip time of every member to the stream buffer.
+			 *
+			 * @param view The view matrix of the current camera.
+			 * @param stream The stream buffer of the current frame.
+			 */
+			void upload(const glm::mat4 &view, StreamBuffer &stream);
+
+			static const float near_distance;	/// Distance up to which the members are posed every frame.
+			static const float far_distance;	/// Distance from which the members are posed every 4 frames.
+
+		private:
+
+			Object member;							/// Character the members are copies of.
+			float duration = 0.0f;					/// Duration of the clip in seconds.
+			std::vector<glm::vec3> slots;			/// Place of every member in the rows, relative to the character.
+			std::vector<glm::vec3> positions;		/// Position of every member, relative to the character.
+			std::vector<float> offsets;				/// Time offset of the clip of every member.
+			std::vector<unsigned char> intervals;	/// Frames between the poses of every member.
+			std::vector<float> clip_times;			/// Time of the clip of every member at its last pose.
+			unsigned long frame = 0;				/// Frames updated since the crowd was populated.
+			size_t posed = 0;						/// Members posed in the last update.
+			GLint draw_index = 0;					/// Index of the first member in the stream buffer.
+			float steer_time = 0.0f;				/// Time of the last move.
+			bool steering = false;					/// Whether the members have left their slots.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_CROWD_H_
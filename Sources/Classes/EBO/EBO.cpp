@@ -19,14 +19,21 @@
 
 #include "glew/glew.h"
 
+#include "Classes/GLHandle/GLHandle.h"
+#include "Classes/ResourceTracker/ResourceTracker.h"
+
 namespace aladdin_3d {
 
+	EBO::EBO() {}
+
 	// Constructor that generates a Elements Buffer Object and links it to indices
 	EBO::EBO(const std::vector<GLuint> &indices) {
 		
 		// Generate the buffer.
-		glGenBuffers(1, &this->ID);
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->ID);
+		GLuint name = 0;
+		glGenBuffers(1, &name);
+		this->ID = GLHandle(name, ResourceTracker::buffers, indices.size() * sizeof(GLuint));
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, name);
 
 		// Link the indices.
 		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), indices.data(), GL_STATIC_DRAW);
@@ -36,13 +43,13 @@ namespace aladdin_3d {
 	void EBO::bind() {
 
 		// Binds the EBO.
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->ID);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->ID.get());
 	
 	}
 
 	void EBO::remove() {
 
-		glDeleteBuffers(1, &this->ID);
+		this->ID.reset();
 
 	}
 
@@ -20,13 +20,16 @@
 
 #include "glew/glew.h"
 
+#include "Classes/GLHandle/GLHandle.h"
+
 namespace aladdin_3d {
 
 	/**
 	 * @brief Implementation of a EBO class.
 	 *
 	 * Implementation of a EBO class that will allow us to bind it to the
-	 * OpenGL pipe, destroy it or deactivate it.
+	 * OpenGL pipe, destroy it or deactivate it. It owns its OpenGL object, so it
+	 * can be moved but not copied, and frees it when it is destroyed.
 	 *
 	 * @author Borja García Quiroga <garcaqub@tcd.ie>
 	 */
@@ -34,6 +37,13 @@ namespace aladdin_3d {
 		
 		public:
 			
+			/**
+			 * @brief Constructs an empty Elements Buffer Object.
+			 *
+			 * Constructs a Elements Buffer Object that owns no buffer.
+			 */
+			EBO();
+
 			/**
 			 * @brief Constructs a Elements Buffer Object.
 			 *
@@ -43,6 +53,11 @@ namespace aladdin_3d {
 			 */
 			EBO(const std::vector<GLuint> &indices);
 
+			EBO(EBO&&) = default;
+			EBO &operator=(EBO&&) = default;
+			EBO(const EBO&) = delete;
+			EBO &operator=(const EBO&) = delete;
+
 			/**
 			 * @brief Binds the EBO.
 			 *
@@ -53,7 +68,7 @@ namespace aladdin_3d {
 			/**
 			 * @brief Removes the EBO.
 			 *
-			 * Removes the EBO from OpenGL.
+			 * Removes the EBO from OpenGL. It does nothing if it was already removed.
 			 */
 			void remove();
 
@@ -66,7 +81,7 @@ namespace aladdin_3d {
 
 		private:
 
-			GLuint ID; // GL ID of the EBO.
+			GLHandle ID; // GL ID of the EBO.
 
 	};
 
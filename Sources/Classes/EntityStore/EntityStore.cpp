@@ -0,0 +1,228 @@
+/**
+ * @file EntityStore.cpp
+ * @brief EntityStore class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+
+#include "EntityStore.h"
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "glew/glew.h"
+#include "glm/glm.hpp"
+
+#include "Classes/OcclusionCuller/OcclusionCuller.h"
+#include "Classes/TransformBatch/TransformBatch.h"
+#include "Structs/BoundingBox/BoundingBox.h"
+
+namespace aladdin_3d {
+
+	const unsigned int EntityStore::in_world;
+	const unsigned int EntityStore::obstacle;
+	const size_t EntityStore::no_candidate;
+
+	size_t EntityStore::add(size_t mesh, unsigned int shader, unsigned int object_class, unsigned int flags,
+		const BoundingBox &bounds, const glm::vec3 &position, size_t candidate) {
+
+		this->meshes.push_back(mesh);
+		this->shaders.push_back(shader);
+		this->classes.push_back(object_class);
+		this->flags.push_back(flags);
+		this->bounds_min.push_back(bounds.min);
+		this->bounds_max.push_back(bounds.max);
+		this->positions.push_back(position);
+		this->candidates.push_back(candidate);
+		this->first_transforms.push_back(this->models.size());
+		this->transform_counts.push_back(0);
+		this->visible.push_back(1);
+
+		return this->meshes.size() - 1;
+
+	}
+
+	void EntityStore::addTransform(const glm::mat4 &model, const glm::mat4 &normal) {
+
+		this->models.push_back(model);
+		this->normals.push_back(normal);
+		this->draw_indices.push_back(0);
+		this->transform_counts.back()++;
+
+	}
+
+	void EntityStore::clear() {
+
+		this->meshes.clear();
+		this->shaders.clear();
+		this->classes.clear();
+		this->flags.clear();
+		this->bounds_min.clear();
+		this->bounds_max.clear();
+		this->positions.clear();
+		this->candidates.clear();
+		this->first_transforms.clear();
+		this->transform_counts.clear();
+		this->visible.clear();
+		this->models.clear();
+		this->normals.clear();
+		this->draw_indices.clear();
+
+	}
+
+	BoundingBox EntityStore::getBounds(size_t entity) const {
+
+		BoundingBox bounds;
+		bounds.min = this->bounds_min[entity];
+		bounds.max = this->bounds_max[entity];
+
+		return bounds;
+
+	}
+
+	unsigned int EntityStore::getClass(size_t entity) const {
+
+		return this->classes[entity];
+
+	}
+
+	size_t EntityStore::getCPUBytes() const {
+
+		size_t bytes = (this->meshes.capacity() + this->candidates.capacity() + this->first_transforms.capacity() +
+			this->transform_counts.capacity()) * sizeof(size_t);
+		bytes += (this->shaders.capacity() + this->classes.capacity() + this->flags.capacity()) * sizeof(unsigned int);
+		bytes += (this->bounds_min.capacity() + this->bounds_max.capacity() + this->positions.capacity()) * sizeof(glm::vec3);
+		bytes += this->visible.capacity() * sizeof(unsigned char);
+		bytes += (this->models.capacity() + this->normals.capacity()) * sizeof(glm::mat4);
+		bytes += this->draw_indices.capacity() * sizeof(GLint);
+
+		return bytes;
+
+	}
+
+	const GLint *EntityStore::getDrawIndices(size_t entity) const {
+
+		return this->draw_indices.data() + this->first_transforms[entity];
+
+	}
+
+	unsigned int EntityStore::getFlags(size_t entity) const {
+
+		return this->flags[entity];
+
+	}
+
+	size_t EntityStore::getMesh(size_t entity) const {
+
+		return this->meshes[entity];
+
+	}
+
+	glm::vec3 EntityStore::getPosition(size_t entity) const {
+
+		return this->positions[entity];
+
+	}
+
+	unsigned int EntityStore::getShader(size_t entity) const {
+
+		return this->shaders[entity];
+
+	}
+
+	bool EntityStore::isVisible(size_t entity) const {
+
+		return this->visible[entity] != 0;
+
+	}
+
+	void EntityStore::reserve(size_t count) {
+
+		this->meshes.reserve(count);
+		this->shaders.reserve(count);
+		this->classes.reserve(count);
+		this->flags.reserve(count);
+		this->bounds_min.reserve(count);
+		this->bounds_max.reserve(count);
+		this->positions.reserve(count);
+		this->candidates.reserve(count);
+		this->first_transforms.reserve(count);
+		this->transform_counts.reserve(count);
+		this->visible.reserve(count);
+
+	}
+
+	size_t EntityStore::size() const {
+
+		return this->meshes.size();
+
+	}
+
+	void EntityStore::sort(const glm::vec3 &position, bool front_to_back, std::vector<std::pair<float, size_t>> *order) const {
+
+		order->clear();
+
+		for (size_t i = 0; i < this->visible.size(); i++) {
+
+			if (!this->visible[i])
+				continue;
+
+			// Use the distance to the nearest point of the entity, or keep the original order.
+			glm::vec3 nearest = glm::clamp(position, this->bounds_min[i], this->bounds_max[i]);
+			glm::vec3 offset = nearest - position;
+			float key = front_to_back ? glm::dot(offset, offset) : (float)i;
+
+			order->push_back(std::make_pair(key, i));
+
+		}
+
+		// Keep the entities of every class together.
+		const std::vector<unsigned int> &classes = this->classes;
+
+		std::sort(order->begin(), order->end(), [&classes](const std::pair<float, size_t> &a, const std::pair<float, size_t> &b) {
+
+			if (classes[a.second] != classes[b.second])
+				return classes[a.second] < classes[b.second];
+
+			return a < b;
+
+		});
+
+	}
+
+	void EntityStore::stage(TransformBatch &batch) {
+
+		for (size_t i = 0; i < this->visible.size(); i++) {
+
+			if (!this->visible[i])
+				continue;
+
+			size_t first = this->first_transforms[i];
+
+			for (size_t j = first; j < first + this->transform_counts[i]; j++)
+				batch.add(&this->models[j], &this->normals[j], &this->draw_indices[j]);
+
+		}
+
+	}
+
+	void EntityStore::updateVisibility(OcclusionCuller *culler) {
+
+		for (size_t i = 0; i < this->visible.size(); i++)
+			this->visible[i] = culler == nullptr || this->candidates[i] == no_candidate || culler->isVisible(this->candidates[i]);
+
+	}
+
+}  // namespace aladdin_3d
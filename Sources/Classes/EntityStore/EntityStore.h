@@ -0,0 +1,268 @@
+/**
+ * @file EntityStore.h
+ * @brief EntityStore class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+
+#ifndef ALADDIN_3D_CLASSES_ENTITYSTORE_H_
+#define ALADDIN_3D_CLASSES_ENTITYSTORE_H_
+
+#include <stddef.h>
+
+#include <utility>
+#include <vector>
+
+#include "glew/glew.h"
+#include "glm/glm.hpp"
+
+#include "Classes/OcclusionCuller/OcclusionCuller.h"
+#include "Classes/TransformBatch/TransformBatch.h"
+#include "Structs/BoundingBox/BoundingBox.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of an EntityStore class.
+	 *
+	 * Keeps the entities of the scene as a structure of arrays. Every component lives
+	 * in its own contiguous array, indexed by the entity, so that each system only
+	 * walks the components it needs in a linear pass. The meshes stay outside of the
+	 * store, and every entity only keeps the index of its own.
+	 *
+	 * The world matrices of the geometries of every entity are kept in a contiguous
+	 * range of their own arrays, together with the draw indices the transform batch
+	 * writes for them, so that staging a frame never touches the meshes. Every entity
+	 * also keeps the index of its occlusion candidate, if it has one.
+	 *
+	 * The entities are added once when the scene is built. After that, only their
+	 * visibility changes, and in its own array, so that the rest of the components can
+	 * be read from any thread.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class EntityStore {
+
+		public:
+
+			/**
+			 * @brief Adds an entity.
+			 *
+			 * Adds an entity at the end of the store. It starts visible.
+			 *
+			 * @param mesh The index of the mesh of the entity.
+			 * @param shader The index of the shader of the entity.
+			 * @param object_class The class of the entity, to profile it.
+			 * @param flags The flags of the entity.
+			 * @param bounds The world bounding box of the entity.
+			 * @param position The world position of the entity.
+			 * @param candidate The index of the occlusion candidate of the entity, or no_candidate.
+			 *
+			 * @returns The index of the new entity.
+			 */
+			size_t add(size_t mesh, unsigned int shader, unsigned int object_class, unsigned int flags,
+				const BoundingBox &bounds, const glm::vec3 &position, size_t candidate);
+
+			/**
+			 * @brief Adds a world matrix to the last entity.
+			 *
+			 * Adds the world matrix of the next geometry of the last entity added, in the
+			 * same order as the geometries of its mesh.
+			 *
+			 * @param model The world matrix of the geometry.
+			 * @param normal The world normal matrix of the geometry.
+			 */
+			void addTransform(const glm::mat4 &model, const glm::mat4 &normal);
+
+			/**
+			 * @brief Removes every entity.
+			 *
+			 * Removes every entity, keeping the memory of the arrays.
+			 */
+			void clear();
+
+			/**
+			 * @brief Gets the world bounding box of an entity.
+			 *
+			 * Gets the world bounding box of an entity.
+			 *
+			 * @param entity The index of the entity.
+			 *
+			 * @returns The bounding box.
+			 */
+			BoundingBox getBounds(size_t entity) const;
+
+			/**
+			 * @brief Gets the class of an entity.
+			 *
+			 * Gets the class of an entity.
+			 *
+			 * @param entity The index of the entity.
+			 *
+			 * @returns The class.
+			 */
+			unsigned int getClass(size_t entity) const;
+
+			/**
+			 * @brief Gets the memory used on the CPU.
+			 *
+			 * Gets the bytes reserved by the component arrays.
+			 *
+			 * @returns The number of bytes.
+			 */
+			size_t getCPUBytes() const;
+
+			/**
+			 * @brief Gets the draw indices of an entity.
+			 *
+			 * Gets the draw indices of the geometries of an entity, as written by the last
+			 * staged batch.
+			 *
+			 * @param entity The index of the entity.
+			 *
+			 * @returns The draw index of every geometry.
+			 */
+			const GLint *getDrawIndices(size_t entity) const;
+
+			/**
+			 * @brief Gets the flags of an entity.
+			 *
+			 * Gets the flags of an entity.
+			 *
+			 * @param entity The index of the entity.
+			 *
+			 * @returns The flags.
+			 */
+			unsigned int getFlags(size_t entity) const;
+
+			/**
+			 * @brief Gets the mesh of an entity.
+			 *
+			 * Gets the index of the mesh of an entity.
+			 *
+			 * @param entity The index of the entity.
+			 *
+			 * @returns The index of the mesh.
+			 */
+			size_t getMesh(size_t entity) const;
+
+			/**
+			 * @brief Gets the position of an entity.
+			 *
+			 * Gets the world position of an entity.
+			 *
+			 * @param entity The index of the entity.
+			 *
+			 * @returns The position.
+			 */
+			glm::vec3 getPosition(size_t entity) const;
+
+			/**
+			 * @brief Gets the shader of an entity.
+			 *
+			 * Gets the index of the shader of an entity.
+			 *
+			 * @param entity The index of the entity.
+			 *
+			 * @returns The index of the shader.
+			 */
+			unsigned int getShader(size_t entity) const;
+
+			/**
+			 * @brief Checks if an entity is visible.
+			 *
+			 * Checks if an entity was visible when the visibility was last updated.
+			 *
+			 * @param entity The index of the entity.
+			 *
+			 * @returns True if the entity is visible.
+			 */
+			bool isVisible(size_t entity) const;
+
+			/**
+			 * @brief Reserves memory for a number of entities.
+			 *
+			 * Reserves every array for a number of entities.
+			 *
+			 * @param count The number of entities.
+			 */
+			void reserve(size_t count);
+
+			/**
+			 * @brief Gets the number of entities.
+			 *
+			 * Gets the number of entities in the store.
+			 *
+			 * @returns The number of entities.
+			 */
+			size_t size() const;
+
+			/**
+			 * @brief Sorts the visible entities.
+			 *
+			 * Fills an order with the visible entities, keeping the entities of every class
+			 * together. Inside a class they go front to back, by the distance from a
+			 * position to the nearest point of their bounds, or in the order they were added.
+			 *
+			 * @param position The position to sort from.
+			 * @param front_to_back Whether to sort front to back or keep the original order.
+			 * @param order Outputs the sorting key and the index of every visible entity.
+			 */
+			void sort(const glm::vec3 &position, bool front_to_back, std::vector<std::pair<float, size_t>> *order) const;
+
+			/**
+			 * @brief Stages the visible entities.
+			 *
+			 * Adds the world matrices of every visible entity to a batch, which writes
+			 * their draw indices back into the store when it is computed.
+			 *
+			 * @param batch The batch of the frame.
+			 */
+			void stage(TransformBatch &batch);
+
+			/**
+			 * @brief Updates the visibility of the entities.
+			 *
+			 * Copies the results of the culler into the visibility of the entities with an
+			 * occlusion candidate. The rest of the entities are always visible.
+			 *
+			 * @param culler The culler, or null to make every entity visible.
+			 */
+			void updateVisibility(OcclusionCuller *culler);
+
+			static const unsigned int in_world = 1;		/// Flag of the entities that move with the world.
+			static const unsigned int obstacle = 2;		/// Flag of the entities the character can hit.
+			static const size_t no_candidate = (size_t)-1;	/// Candidate of the entities that are never culled.
+
+		private:
+
+			std::vector<size_t> meshes;					/// Mesh of every entity.
+			std::vector<unsigned int> shaders;			/// Shader of every entity.
+			std::vector<unsigned int> classes;			/// Class of every entity.
+			std::vector<unsigned int> flags;			/// Flags of every entity.
+			std::vector<glm::vec3> bounds_min;			/// Minimum corner of the world bounds of every entity.
+			std::vector<glm::vec3> bounds_max;			/// Maximum corner of the world bounds of every entity.
+			std::vector<glm::vec3> positions;			/// World position of every entity.
+			std::vector<size_t> candidates;				/// Occlusion candidate of every entity.
+			std::vector<size_t> first_transforms;		/// First world matrix of every entity.
+			std::vector<size_t> transform_counts;		/// Number of world matrices of every entity.
+			std::vector<unsigned char> visible;			/// Whether every entity is visible this frame.
+
+			std::vector<glm::mat4> models;				/// World matrix of every geometry.
+			std::vector<glm::mat4> normals;				/// World normal matrix of every geometry.
+			std::vector<GLint> draw_indices;			/// Draw index of every geometry.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_ENTITYSTORE_H_
@@ -0,0 +1,282 @@
+/**
+ * @file FlowField.cpp
+ * @brief FlowField class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "FlowField.h"
+
+#include <math.h>
+#include <stddef.h>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "glm/glm.hpp"
+
+#include "Classes/ThreadPool/ThreadPool.h"
+#include "Structs/BoundingBox/BoundingBox.h"
+
+namespace aladdin_3d {
+
+	FlowField::FlowField() {}
+
+	FlowField::FlowField(const glm::vec2 &min, const glm::vec2 &max, float cell_size, float segment_length) {
+
+		this->origin = min;
+		this->cell_size = cell_size;
+		this->columns = (size_t)std::max(1.0f, ceilf((max.x - min.x) / cell_size));
+		this->rows = (size_t)std::max(1.0f, ceilf((max.y - min.y) / cell_size));
+		this->segment_rows = (size_t)std::max(1.0f, roundf(segment_length / cell_size));
+
+		size_t cells = this->columns * this->rows;
+		this->blocked = std::vector<unsigned char>(cells, 0);
+		this->costs = std::vector<float>(cells, 0.0f);
+		this->directions = std::vector<glm::vec2>(cells, glm::vec2(0.0f, 1.0f));
+
+	}
+
+	void FlowField::addObstacle(const BoundingBox &bounds, float margin) {
+
+		// Find the cells that overlap the grown obstacle.
+		long first_column = (long)floorf((bounds.min.x - margin - this->origin.x) / this->cell_size);
+		long last_column = (long)ceilf((bounds.max.x + margin - this->origin.x) / this->cell_size) - 1;
+		long first_row = (long)floorf((bounds.min.z - margin - this->origin.y) / this->cell_size);
+		long last_row = (long)ceilf((bounds.max.z + margin - this->origin.y) / this->cell_size) - 1;
+
+		first_column = std::max(first_column, 0l);
+		last_column = std::min(last_column, (long)this->columns - 1);
+		first_row = std::max(first_row, 0l);
+		last_row = std::min(last_row, (long)this->rows - 1);
+
+		for (long row = first_row; row <= last_row; row++) {
+
+			for (long column = first_column; column <= last_column; column++)
+				this->blocked[row * this->columns + column] = 1;
+
+		}
+
+	}
+
+	void FlowField::build(ThreadPool &pool) {
+
+		// The segments do not share any cell, so they can be solved at the same time.
+		pool.run(this->getSegmentCount(), [this](size_t segment) {
+
+			this->buildSegment(segment);
+
+		});
+
+	}
+
+	void FlowField::buildSegment(size_t segment) {
+
+		const float infinity = std::numeric_limits<float>::infinity();
+		const float diagonal = sqrtf(2.0f);
+		const long columns = (long)this->columns;
+
+		long first_row = (long)(segment * this->segment_rows);
+		long last_row = std::min(first_row + (long)this->segment_rows, (long)this->rows) - 1;
+
+		// Moving to a diagonal neighbour must not cut the corner of a blocked cell.
+		auto canMove = [this, columns](long column, long row, long d_column, long d_row) {
+
+			if (this->blocked[(row + d_row) * columns + column + d_column])
+				return false;
+
+			if (d_column != 0 && d_row != 0)
+				return !this->blocked[row * columns + column + d_column] && !this->blocked[(row + d_row) * columns + column];
+
+			return true;
+
+		};
+
+		for (long cell = first_row * columns; cell < (last_row + 1) * columns; cell++)
+			this->costs[cell] = infinity;
+
+		// Every free cell of the last row is a goal.
+		typedef std::pair<float, long> Entry;
+		std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+
+		for (long column = 0; column < columns; column++) {
+
+			long cell = last_row * columns + column;
+
+			if (!this->blocked[cell]) {
+
+				this->costs[cell] = 0.0f;
+				open.push(Entry(0.0f, cell));
+
+			}
+
+		}
+
+		// Spread the cost backwards from the goals.
+		while (!open.empty()) {
+
+			Entry entry = open.top();
+			open.pop();
+
+			if (entry.first > this->costs[entry.second])
+				continue;
+
+			long column = entry.second % columns;
+			long row = entry.second / columns;
+
+			for (long d_row = -1; d_row <= 1; d_row++) {
+
+				for (long d_column = -1; d_column <= 1; d_column++) {
+
+					if ((d_row == 0 && d_column == 0) || column + d_column < 0 || column + d_column >= columns ||
+						row + d_row < first_row || row + d_row > last_row || !canMove(column, row, d_column, d_row))
+						continue;
+
+					long neighbour = (row + d_row) * columns + column + d_column;
+					float cost = entry.first + (d_row != 0 && d_column != 0 ? diagonal : 1.0f);
+
+					if (cost < this->costs[neighbour]) {
+
+						this->costs[neighbour] = cost;
+						open.push(Entry(cost, neighbour));
+
+					}
+
+				}
+
+			}
+
+		}
+
+		// Point every cell to its cheapest neighbour. The goals lead into the next segment,
+		// and the cells with no way out lead straight forward.
+		for (long row = first_row; row <= last_row; row++) {
+
+			for (long column = 0; column < columns; column++) {
+
+				long cell = row * columns + column;
+				glm::vec2 direction(0.0f, 1.0f);
+
+				if (row != last_row || this->blocked[cell]) {
+
+					float best = this->blocked[cell] ? infinity : this->costs[cell];
+
+					for (long d_row = -1; d_row <= 1; d_row++) {
+
+						for (long d_column = -1; d_column <= 1; d_column++) {
+
+							if ((d_row == 0 && d_column == 0) || column + d_column < 0 || column + d_column >= columns ||
+								row + d_row < first_row || row + d_row > last_row)
+								continue;
+
+							// The blocked cells only need a way out to a free neighbour.
+							if (!this->blocked[cell] && !canMove(column, row, d_column, d_row))
+								continue;
+
+							long neighbour = (row + d_row) * columns + column + d_column;
+
+							if (!this->blocked[neighbour] && this->costs[neighbour] < best) {
+
+								best = this->costs[neighbour];
+								direction = glm::normalize(glm::vec2((float)d_column, (float)d_row));
+
+							}
+
+						}
+
+					}
+
+				}
+
+				this->directions[cell] = direction;
+
+			}
+
+		}
+
+	}
+
+	void FlowField::clearObstacles() {
+
+		std::fill(this->blocked.begin(), this->blocked.end(), 0);
+
+	}
+
+	size_t FlowField::getCellCount() const {
+
+		return this->blocked.size();
+
+	}
+
+	bool FlowField::getCell(const glm::vec3 &position, long *column, long *row) const {
+
+		*column = (long)floorf((position.x - this->origin.x) / this->cell_size);
+		*row = (long)floorf((position.z - this->origin.y) / this->cell_size);
+
+		return *column >= 0 && *column < (long)this->columns && *row >= 0 && *row < (long)this->rows;
+
+	}
+
+	size_t FlowField::getCPUBytes() const {
+
+		return sizeof(FlowField) + this->blocked.capacity() * sizeof(unsigned char) +
+			this->costs.capacity() * sizeof(float) + this->directions.capacity() * sizeof(glm::vec2);
+
+	}
+
+	glm::vec2 FlowField::getDirection(const glm::vec3 &position) const {
+
+		long column = 0;
+		long row = 0;
+
+		if (this->rows == 0)
+			return glm::vec2(0.0f, 1.0f);
+
+		// Off the sides, the closest column leads the way.
+		this->getCell(position, &column, &row);
+		column = std::min(std::max(column, 0l), (long)this->columns - 1);
+
+		if (row < 0 || row >= (long)this->rows)
+			return glm::vec2(0.0f, 1.0f);
+
+		return this->directions[row * this->columns + column];
+
+	}
+
+	size_t FlowField::getSegmentCount() const {
+
+		return (this->rows + this->segment_rows - 1) / this->segment_rows;
+
+	}
+
+	bool FlowField::isBlocked(const glm::vec3 &position) const {
+
+		long column = 0;
+		long row = 0;
+
+		if (this->rows == 0)
+			return false;
+
+		bool inside = this->getCell(position, &column, &row);
+
+		// In front of or behind the field there is nothing in the way.
+		if (row < 0 || row >= (long)this->rows)
+			return false;
+
+		return !inside || this->blocked[row * this->columns + column];
+
+	}
+
+}  // namespace aladdin_3d
@@ -0,0 +1,183 @@
+/**
+ * @file FlowField.h
+ * @brief FlowField class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_FLOWFIELD_H_
+#define ALADDIN_3D_CLASSES_FLOWFIELD_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "glm/glm.hpp"
+
+#include "Classes/ThreadPool/ThreadPool.h"
+#include "Structs/BoundingBox/BoundingBox.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of a FlowField class.
+	 *
+	 * Covers the floor of the corridor with a grid of square cells and stores, for
+	 * every cell, the direction of the shortest way forward around the obstacles. The
+	 * corridor is split in segments along Z, and the goal of every segment is its last
+	 * row, so each segment is solved on its own with a Dijkstra pass over the eight
+	 * neighbours of every cell. The segments are solved in parallel.
+	 *
+	 * The field only changes when it is built again, after the obstacles change. Any
+	 * number of agents can then look their direction up in constant time.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class FlowField {
+
+		public:
+
+			/**
+			 * @brief Constructs an empty field.
+			 *
+			 * Constructs a field without cells. Every position leads straight forward.
+			 */
+			FlowField();
+
+			/**
+			 * @brief Constructs a field.
+			 *
+			 * Constructs a field over a rectangle of the floor, without obstacles.
+			 *
+			 * @param min The corner of the rectangle with the lowest X and Z.
+			 * @param max The corner of the rectangle with the highest X and Z.
+			 * @param cell_size The size of the cells.
+			 * @param segment_length The length of the segments along Z.
+			 */
+			FlowField(const glm::vec2 &min, const glm::vec2 &max, float cell_size, float segment_length);
+
+			/**
+			 * @brief Adds an obstacle.
+			 *
+			 * Blocks the cells under an obstacle, grown by a margin so that the agents
+			 * do not brush it. The field has to be built again afterwards.
+			 *
+			 * @param bounds The world bounding box of the obstacle.
+			 * @param margin The distance the agents keep from it.
+			 */
+			void addObstacle(const BoundingBox &bounds, float margin);
+
+			/**
+			 * @brief Builds the field.
+			 *
+			 * Computes the cost to the end of its segment and the direction of every cell,
+			 * one segment per job.
+			 *
+			 * @param pool The workers to share the segments with.
+			 */
+			void build(ThreadPool &pool);
+
+			/**
+			 * @brief Removes every obstacle.
+			 *
+			 * Unblocks every cell. The field has to be built again afterwards.
+			 */
+			void clearObstacles();
+
+			/**
+			 * @brief Get the number of cells.
+			 *
+			 * Get the number of cells of the field.
+			 *
+			 * @returns The number of cells.
+			 */
+			size_t getCellCount() const;
+
+			/**
+			 * @brief Gets the memory used on the CPU.
+			 *
+			 * Gets the bytes used by the cells in main memory.
+			 *
+			 * @returns The number of bytes.
+			 */
+			size_t getCPUBytes() const;
+
+			/**
+			 * @brief Gets the direction at a position.
+			 *
+			 * Gets the direction to follow from a position, on the XZ plane. The positions
+			 * in front of or behind the field lead straight forward.
+			 *
+			 * @param position The world position.
+			 *
+			 * @returns The unit direction, with X in x and Z in y.
+			 */
+			glm::vec2 getDirection(const glm::vec3 &position) const;
+
+			/**
+			 * @brief Get the number of segments.
+			 *
+			 * Get the number of segments the field is split in.
+			 *
+			 * @returns The number of segments.
+			 */
+			size_t getSegmentCount() const;
+
+			/**
+			 * @brief Checks if a position is blocked.
+			 *
+			 * Checks if a position is on a blocked cell or off the sides of the field.
+			 *
+			 * @param position The world position.
+			 *
+			 * @returns True if the agents cannot stand there.
+			 */
+			bool isBlocked(const glm::vec3 &position) const;
+
+		private:
+
+			/**
+			 * @brief Builds a segment.
+			 *
+			 * Spreads the cost from the free cells of the last row of a segment to the rest
+			 * of it, and points every cell to its cheapest neighbour.
+			 *
+			 * @param segment The index of the segment.
+			 */
+			void buildSegment(size_t segment);
+
+			/**
+			 * @brief Gets the cell of a position.
+			 *
+			 * Gets the cell under a position.
+			 *
+			 * @param position The world position.
+			 * @param column Outputs the column of the cell.
+			 * @param row Outputs the row of the cell.
+			 *
+			 * @returns True if the position is over the field.
+			 */
+			bool getCell(const glm::vec3 &position, long *column, long *row) const;
+
+			glm::vec2 origin = glm::vec2(0.0f);		/// Corner of the field with the lowest X and Z.
+			float cell_size = 1.0f;					/// Size of the cells.
+			size_t columns = 0;						/// Number of cells along X.
+			size_t rows = 0;						/// Number of cells along Z.
+			size_t segment_rows = 1;				/// Number of rows of every segment.
+			std::vector<unsigned char> blocked;		/// Whether every cell is blocked.
+			std::vector<float> costs;				/// Cost from every cell to the end of its segment.
+			std::vector<glm::vec2> directions;		/// Direction to follow from every cell.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_FLOWFIELD_H_
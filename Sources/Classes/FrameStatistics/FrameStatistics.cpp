@@ -0,0 +1,187 @@
+/**
+ * @file FrameStatistics.cpp
+ * @brief FrameStatistics class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "FrameStatistics.h"
+
+#include <string.h>
+
+#include <chrono>
+
+#include "glew/glew.h"
+
+#include "Classes/AllocationCounter/AllocationCounter.h"
+
+namespace aladdin_3d {
+
+	void FrameStatistics::beginFrame() {
+
+		// Create the queries the first time.
+		if (!this->created) {
+
+			glGenQueries(regions, this->time_queries);
+
+			// The pipeline statistics are not in the GLEW headers, so look for the extension.
+			GLint extensions = 0;
+			glGetIntegerv(GL_NUM_EXTENSIONS, &extensions);
+
+			for (GLint i = 0; i < extensions && !this->fragments; i++) {
+
+				const char *name = (const char*)glGetStringi(GL_EXTENSIONS, i);
+				this->fragments = strcmp(name, "GL_ARB_pipeline_statistics_query") == 0;
+
+			}
+
+			if (this->fragments)
+				glGenQueries(regions, this->fragment_queries);
+
+			this->created = true;
+			this->last_frame = std::chrono::steady_clock::now();
+
+		} else {
+
+			// Count the CPU time since the last frame.
+			auto now = std::chrono::steady_clock::now();
+			this->cpu_time += std::chrono::duration<double, std::milli>(now - this->last_frame).count();
+			this->cpu_frames++;
+			this->last_frame = now;
+
+		}
+
+		// Move to the next region and collect what it measured last time.
+		this->region = (this->region + 1) % regions;
+		this->collect(this->region);
+
+		// Start measuring.
+		this->frame_allocations = AllocationCounter::getCount();
+		glBeginQuery(GL_TIME_ELAPSED, this->time_queries[this->region]);
+
+		if (this->fragments)
+			glBeginQuery(GL_FRAGMENT_SHADER_INVOCATIONS_ARB, this->fragment_queries[this->region]);
+
+	}
+
+	void FrameStatistics::collect(GLuint region) {
+
+		if (!this->pending[region])
+			return;
+
+		this->pending[region] = false;
+
+		// Several frames went by, so the results should be there already.
+		GLuint64 time = 0;
+		glGetQueryObjectui64v(this->time_queries[region], GL_QUERY_RESULT, &time);
+
+		GLuint64 count = 0;
+		if (this->fragments)
+			glGetQueryObjectui64v(this->fragment_queries[region], GL_QUERY_RESULT, &count);
+
+		// Skip the frames measured before the last reset.
+		if (this->query_windows[region] != this->window)
+			return;
+
+		this->gpu_time += time / 1000000.0;
+		this->fragment_count += (double)count;
+		this->frames++;
+
+	}
+
+	void FrameStatistics::endFrame() {
+
+		glEndQuery(GL_TIME_ELAPSED);
+
+		if (this->fragments)
+			glEndQuery(GL_FRAGMENT_SHADER_INVOCATIONS_ARB);
+
+		this->pending[this->region] = true;
+		this->query_windows[this->region] = this->window;
+
+		// The allocations are known right away.
+		this->last_allocations = AllocationCounter::getCount() - this->frame_allocations;
+		this->allocation_count += (double)this->last_allocations;
+		this->allocation_frames++;
+
+	}
+
+	double FrameStatistics::getAverageCPUTime() {
+
+		return this->cpu_frames > 0 ? this->cpu_time / this->cpu_frames : 0.0;
+
+	}
+
+	double FrameStatistics::getAverageAllocations() {
+
+		return this->allocation_frames > 0 ? this->allocation_count / this->allocation_frames : 0.0;
+
+	}
+
+	double FrameStatistics::getAverageFragments() {
+
+		return this->frames > 0 ? this->fragment_count / this->frames : 0.0;
+
+	}
+
+	double FrameStatistics::getAverageGPUTime() {
+
+		return this->frames > 0 ? this->gpu_time / this->frames : 0.0;
+
+	}
+
+	unsigned long FrameStatistics::getFrames() {
+
+		return this->frames;
+
+	}
+
+	unsigned long FrameStatistics::getLastAllocations() {
+
+		return this->last_allocations;
+
+	}
+
+	bool FrameStatistics::hasFragments() {
+
+		return this->fragments;
+
+	}
+
+	void FrameStatistics::remove() {
+
+		if (!this->created)
+			return;
+
+		glDeleteQueries(regions, this->time_queries);
+
+		if (this->fragments)
+			glDeleteQueries(regions, this->fragment_queries);
+
+		this->created = false;
+
+	}
+
+	void FrameStatistics::reset() {
+
+		this->window++;
+		this->frames = 0;
+		this->cpu_frames = 0;
+		this->gpu_time = 0.0;
+		this->cpu_time = 0.0;
+		this->fragment_count = 0.0;
+		this->allocation_frames = 0;
+		this->allocation_count = 0.0;
+		this->last_frame = std::chrono::steady_clock::now();
+
+	}
+
+}  // namespace aladdin_3d
@@ -0,0 +1,171 @@
+/**
+ * @file FrameStatistics.h
+ * @brief FrameStatistics class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_FRAMESTATISTICS_H_
+#define ALADDIN_3D_CLASSES_FRAMESTATISTICS_H_
+
+#include <chrono>
+
+#include "glew/glew.h"
+
+#ifndef GL_FRAGMENT_SHADER_INVOCATIONS_ARB
+#define GL_FRAGMENT_SHADER_INVOCATIONS_ARB 0x82F4
+#endif
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of a FrameStatistics class.
+	 *
+	 * Measures the GPU time, the CPU time, the heap allocations and, when
+	 * ARB_pipeline_statistics_query is available, the fragment shader invocations of
+	 * every frame, and averages them since the last reset. The queries are read a few frames later so that reading
+	 * them never stalls the pipeline.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class FrameStatistics {
+
+		public:
+
+			/**
+			 * @brief Starts measuring a frame.
+			 *
+			 * Collects the results of an old frame and starts the queries of this one.
+			 * The queries are created the first time.
+			 */
+			void beginFrame();
+
+			/**
+			 * @brief Stops measuring a frame.
+			 *
+			 * Ends the queries of the current frame.
+			 */
+			void endFrame();
+
+			/**
+			 * @brief Get the average CPU time.
+			 *
+			 * Get the average time between the start of consecutive frames.
+			 *
+			 * @returns The average CPU time in milliseconds.
+			 */
+			double getAverageCPUTime();
+
+			/**
+			 * @brief Get the average heap allocations.
+			 *
+			 * Get the average number of heap allocations made by the render thread per frame.
+			 *
+			 * @returns The average allocations.
+			 */
+			double getAverageAllocations();
+
+			/**
+			 * @brief Get the average fragment shader invocations.
+			 *
+			 * Get the average number of fragment shader invocations per frame.
+			 *
+			 * @returns The average invocations, or 0 if they cannot be measured.
+			 */
+			double getAverageFragments();
+
+			/**
+			 * @brief Get the average GPU time.
+			 *
+			 * Get the average GPU time per frame.
+			 *
+			 * @returns The average GPU time in milliseconds.
+			 */
+			double getAverageGPUTime();
+
+			/**
+			 * @brief Get the number of measured frames.
+			 *
+			 * Get the number of frames measured since the last reset.
+			 *
+			 * @returns The number of frames.
+			 */
+			unsigned long getFrames();
+
+			/**
+			 * @brief Get the heap allocations of the last frame.
+			 *
+			 * Get the number of heap allocations made by the render thread in the last frame.
+			 *
+			 * @returns The allocations.
+			 */
+			unsigned long getLastAllocations();
+
+			/**
+			 * @brief Checks if the fragment shader invocations are measured.
+			 *
+			 * Checks if the context supports ARB_pipeline_statistics_query.
+			 *
+			 * @returns True if the fragment shader invocations are measured.
+			 */
+			bool hasFragments();
+
+			/**
+			 * @brief Removes the queries from OpenGL.
+			 *
+			 * Removes the queries from OpenGL.
+			 */
+			void remove();
+
+			/**
+			 * @brief Starts a new measurement.
+			 *
+			 * Forgets everything measured so far. Frames still in flight are not counted.
+			 */
+			void reset();
+
+			static const GLuint regions = 3;	/// Number of frames in flight.
+
+		private:
+
+			/**
+			 * @brief Collects the results of a region.
+			 *
+			 * Reads the queries of a region and adds them to the totals.
+			 *
+			 * @param region The index of the region.
+			 */
+			void collect(GLuint region);
+
+			GLuint time_queries[regions] = {};			/// GPU time queries.
+			GLuint fragment_queries[regions] = {};		/// Fragment shader invocation queries.
+			unsigned long query_windows[regions] = {};	/// Measurement each region belongs to.
+			bool pending[regions] = {};					/// Whether each region has results to read.
+			GLuint region = 0;							/// Region being measured.
+			bool created = false;						/// Whether the queries were created.
+			bool fragments = false;						/// Whether the fragment invocations are measured.
+			unsigned long window = 0;					/// Current measurement.
+			unsigned long frames = 0;					/// Frames with GPU results.
+			unsigned long cpu_frames = 0;				/// Frames with CPU results.
+			double gpu_time = 0.0;						/// Total GPU time in milliseconds.
+			double cpu_time = 0.0;						/// Total CPU time in milliseconds.
+			double fragment_count = 0.0;				/// Total fragment shader invocations.
+			unsigned long frame_allocations = 0;		/// Allocations made before the current frame.
+			unsigned long last_allocations = 0;			/// Allocations made in the last frame.
+			unsigned long allocation_frames = 0;		/// Frames with allocation results.
+			double allocation_count = 0.0;				/// Total heap allocations.
+			std::chrono::steady_clock::time_point last_frame;	/// Start of the last frame.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_FRAMESTATISTICS_H_
@@ -0,0 +1,122 @@
+/**
+ * @file GLHandle.cpp
+ * @brief GLHandle class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "GLHandle.h"
+
+#include <stddef.h>
+
+#include "glew/glew.h"
+
+#include "Classes/ResourceTracker/ResourceTracker.h"
+
+namespace aladdin_3d {
+
+	GLHandle::GLHandle() {}
+
+	GLHandle::GLHandle(GLuint name, unsigned int type, size_t bytes) {
+
+		this->name = name;
+		this->type = type;
+		this->bytes = bytes;
+
+		if (this->name != 0)
+			ResourceTracker::add(this->type, this->bytes);
+
+	}
+
+	GLHandle::GLHandle(GLHandle &&other) noexcept {
+
+		this->name = other.name;
+		this->type = other.type;
+		this->bytes = other.bytes;
+
+		other.name = 0;
+		other.bytes = 0;
+
+	}
+
+	GLHandle::~GLHandle() {
+
+		this->reset();
+
+	}
+
+	GLHandle &GLHandle::operator=(GLHandle &&other) noexcept {
+
+		if (this != &other) {
+
+			this->reset();
+
+			this->name = other.name;
+			this->type = other.type;
+			this->bytes = other.bytes;
+
+			other.name = 0;
+			other.bytes = 0;
+
+		}
+
+		return *this;
+
+	}
+
+	GLuint GLHandle::get() const {
+
+		return this->name;
+
+	}
+
+	void GLHandle::reset() {
+
+		if (this->name == 0)
+			return;
+
+		switch (this->type) {
+
+			case ResourceTracker::vertex_arrays:
+				glDeleteVertexArrays(1, &this->name);
+				break;
+
+			case ResourceTracker::buffers:
+				glDeleteBuffers(1, &this->name);
+				break;
+
+			case ResourceTracker::textures:
+				glDeleteTextures(1, &this->name);
+				break;
+
+			case ResourceTracker::programs:
+				glDeleteProgram(this->name);
+				break;
+
+		}
+
+		ResourceTracker::remove(this->type, this->bytes);
+
+		this->name = 0;
+		this->bytes = 0;
+
+	}
+
+	void GLHandle::setBytes(size_t bytes) {
+
+		if (this->name != 0)
+			ResourceTracker::resize(this->type, this->bytes, bytes);
+
+		this->bytes = bytes;
+
+	}
+
+}  // namespace aladdin_3d
@@ -0,0 +1,128 @@
+/**
+ * @file GLHandle.h
+ * @brief GLHandle class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_GLHANDLE_H_
+#define ALADDIN_3D_CLASSES_GLHANDLE_H_
+
+#include <stddef.h>
+
+#include "glew/glew.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of a GLHandle class.
+	 *
+	 * Owns the name of an OpenGL object and deletes it when the handle is reset or
+	 * destroyed, so every object is freed exactly once and at a known point. Handles
+	 * cannot be copied, only moved, which hands the object over and leaves the old
+	 * handle empty. An object that has to be used from several places is shared by
+	 * holding its wrapper in a std::shared_ptr instead.
+	 *
+	 * Every live handle is counted by the ResourceTracker together with the bytes of
+	 * its storage. Handles have to be released while the OpenGL context still exists.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class GLHandle {
+
+		public:
+
+			/**
+			 * @brief Constructs an empty handle.
+			 *
+			 * Constructs a handle that owns nothing.
+			 */
+			GLHandle();
+
+			/**
+			 * @brief Takes an OpenGL object.
+			 *
+			 * Takes ownership of an OpenGL object that has just been generated.
+			 *
+			 * @param name The OpenGL name of the object.
+			 * @param type The ResourceTracker type of the object.
+			 * @param bytes The bytes of its storage, if already known.
+			 */
+			GLHandle(GLuint name, unsigned int type, size_t bytes = 0);
+
+			/**
+			 * @brief Takes the object of another handle.
+			 *
+			 * Takes the object of another handle, leaving it empty.
+			 *
+			 * @param other The handle to take the object from.
+			 */
+			GLHandle(GLHandle &&other) noexcept;
+
+			/**
+			 * @brief Frees the object.
+			 *
+			 * Deletes the OpenGL object, if any.
+			 */
+			~GLHandle();
+
+			GLHandle(const GLHandle&) = delete;
+			GLHandle &operator=(const GLHandle&) = delete;
+
+			/**
+			 * @brief Takes the object of another handle.
+			 *
+			 * Deletes the current object, if any, and takes the one of another handle,
+			 * leaving it empty.
+			 *
+			 * @param other The handle to take the object from.
+			 *
+			 * @returns This handle.
+			 */
+			GLHandle &operator=(GLHandle &&other) noexcept;
+
+			/**
+			 * @brief Gets the OpenGL name.
+			 *
+			 * Gets the OpenGL name of the object, or 0 if the handle is empty.
+			 *
+			 * @returns The OpenGL name.
+			 */
+			GLuint get() const;
+
+			/**
+			 * @brief Frees the object.
+			 *
+			 * Deletes the OpenGL object, if any, and leaves the handle empty. It can be
+			 * called any number of times.
+			 */
+			void reset();
+
+			/**
+			 * @brief Sets the bytes of the storage.
+			 *
+			 * Sets the bytes of the storage of the object once they are known.
+			 *
+			 * @param bytes The number of bytes.
+			 */
+			void setBytes(size_t bytes);
+
+		private:
+
+			GLuint name = 0;		/// OpenGL name of the object, 0 if empty.
+			unsigned int type = 0;	/// ResourceTracker type of the object.
+			size_t bytes = 0;		/// Bytes of the storage of the object.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_GLHANDLE_H_
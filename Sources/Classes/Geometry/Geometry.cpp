@@ -15,180 +15,350 @@
 
 #include "Geometry.h"
 
+#include <math.h>
+
+#include <memory>
 #include <vector>
 #include <stdexcept>
 
 #include "glew/glew.h"
 #include "glm/glm.hpp"
+#include "glm/gtc/quaternion.hpp"
 #include "glm/gtc/type_ptr.hpp"
 
+#include "Classes/BatchMaths/BatchMaths.h"
 #include "Classes/Camera/Camera.h"
-#include "Classes/EBO/EBO.h"
+#include "Classes/MeshAsset/MeshAsset.h"
 #include "Classes/Shader/Shader.h"
 #include "Classes/Texture/Texture.h"
+#include "Classes/TransformBatch/TransformBatch.h"
 #include "Classes/VAO/VAO.h"
 #include "Structs/Vertex/Vertex.h"
 #include "Structs/BoundingBox/BoundingBox.h"
+#include "Structs/BoundingSphere/BoundingSphere.h"
 
 namespace aladdin_3d {
 
-	Geometry::Geometry(const std::vector<Vertex> &vertices, const std::vector<GLuint> &indices, const std::vector<Texture> &textures) {
+	unsigned long Geometry::draw_calls = 0;
+	unsigned long Geometry::triangles = 0;
+
+	Geometry::Geometry(const std::vector<Vertex> &vertices, const std::vector<GLuint> &indices, const std::vector<std::shared_ptr<Texture>> &textures) {
+
+		// Upload the mesh, every copy of this geometry will share it.
+		this->mesh = std::make_shared<MeshAsset>(vertices, indices, textures);
+
+	}
+
+	Geometry::Geometry(const std::shared_ptr<MeshAsset> &mesh) {
+
+		this->mesh = mesh;
 
-		// Store a copy of these in the attributes.
-		this->vertices = vertices;
-		this->indices = indices;
-		this->textures = textures;
+	}
 
-		// Generate a VAO and bind it, generate a VBO for the vertices and a EBO for the indices.
-		this->vao.bind();
-		VBO vbo(vertices);
-		EBO ebo(indices);
+	const std::vector<GLuint> &Geometry::getIndices() const {
 
-		// Links VBO attributes such as coordinates and colors to VAO.
-		vao.link_attribute(vbo, 0, 3, GL_FLOAT, sizeof(aladdin_3d::Vertex), (void*)0);
-		vao.link_attribute(vbo, 1, 3, GL_FLOAT, sizeof(aladdin_3d::Vertex), (void*)(3 * sizeof(float)));
-		vao.link_attribute(vbo, 2, 3, GL_FLOAT, sizeof(aladdin_3d::Vertex), (void*)(6 * sizeof(float)));
-		vao.link_attribute(vbo, 3, 2, GL_FLOAT, sizeof(aladdin_3d::Vertex), (void*)(9 * sizeof(float)));
-		
-		vao.unbind();
-		vbo.unbind();
-		ebo.unbind();
+		return this->mesh->getIndices();
 
 	}
 
-	std::vector<GLuint> Geometry::getIndices() {
+	const std::shared_ptr<MeshAsset> &Geometry::getMesh() const {
 
-		return this->indices;
+		return this->mesh;
 
 	}
 
-	std::vector<Texture>  Geometry::getTextures() {
+	const std::vector<std::shared_ptr<Texture>> &Geometry::getTextures() const {
 
-		return this->textures;
+		return this->mesh->getTextures();
 
 	}
 
-	VAO Geometry::getVAO() {
+	VAO &Geometry::getVAO() {
 
-		return this->vao;
+		return this->mesh->getVAO();
 
 	}
 
-	std::vector<Vertex> Geometry::getVertices() {
+	const std::vector<Vertex> &Geometry::getVertices() const {
 
-		return this->vertices;
+		return this->mesh->getVertices();
 
 	}
 
-	void Geometry::draw(Shader &shader, Camera &camera) {
+	void Geometry::draw(Shader &shader) {
+
+		this->draw(shader, this->draw_index);
+
+	}
 
-		// Activate the VAO and the shader to access the uniforms.
+	void Geometry::draw(Shader &shader, GLint draw_index) {
+
+		// Activate the shader to access the uniforms, and the mesh with its textures.
 		shader.activate();
-		vao.bind();
+		this->mesh->bind(shader);
 
-		for (size_t i = 0; i < textures.size(); i++) {
+		// Tell the shader where its matrices are in the stream buffer.
+		shader.passDrawIndex(draw_index);
 
-			std::string name = textures[i].getName();
-			std::string id = "";
-			
-			shader.passTexture(textures[i]);
-			textures[i].bind();
+		// Draw the actual Geometry
+		GLsizei index_count = this->mesh->getIndexCount();
+		glDrawElements(GL_TRIANGLES, index_count, GL_UNSIGNED_INT, 0);
 
-		}
+		draw_calls++;
+		triangles += index_count / 3;
 
-		// Pass the camera to the shader.
-		shader.passCamera(camera);
+	}
+
+	void Geometry::drawDepth(Shader &shader) {
 
-		// Get the model matrix and pass it.
-		glm::mat4 model = this->transforms;
-		glUniformMatrix4fv(glGetUniformLocation(shader.getProgramID(), "Model"), 1, GL_FALSE, glm::value_ptr(model));
+		this->drawDepth(shader, this->draw_index);
 
-		// Get the View matrix and compute the modelView;
-		glm::mat4 view = camera.getView();
-		glm::mat4 model_view = view * model;
-		glUniformMatrix4fv(glGetUniformLocation(shader.getProgramID(), "modelView"), 1, GL_FALSE, glm::value_ptr(model_view));
+	}
 
-		// Get the normal matrix and pass it.
-		glm::mat4 normal_matrix = glm::transpose(glm::inverse(model_view));
-		glUniformMatrix4fv(glGetUniformLocation(shader.getProgramID(), "normalMatrix"), 1, GL_FALSE, glm::value_ptr(normal_matrix));
+	void Geometry::drawDepth(Shader &shader, GLint draw_index) {
+
+		// Activate the mesh and the shader, the textures are not needed.
+		shader.activate();
+		this->mesh->bindVertices();
+
+		// Tell the shader where its matrices are in the stream buffer.
+		shader.passDrawIndex(draw_index);
 
 		// Draw the actual Geometry
-		glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0);
+		GLsizei index_count = this->mesh->getIndexCount();
+		glDrawElements(GL_TRIANGLES, index_count, GL_UNSIGNED_INT, 0);
+
+		draw_calls++;
+		triangles += index_count / 3;
 
 	}
 
-	BoundingBox Geometry::getBoundingBox() {
+	void Geometry::drawInstanced(Shader &shader, GLsizei instances) {
 
-		// Create the bb.
-		BoundingBox bb;
+		// Activate the shader to access the uniforms, and the mesh with its textures.
+		shader.activate();
+		this->mesh->bind(shader);
 
-		// Init the bounding box with the first vertex.
-		bb.min = glm::vec3(this->vertices[0].position.x, this->vertices[0].position.y, this->vertices[0].position.z);
-		bb.max = glm::vec3(this->vertices[0].position.x, this->vertices[0].position.y, this->vertices[0].position.z);
+		// Draw every instance at once.
+		GLsizei index_count = this->mesh->getIndexCount();
+		glDrawElementsInstanced(GL_TRIANGLES, index_count, GL_UNSIGNED_INT, 0, instances);
 
-		// Loop through the vertices and get tge min and max values.
-		for (int i = 1; i < this->vertices.size(); i++) {
+		draw_calls++;
+		triangles += (unsigned long)(index_count / 3) * instances;
 
-			if (bb.min.x > this->vertices[i].position.x)
-				bb.min.x = this->vertices[i].position.x;
+	}
 
-			if (bb.min.y > this->vertices[i].position.y)
-				bb.min.y = this->vertices[i].position.y;
+	BoundingBox Geometry::getBoundingBox() const {
 
-			if (bb.min.z > this->vertices[i].position.z)
-				bb.min.z = this->vertices[i].position.z;
+		return this->mesh->getBoundingBox();
 
-			if (bb.max.x < this->vertices[i].position.x)
-				bb.max.x = this->vertices[i].position.x;
+	}
 
-			if (bb.max.y < this->vertices[i].position.y)
-				bb.max.y = this->vertices[i].position.y;
+	BoundingSphere Geometry::getBoundingSphere() const {
 
-			if (bb.max.z < this->vertices[i].position.z)
-				bb.max.z = this->vertices[i].position.z;
+		return this->mesh->getBoundingSphere();
 
-		}
+	}
 
-		return bb;
+	size_t Geometry::getCPUBytes() const {
+
+		return sizeof(Geometry);
+
+	}
+
+	size_t Geometry::getGPUBytes() {
+
+		return this->mesh->getGPUBytes();
+
+	}
+
+	size_t Geometry::getSharedCPUBytes() const {
+
+		return this->mesh->getCPUBytes();
+
+	}
+
+	BoundingBox Geometry::getWorldBoundingBox() const {
+
+		return this->transformBoundingBox(this->getBoundingBox());
+
+	}
+
+	BoundingSphere Geometry::getWorldBoundingSphere() const {
+
+		return Geometry::transformBoundingSphere(this->transforms, this->mesh->getBoundingSphere());
+
+	}
+
+	const glm::mat4 &Geometry::getNormalTransforms() const {
+
+		// Only recompute the normal matrix if the transforms changed.
+		if (this->transforms_dirty)
+			this->updateNormalMatrix();
+
+		return this->normal_transforms;
+
+	}
+
+	const glm::mat4 &Geometry::getTransforms() const {
+
+		return this->transforms;
+
+	}
+
+	unsigned long Geometry::getDrawCalls() {
+
+		return draw_calls;
+
+	}
+
+	unsigned long Geometry::getTriangles() {
+
+		return triangles;
+
+	}
+
+	bool Geometry::hasCPUData() const {
+
+		return this->mesh->hasCPUData();
+
+	}
+
+	void Geometry::releaseCPUData() {
+
+		this->mesh->releaseCPUData();
+
+	}
+
+	void Geometry::resetCounters() {
+
+		draw_calls = 0;
+		triangles = 0;
 
 	}
 
 	void Geometry::resetTransforms() {
 
 		this->transforms = glm::mat4(1.0f);
+		this->transforms_dirty = true;
 
 	}
 
 	void Geometry::rotate(float x, float y, float z, float angle) {
 
-		// Get the angle as radians.
-		float radians = glm::radians(angle);
+		// A rotation on the right only turns the axes, so only they are multiplied.
+		glm::mat3 rotation_matrix = glm::mat3_cast(glm::angleAxis(glm::radians(angle), glm::normalize(glm::vec3(x, y, z))));
+		glm::mat3 axes = glm::mat3(this->transforms) * rotation_matrix;
 
-		// Create a rotation matrix.
-		glm::mat4 identity_matrix(1.0f);
-		glm::mat4 rotation_matrix = glm::rotate(identity_matrix, radians, glm::vec3(x, y, z));
-
-		this->transforms *= rotation_matrix;
+		this->transforms[0] = glm::vec4(axes[0], this->transforms[0].w);
+		this->transforms[1] = glm::vec4(axes[1], this->transforms[1].w);
+		this->transforms[2] = glm::vec4(axes[2], this->transforms[2].w);
+		this->transforms_dirty = true;
 
 	}
 
 	void Geometry::scale(float x, float y, float z) {
 
-		// Create the scale matrix.
-		glm::mat4 identity_matrix(1.0f);
-		glm::mat4 scale_matrix = glm::scale(identity_matrix, glm::vec3(x, y, z));
+		// A scale on the right only stretches the axes.
+		this->transforms[0] *= x;
+		this->transforms[1] *= y;
+		this->transforms[2] *= z;
+		this->transforms_dirty = true;
+
+	}
+
+	void Geometry::setTransforms(const glm::mat4 &transforms) {
+
+		this->transforms = transforms;
+		this->transforms_dirty = true;
+
+	}
+
+	void Geometry::stage(TransformBatch &batch) {
+
+		// Only recompute the normal matrix if the transforms changed.
+		if (this->transforms_dirty)
+			this->updateNormalMatrix();
+
+		// The batch will write the draw index once the data is in the stream buffer.
+		batch.add(&this->transforms, &this->normal_transforms, &this->draw_index);
 
-		this->transforms *= scale_matrix;
+	}
+
+	void Geometry::updateNormalMatrix() const {
+
+		// Get the axes of the affine part.
+		glm::vec3 x_axis = glm::vec3(this->transforms[0]);
+		glm::vec3 y_axis = glm::vec3(this->transforms[1]);
+		glm::vec3 z_axis = glm::vec3(this->transforms[2]);
+
+		// Check if the axes are orthogonal and equally long, that is, if the scale is uniform.
+		float xx = glm::dot(x_axis, x_axis);
+		float yy = glm::dot(y_axis, y_axis);
+		float zz = glm::dot(z_axis, z_axis);
+		float tolerance = 1e-4f * glm::max(xx, glm::max(yy, zz));
+
+		bool uniform = glm::abs(xx - yy) <= tolerance && glm::abs(xx - zz) <= tolerance &&
+			glm::abs(glm::dot(x_axis, y_axis)) <= tolerance &&
+			glm::abs(glm::dot(x_axis, z_axis)) <= tolerance &&
+			glm::abs(glm::dot(y_axis, z_axis)) <= tolerance;
+
+		// With a uniform scale the inverse transpose is the matrix itself divided by the
+		// squared scale, and the shaders normalize the normals anyway.
+		glm::mat3 normal_matrix = glm::mat3(this->transforms);
+
+		if (!uniform) {
+
+			// The inverse transpose of a 3x3 matrix is its cofactor matrix over its determinant.
+			glm::vec3 x_cofactor = glm::cross(y_axis, z_axis);
+			glm::vec3 y_cofactor = glm::cross(z_axis, x_axis);
+			glm::vec3 z_cofactor = glm::cross(x_axis, y_axis);
+			float determinant = glm::dot(x_axis, x_cofactor);
+
+			if (determinant != 0.0f)
+				normal_matrix = glm::mat3(x_cofactor, y_cofactor, z_cofactor) / determinant;
+
+		}
+
+		this->normal_transforms = glm::mat4(normal_matrix);
+		this->transforms_dirty = false;
 
 	}
 
 	void Geometry::translate(float x, float y, float z) {
 
-		// Get the translation matrix.
-		glm::mat4 trans_matrix = glm::translate(glm::mat4(1.0), glm::vec3(x, y, z));
+		// A translation on the right moves the origin along the axes.
+		this->transforms[3] += this->transforms[0] * x + this->transforms[1] * y + this->transforms[2] * z;
+		this->transforms_dirty = true;
+
+	}
+
+	BoundingBox Geometry::transformBoundingBox(const BoundingBox &box) const {
+
+		return Geometry::transformBoundingBox(this->transforms, box);
+
+	}
+
+	BoundingBox Geometry::transformBoundingBox(const glm::mat4 &transforms, const BoundingBox &box) {
+
+		BoundingBox bb;
+		BatchMaths::transformBoxes(transforms, &box, &bb, 1);
+
+		return bb;
+
+	}
+
+	BoundingSphere Geometry::transformBoundingSphere(const glm::mat4 &transforms, const BoundingSphere &sphere) {
+
+		// Scale the radius by the longest axis.
+		float scale = glm::max(glm::dot(transforms[0], transforms[0]),
+			glm::max(glm::dot(transforms[1], transforms[1]), glm::dot(transforms[2], transforms[2])));
+
+		BoundingSphere world;
+		world.centre = glm::vec3(transforms * glm::vec4(sphere.centre, 1.0f));
+		world.radius = sphere.radius * sqrtf(scale);
 
-		// Apply it to the transormations.
-		this->transforms *= trans_matrix;
+		return world;
 
 	}
 
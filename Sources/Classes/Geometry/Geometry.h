@@ -16,6 +16,7 @@
 #ifndef ALADDIN_3D_CLASSES_GEOMETRY_H_
 #define ALADDIN_3D_CLASSES_GEOMETRY_H_
 
+#include <memory>
 #include <vector>
 
 #include "glew/glew.h"
@@ -23,13 +24,16 @@
 #include "glm/gtc/type_ptr.hpp"
 
 #include "Classes/Camera/Camera.h"
+#include "Classes/MeshAsset/MeshAsset.h"
 #include "Classes/Shader/Shader.h"
 #include "Classes/Texture/Texture.h"
+#include "Classes/TransformBatch/TransformBatch.h"
 #include "Classes/EBO/EBO.h"
 #include "Classes/VBO/VBO.h"
 #include "Classes/VAO/VAO.h"
 #include "Structs/Vertex/Vertex.h"
 #include "Structs/BoundingBox/BoundingBox.h"
+#include "Structs/BoundingSphere/BoundingSphere.h"
 
 namespace aladdin_3d {
 
@@ -37,7 +41,8 @@ namespace aladdin_3d {
 	* @brief Implementation of a Geometry class.
 	*
 	* Implementation of a Geometry class that will allow us to handle the geometric part
-	* of the objects in the VBOs.
+	* of the objects in the VBOs. The mesh itself is a MeshAsset shared by all the copies,
+	* and every copy only has its own transforms.
 	*
 	* @author Borja Garca Quiroga <garcaqub@tcd.ie>
 	*/
@@ -54,51 +59,233 @@ namespace aladdin_3d {
 			 * @param indices Indices of the vertices.
 			 * @param textures Textures in connection with this geometry.
 			 */
-			Geometry(const std::vector<Vertex> &vertices, const std::vector<GLuint> &indices, const std::vector<Texture> &textures);
+			Geometry(const std::vector<Vertex> &vertices, const std::vector<GLuint> &indices, const std::vector<std::shared_ptr<Texture>> &textures);
+
+			/**
+			 * @brief Initializes the Geometry from a mesh.
+			 *
+			 * Initializes a geometry that draws a mesh already uploaded.
+			 *
+			 * @param mesh The shared mesh.
+			 */
+			Geometry(const std::shared_ptr<MeshAsset> &mesh);
 
 			/**
 			 * @brief Get the indices of the geometry.
 			 *
-			 * Get the indices of the geometry.
+			 * Get the indices of the geometry. They are empty once the CPU data is released.
+			 */
+			const std::vector<GLuint> &getIndices() const;
+
+			/**
+			 * @brief Get the mesh.
+			 *
+			 * Get the mesh shared by the copies of the geometry.
 			 */
-			std::vector<GLuint> getIndices();
+			const std::shared_ptr<MeshAsset> &getMesh() const;
 			
 			/**
 			 * @brief Get the textures.
 			 *
 			 * Get the textures.
 			 */
-			std::vector<Texture> getTextures();
+			const std::vector<std::shared_ptr<Texture>> &getTextures() const;
 			
 			/**
 			 * @brief Get the VAO.
 			 *
 			 * Get the VAO.
 			 */
-			VAO getVAO();
+			VAO &getVAO();
 			
 			/**
 			 * @brief Get the vertices of the geometry.
 			 *
-			 * Get the vertices of the geometry.
+			 * Get the vertices of the geometry. They are empty once the CPU data is released.
 			 */
-			std::vector<Vertex> getVertices();
+			const std::vector<Vertex> &getVertices() const;
 
 			/**
 			 * @brief Draws the Geometry.
 			 *
-			 * Displays the Geometry in OpenGL.
+			 * Displays the Geometry in OpenGL. The matrices are read from the stream buffer
+			 * at the index obtained in the last call to stage.
+			 *
+			 * @param shader The shader used to draw the geometry.
+			 */
+			void draw(Shader &shader);
+
+			/**
+			 * @brief Draws the Geometry with its matrices somewhere else.
+			 *
+			 * Displays the Geometry in OpenGL, reading the matrices from the stream buffer
+			 * at a draw index staged by someone else.
+			 *
+			 * @param shader The shader used to draw the geometry.
+			 * @param draw_index The index of the per-draw data in the stream buffer.
 			 */
-			void draw(Shader &shader, Camera &camera);
+			void draw(Shader &shader, GLint draw_index);
+
+			/**
+			 * @brief Draws the depth of the Geometry.
+			 *
+			 * Draws the Geometry without binding its textures, for the depth pre-pass.
+			 *
+			 * @param shader The depth shader.
+			 */
+			void drawDepth(Shader &shader);
+
+			/**
+			 * @brief Draws the depth of the Geometry with its matrices somewhere else.
+			 *
+			 * Draws the Geometry without binding its textures, reading the matrices from the
+			 * stream buffer at a draw index staged by someone else.
+			 *
+			 * @param shader The depth shader.
+			 * @param draw_index The index of the per-draw data in the stream buffer.
+			 */
+			void drawDepth(Shader &shader, GLint draw_index);
+
+			/**
+			 * @brief Draws several instances of the Geometry.
+			 *
+			 * Draws the Geometry several times in a single call. The shader tells the
+			 * instances apart by their instance ID, and its draw index is left as it is.
+			 *
+			 * @param shader The shader used to draw the geometry.
+			 * @param instances The number of instances.
+			 */
+			void drawInstanced(Shader &shader, GLsizei instances);
 
 			/**
 			 * @brief Gets the bounding box.
 			 * 
-			 * Gets the bounding box of the geometry.
+			 * Gets the bounding box of the geometry, computed when it was created.
+			 * 
+			 * @returns The bounding box struct.
+			 */
+			BoundingBox getBoundingBox() const;
+
+			/**
+			 * @brief Gets the bounding sphere.
+			 *
+			 * Gets the bounding sphere of the geometry, computed when it was created.
+			 *
+			 * @returns The bounding sphere struct.
+			 */
+			BoundingSphere getBoundingSphere() const;
+
+			/**
+			 * @brief Gets the memory used on the CPU.
+			 *
+			 * Gets the bytes used by this copy of the geometry in main memory, without
+			 * the shared mesh.
+			 *
+			 * @returns The number of bytes.
+			 */
+			size_t getCPUBytes() const;
+
+			/**
+			 * @brief Gets the memory used on the GPU.
+			 *
+			 * Gets the bytes of the vertex, index and texture data uploaded to OpenGL.
+			 * They are shared by all the copies of the geometry.
+			 *
+			 * @returns The number of bytes.
+			 */
+			size_t getGPUBytes();
+
+			/**
+			 * @brief Gets the memory of the mesh on the CPU.
+			 *
+			 * Gets the bytes used by the shared mesh in main memory, including its vertices
+			 * and indices while they are kept.
+			 *
+			 * @returns The number of bytes.
+			 */
+			size_t getSharedCPUBytes() const;
+
+			/**
+			 * @brief Checks if the CPU data is kept.
+			 *
+			 * Checks if the vertices and indices are still in main memory.
+			 *
+			 * @returns True if they have not been released.
+			 */
+			bool hasCPUData() const;
+
+			/**
+			 * @brief Gets the world bounding box.
+			 * 
+			 * Gets the bounding box of the geometry after applying its transforms.
 			 * 
 			 * @returns The bounding box struct.
 			 */
-			BoundingBox getBoundingBox();
+			BoundingBox getWorldBoundingBox() const;
+
+			/**
+			 * @brief Gets the world bounding sphere.
+			 *
+			 * Gets the bounding sphere of the geometry after applying its transforms. The
+			 * radius grows with the largest scale, so it stays a sphere.
+			 *
+			 * @returns The bounding sphere struct.
+			 */
+			BoundingSphere getWorldBoundingSphere() const;
+
+			/**
+			 * @brief Gets the normal matrix.
+			 *
+			 * Gets the world normal matrix of the geometry, computing it first if the
+			 * transforms changed since it was cached.
+			 *
+			 * @returns The normal matrix.
+			 */
+			const glm::mat4 &getNormalTransforms() const;
+
+			/**
+			 * @brief Gets the transforms.
+			 *
+			 * Gets the transform matrix of the geometry.
+			 *
+			 * @returns The transform matrix.
+			 */
+			const glm::mat4 &getTransforms() const;
+
+			/**
+			 * @brief Gets the number of draw calls.
+			 *
+			 * Gets the number of draw calls issued by all the geometries since the last reset.
+			 *
+			 * @returns The number of draw calls.
+			 */
+			static unsigned long getDrawCalls();
+
+			/**
+			 * @brief Gets the number of triangles.
+			 *
+			 * Gets the number of triangles drawn by all the geometries since the last reset.
+			 *
+			 * @returns The number of triangles.
+			 */
+			static unsigned long getTriangles();
+
+			/**
+			 * @brief Resets the draw counters.
+			 *
+			 * Resets the number of draw calls and triangles of all the geometries.
+			 */
+			static void resetCounters();
+
+			/**
+			 * @brief Releases the CPU data.
+			 *
+			 * Frees the vertices and indices once they are on the GPU. The bounds and the
+			 * number of indices are kept, so the geometry can still be drawn and culled,
+			 * but nothing that needs the mesh itself can be done with it anymore. The mesh
+			 * is shared, so all the copies lose them.
+			 */
+			void releaseCPUData();
 
 			/**
 			 * @brief Reset
@@ -130,6 +317,26 @@ namespace aladdin_3d {
 			 */
 			void scale(float x, float y, float z);
 
+			/**
+			 * @brief Sets the transforms.
+			 *
+			 * Replaces the transform matrix of the geometry, so that a pose can be built
+			 * every frame without accumulating on the previous one.
+			 *
+			 * @param transforms The new transform matrix.
+			 */
+			void setTransforms(const glm::mat4 &transforms);
+
+			/**
+			 * @brief Adds the Geometry to the transform batch.
+			 *
+			 * Adds the cached matrices of the Geometry to the batch that will compute the
+			 * per-draw data of this frame, updating them first if they changed.
+			 *
+			 * @param batch The transform batch of the current frame.
+			 */
+			void stage(TransformBatch &batch);
+
 			/**
 			 * @brief Add a translation matrix to the model.
 			 *
@@ -141,20 +348,61 @@ namespace aladdin_3d {
 			 */
 			void translate(float x, float y, float z);
 
+			/**
+			 * @brief Transforms a bounding box.
+			 * 
+			 * Applies the transforms of the geometry to a box in its local coordinates.
+			 * 
+			 * @param box The box in local coordinates.
+			 * 
+			 * @returns The bounding box of the transformed box.
+			 */
+			BoundingBox transformBoundingBox(const BoundingBox &box) const;
+
+			/**
+			 * @brief Transforms a bounding box by a matrix.
+			 *
+			 * Applies an affine transform matrix to a box, moving its centre and projecting
+			 * its half size on the axes, which gives the same box as its eight corners.
+			 *
+			 * @param transforms The transform matrix.
+			 * @param box The box to transform.
+			 *
+			 * @returns The bounding box of the transformed box.
+			 */
+			static BoundingBox transformBoundingBox(const glm::mat4 &transforms, const BoundingBox &box);
+
+			/**
+			 * @brief Transforms a bounding sphere by a matrix.
+			 *
+			 * Applies an affine transform matrix to a sphere. The radius grows with the
+			 * largest scale, so it stays a sphere.
+			 *
+			 * @param transforms The transform matrix.
+			 * @param sphere The sphere to transform.
+			 *
+			 * @returns The transformed sphere.
+			 */
+			static BoundingSphere transformBoundingSphere(const glm::mat4 &transforms, const BoundingSphere &sphere);
+
 		private:
 
 			/**
 			 * @brief Updates the normal matrix.
 			 * 
-			 * Updates the normal matrix so it can be passed to the shader.
+			 * Updates the normal matrix so it can be passed to the shader. It only uses the
+			 * affine 3x3 part of the transforms, and skips the inverse when the scale is uniform.
 			 */
-			void updateNormalMatrix();
+			void updateNormalMatrix() const;
 
-			std::vector<GLuint> indices;				/// Indices of the vertices.
-			std::vector<Texture> textures;				/// Textures that will color this geometry.
-			VAO vao;									/// VAO containing this object.
-			std::vector<Vertex> vertices;				/// Geometry vertices.
+			std::shared_ptr<MeshAsset> mesh;			/// Mesh shared by all the copies.
+			GLint draw_index = 0;						/// Index of the per-draw data in the stream buffer.
 			glm::mat4 transforms = glm::mat4(1.0f);		/// Tranform matrixes that will be passed to the shader.
+			mutable glm::mat4 normal_transforms = glm::mat4(1.0f);	/// World normal matrix cached from the transforms.
+			mutable bool transforms_dirty = true;				/// Whether the transforms changed since the normal matrix was cached.
+
+			static unsigned long draw_calls;			/// Draw calls issued since the last reset.
+			static unsigned long triangles;				/// Triangles drawn since the last reset.
 
 	};
 
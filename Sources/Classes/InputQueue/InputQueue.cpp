@@ -0,0 +1,56 @@
+/**
+ * @file InputQueue.cpp
+ * @brief InputQueue class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "InputQueue.h"
+
+#include <atomic>
+
+#include "Structs/InputEvent/InputEvent.h"
+
+namespace aladdin_3d {
+
+	const size_t InputQueue::capacity;
+
+	bool InputQueue::pop(InputEvent &event) {
+
+		size_t head = this->head.load(std::memory_order_relaxed);
+
+		// The acquire pairs with the release of push, so the event is fully written.
+		if (head == this->tail.load(std::memory_order_acquire))
+			return false;
+
+		event = this->events[head % capacity];
+		this->head.store(head + 1, std::memory_order_release);
+
+		return true;
+
+	}
+
+	bool InputQueue::push(const InputEvent &event) {
+
+		size_t tail = this->tail.load(std::memory_order_relaxed);
+
+		// The acquire pairs with the release of pop, so the place is no longer read.
+		if (tail - this->head.load(std::memory_order_acquire) == capacity)
+			return false;
+
+		this->events[tail % capacity] = event;
+		this->tail.store(tail + 1, std::memory_order_release);
+
+		return true;
+
+	}
+
+}  // namespace aladdin_3d
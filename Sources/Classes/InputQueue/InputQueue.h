@@ -0,0 +1,73 @@
+/**
+ * @file InputQueue.h
+ * @brief InputQueue class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_INPUTQUEUE_H_
+#define ALADDIN_3D_CLASSES_INPUTQUEUE_H_
+
+#include <stddef.h>
+
+#include <atomic>
+
+#include "Structs/InputEvent/InputEvent.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of a InputQueue class.
+	 *
+	 * Implementation of a lock-free single producer, single consumer ring of input
+	 * events, used to pass the key events from one thread to another.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class InputQueue {
+
+		public:
+
+			/**
+			 * @brief Takes an event.
+			 *
+			 * Takes the oldest event of the queue. Only the consumer thread may call it.
+			 *
+			 * @param event Outputs the event.
+			 *
+			 * @returns True if there was an event.
+			 */
+			bool pop(InputEvent &event);
+
+			/**
+			 * @brief Adds an event.
+			 *
+			 * Adds an event at the end of the queue. Only the producer thread may call it.
+			 *
+			 * @param event The event.
+			 *
+			 * @returns False if the queue was full and the event was dropped.
+			 */
+			bool push(const InputEvent &event);
+
+			static const size_t capacity = 256;		/// Maximum number of events waiting.
+
+		private:
+
+			InputEvent events[capacity];			/// The ring of events.
+			std::atomic<size_t> head{0};			/// Next event to take, owned by the consumer.
+			std::atomic<size_t> tail{0};			/// Next free place, owned by the producer.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_INPUTQUEUE_H_
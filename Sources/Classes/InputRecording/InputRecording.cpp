@@ -0,0 +1,195 @@
+/**
+ * @file InputRecording.cpp
+ * @brief InputRecording class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "InputRecording.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <fstream>
+#include <vector>
+
+#include "Structs/InputEvent/InputEvent.h"
+
+namespace aladdin_3d {
+
+	const uint32_t InputRecording::version;
+
+	/**
+	 * @brief Writes an unsigned integer in little endian.
+	 *
+	 * Writes the lowest bytes of an unsigned integer in little endian.
+	 *
+	 * @param file The file.
+	 * @param value The value.
+	 * @param bytes The number of bytes to write.
+	 */
+	static void writeBytes(std::ofstream &file, uint64_t value, int bytes) {
+
+		for (int i = 0; i < bytes; i++)
+			file.put((char)((value >> (8 * i)) & 0xFF));
+
+	}
+
+	/**
+	 * @brief Reads an unsigned integer in little endian.
+	 *
+	 * Reads an unsigned integer of some bytes in little endian.
+	 *
+	 * @param file The file.
+	 * @param bytes The number of bytes to read.
+	 *
+	 * @returns The value.
+	 */
+	static uint64_t readBytes(std::ifstream &file, int bytes) {
+
+		uint64_t value = 0;
+
+		for (int i = 0; i < bytes; i++)
+			value |= (uint64_t)(unsigned char)file.get() << (8 * i);
+
+		return value;
+
+	}
+
+	unsigned long InputRecording::getLastTick() {
+
+		return this->events.empty() ? 0 : this->events.back().tick;
+
+	}
+
+	unsigned int InputRecording::getSeed() {
+
+		return this->seed;
+
+	}
+
+	double InputRecording::getTimestep() {
+
+		return this->timestep;
+
+	}
+
+	bool InputRecording::isFinished() {
+
+		return this->cursor >= this->events.size();
+
+	}
+
+	bool InputRecording::load(const char *filename) {
+
+		std::ifstream file(filename, std::ios::binary);
+
+		if (!file.is_open())
+			return false;
+
+		// Check the header.
+		char magic[4] = {};
+		file.read(magic, 4);
+
+		if (!file || memcmp(magic, "A3DI", 4) != 0 || readBytes(file, 4) != version)
+			return false;
+
+		this->seed = (unsigned int)readBytes(file, 4);
+
+		uint64_t timestep_bits = readBytes(file, 8);
+		memcpy(&this->timestep, &timestep_bits, sizeof(double));
+
+		// Read the events.
+		uint32_t count = (uint32_t)readBytes(file, 4);
+		this->events.clear();
+		this->cursor = 0;
+
+		for (uint32_t i = 0; i < count && file; i++) {
+
+			InputEvent event;
+			event.tick = (uint32_t)readBytes(file, 4);
+			event.special = (uint8_t)readBytes(file, 1);
+			event.key = (uint8_t)readBytes(file, 1);
+
+			this->events.push_back(event);
+
+		}
+
+		return (bool)file;
+
+	}
+
+	bool InputRecording::poll(unsigned long tick, InputEvent &event) {
+
+		if (this->isFinished() || this->events[this->cursor].tick > tick)
+			return false;
+
+		event = this->events[this->cursor];
+		this->cursor++;
+
+		return true;
+
+	}
+
+	void InputRecording::record(unsigned long tick, bool special, int key) {
+
+		InputEvent event;
+		event.tick = (uint32_t)tick;
+		event.special = special ? 1 : 0;
+		event.key = (uint8_t)key;
+
+		this->events.push_back(event);
+
+	}
+
+	bool InputRecording::save(const char *filename) {
+
+		std::ofstream file(filename, std::ios::binary);
+
+		if (!file.is_open())
+			return false;
+
+		// Write the header.
+		uint64_t timestep_bits = 0;
+		memcpy(&timestep_bits, &this->timestep, sizeof(double));
+
+		file.write("A3DI", 4);
+		writeBytes(file, version, 4);
+		writeBytes(file, this->seed, 4);
+		writeBytes(file, timestep_bits, 8);
+		writeBytes(file, this->events.size(), 4);
+
+		// Write the events.
+		for (size_t i = 0; i < this->events.size(); i++) {
+
+			writeBytes(file, this->events[i].tick, 4);
+			writeBytes(file, this->events[i].special, 1);
+			writeBytes(file, this->events[i].key, 1);
+
+		}
+
+		return file.good();
+
+	}
+
+	void InputRecording::setSeed(unsigned int seed) {
+
+		this->seed = seed;
+
+	}
+
+	void InputRecording::setTimestep(double timestep) {
+
+		this->timestep = timestep;
+
+	}
+
+}  // namespace aladdin_3d
@@ -0,0 +1,157 @@
+/**
+ * @file InputRecording.h
+ * @brief InputRecording class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_INPUTRECORDING_H_
+#define ALADDIN_3D_CLASSES_INPUTRECORDING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "Structs/InputEvent/InputEvent.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of a InputRecording class.
+	 *
+	 * Implementation of a recording of the key events of a session, stamped with the
+	 * simulation tick they were handled in. Together with the world seed and the
+	 * timestep, also stored in the recording, replaying the events in the same ticks
+	 * reproduces the session exactly.
+	 *
+	 * The file starts with the "A3DI" magic, a version, the seed, the timestep and the
+	 * number of events, followed by the events. Everything is little endian.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class InputRecording {
+
+		public:
+
+			/**
+			 * @brief Get the last tick.
+			 *
+			 * Get the tick of the last event in the recording.
+			 *
+			 * @returns The tick of the last event, or 0 if there are no events.
+			 */
+			unsigned long getLastTick();
+
+			/**
+			 * @brief Get the world seed.
+			 *
+			 * Get the seed the world was generated with.
+			 *
+			 * @returns The seed.
+			 */
+			unsigned int getSeed();
+
+			/**
+			 * @brief Get the timestep.
+			 *
+			 * Get the simulation time of a tick.
+			 *
+			 * @returns The timestep in seconds.
+			 */
+			double getTimestep();
+
+			/**
+			 * @brief Checks if the replay is over.
+			 *
+			 * Checks if every event has been polled.
+			 *
+			 * @returns True if there are no events left.
+			 */
+			bool isFinished();
+
+			/**
+			 * @brief Loads a recording.
+			 *
+			 * Loads a recording from a file and rewinds it.
+			 *
+			 * @param filename The path of the file.
+			 *
+			 * @returns True if the file could be read.
+			 */
+			bool load(const char *filename);
+
+			/**
+			 * @brief Gets the next event of a tick.
+			 *
+			 * Gets the next event that has to be handled in a tick or before it.
+			 *
+			 * @param tick The current tick.
+			 * @param event Outputs the event.
+			 *
+			 * @returns True if there was an event.
+			 */
+			bool poll(unsigned long tick, InputEvent &event);
+
+			/**
+			 * @brief Records an event.
+			 *
+			 * Appends a key event to the recording.
+			 *
+			 * @param tick The tick the event is handled in.
+			 * @param special Whether the key is a special key or a character.
+			 * @param key The key.
+			 */
+			void record(unsigned long tick, bool special, int key);
+
+			/**
+			 * @brief Saves the recording.
+			 *
+			 * Saves the recording in a file.
+			 *
+			 * @param filename The path of the file.
+			 *
+			 * @returns True if the file could be written.
+			 */
+			bool save(const char *filename);
+
+			/**
+			 * @brief Set the world seed.
+			 *
+			 * Set the seed the world was generated with.
+			 *
+			 * @param seed The seed.
+			 */
+			void setSeed(unsigned int seed);
+
+			/**
+			 * @brief Set the timestep.
+			 *
+			 * Set the simulation time of a tick.
+			 *
+			 * @param timestep The timestep in seconds.
+			 */
+			void setTimestep(double timestep);
+
+			static const uint32_t version = 2;	/// Version of the file format.
+
+		private:
+
+			std::vector<InputEvent> events;		/// Events in the order they were handled.
+			size_t cursor = 0;					/// Next event to replay.
+			unsigned int seed = 0;				/// Seed the world was generated with.
+			double timestep = 0.0;				/// Simulation time of a tick.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_INPUTRECORDING_H_
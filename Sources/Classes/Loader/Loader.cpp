@@ -19,6 +19,10 @@
 #include <fstream>
 #include <sstream>
 #include <iostream>
+#include <vector>
+
+#include "Structs/AnimationClip/AnimationClip.h"
+#include "Structs/Skin/Skin.h"
 
 namespace aladdin_3d {
 
@@ -28,6 +32,13 @@ namespace aladdin_3d {
 
 	}
 
+	void Loader::getAnimations(Skin *skin, std::vector<AnimationClip> *animations) {
+
+		(*skin) = this->skin;
+		(*animations) = this->animations;
+
+	}
+
 	std::string Loader::readFileContents(const char* filename) {
 
 		// Open the file stream.
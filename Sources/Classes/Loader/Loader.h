@@ -20,6 +20,9 @@
 #include <vector>
 
 #include "Classes/Geometry/Geometry.h"
+#include "Structs/AnimationClip/AnimationClip.h"
+#include "Structs/SceneNode/SceneNode.h"
+#include "Structs/Skin/Skin.h"
 
 namespace aladdin_3d {
 
@@ -48,15 +51,33 @@ namespace aladdin_3d {
 			 */
 			Loader(const char *filename);
 
+			/**
+			 * @brief Destroys the loader.
+			 *
+			 * Destroys the loader and its copy of the geometries.
+			 */
+			virtual ~Loader() = default;
+
+			/**
+			 * @brief Get the skin and the animations from the loaded model.
+			 *
+			 * Get the skin and the animations from the loaded model. Their nodes are
+			 * indices in the node hierarchy given with the geometries.
+			 *
+			 * @param skin Outputs the skin, without joints if the model has none.
+			 * @param animations Outputs the animations.
+			 */
+			void getAnimations(Skin *skin, std::vector<AnimationClip> *animations);
+
 			/**
 			 * @brief Get the geometries from the loaded model.
 			 *
 			 * Get the geometries from the loaded model.
 			 *
 			 * @param geoms Outputs the geometries returned.
-			 * @param matrices Outputs the transformation matrices.
+			 * @param nodes Outputs the node hierarchy, parents first.
 			 */
-			virtual void getGeometries(std::vector<Geometry> *geoms, std::vector<glm::mat4> *matrices) = 0;
+			virtual void getGeometries(std::vector<Geometry> *geoms, std::vector<SceneNode> *nodes) = 0;
 
 			/**
 			 * @brief Loads the data from the file.
@@ -81,7 +102,9 @@ namespace aladdin_3d {
 
 			std::vector<Geometry> geometries;			/// The Geometries loaded by the model loader.
 			const char *filename;						/// Name of the file containing the model.
-			std::vector<glm::mat4> transform_matrixes;	/// Transform matrixes for each Geometry in the object.
+			std::vector<SceneNode> nodes;				/// Node hierarchy of the model, parents first.
+			Skin skin;									/// Skin of the skinned geometries of the model.
+			std::vector<AnimationClip> animations;		/// Animations of the nodes of the model.
 
 	};
 
@@ -21,6 +21,9 @@
 #include "LoaderGLTF.h"
 #include "Classes/Loader/Loader.h"
 
+#include <algorithm>
+#include <memory>
+#include <string>
 #include <vector>
 #include <iostream>
 
@@ -28,6 +31,14 @@
 #include "glm/gtc/type_ptr.hpp"
 #include "json/json.h"
 
+#include "Classes/Animator/Animator.h"
+#include "Classes/SceneGraph/SceneGraph.h"
+#include "Structs/AnimationChannel/AnimationChannel.h"
+#include "Structs/AnimationClip/AnimationClip.h"
+#include "Structs/SceneNode/SceneNode.h"
+#include "Structs/Skin/Skin.h"
+#include "Structs/SkinVertex/SkinVertex.h"
+
 namespace aladdin_3d {
 
 	LoaderGLTF::LoaderGLTF(const char* filename) : Loader(filename) {}
@@ -51,12 +62,143 @@ namespace aladdin_3d {
 		// Transform the raw text data into bytes and put them in a vector
 		this->bin_data = std::vector<unsigned char>(raw_bytes.begin(), raw_bytes.end());
 
-		// Now, iterate the nodes in the file recursively.
-		recursiveGetNode(0);
+		// Now, iterate the nodes of the scene recursively. Files without scenes start from the first node.
+		this->node_indices = std::vector<int>(json_file["nodes"].size(), -1);
+
+		if (json_file.find("scenes") != json_file.end()) {
+
+			nlohmann::json roots = json_file["scenes"][json_file.value("scene", 0u)]["nodes"];
+
+			for (unsigned int i = 0; i < roots.size(); i++)
+				recursiveGetNode(roots[i]);
+
+		} else {
+
+			recursiveGetNode(0);
+
+		}
+
+		// The joints and the animated nodes can be anywhere in the hierarchy, so they
+		// are read once all the nodes have their index.
+		if (this->skin_index >= 0)
+			loadSkin(this->skin_index);
+
+		loadAnimations();
+
+	}
+
+	void LoaderGLTF::loadAnimations() {
+
+		if (json_file.find("animations") == json_file.end())
+			return;
+
+		for (unsigned int i = 0; i < json_file["animations"].size(); i++) {
+
+			nlohmann::json animation = json_file["animations"][i];
+
+			AnimationClip clip;
+			clip.name = animation.value("name", std::string());
+
+			for (unsigned int j = 0; j < animation["channels"].size(); j++) {
+
+				nlohmann::json target = animation["channels"][j]["target"];
+				nlohmann::json sampler = animation["samplers"][(unsigned int)animation["channels"][j]["sampler"]];
+
+				// Only the nodes in the hierarchy can be moved.
+				if (target.find("node") == target.end() || this->node_indices[target["node"]] < 0)
+					continue;
+
+				AnimationChannel channel;
+				channel.node = this->node_indices[target["node"]];
+
+				std::string path = target["path"];
+				if (path == "translation") channel.path = Animator::translation;
+				else if (path == "rotation") channel.path = Animator::rotation;
+				else if (path == "scale") channel.path = Animator::scale;
+				else continue;
+
+				std::string interpolation = sampler.value("interpolation", std::string("LINEAR"));
+
+				if (interpolation == "CUBICSPLINE") {
+
+					std::cerr << "Warning - The cubic spline animation channels of " << filename << " are not supported." << std::endl;
+					continue;
+
+				}
+
+				// Get the keys.
+				std::vector<float> times = getFloats(this->json_file["accessors"][(unsigned int)sampler["input"]]);
+				std::vector<float> floats = getFloats(this->json_file["accessors"][(unsigned int)sampler["output"]]);
+				std::vector<glm::vec4> values;
+
+				if (channel.path == Animator::rotation) {
+
+					values = groupFloatsVec4(floats);
+
+					// Keep every rotation on the side of the previous one, so they blend the short way.
+					for (size_t k = 1; k < values.size(); k++) {
+
+						if (glm::dot(values[k - 1], values[k]) < 0.0f)
+							values[k] = -values[k];
+
+					}
+
+				} else {
+
+					std::vector<glm::vec3> vectors = groupFloatsVec3(floats);
+
+					for (size_t k = 0; k < vectors.size(); k++)
+						values.push_back(glm::vec4(vectors[k], 0.0f));
+
+				}
+
+				// A step holds the previous value until the next key.
+				for (size_t k = 0; k < times.size(); k++) {
+
+					if (interpolation == "STEP" && k > 0) {
+
+						channel.times.push_back(times[k]);
+						channel.values.push_back(values[k - 1]);
+
+					}
+
+					channel.times.push_back(times[k]);
+					channel.values.push_back(values[k]);
+
+				}
+
+				if (!channel.times.empty())
+					clip.duration = std::max(clip.duration, channel.times.back());
+
+				clip.channels.push_back(channel);
+
+			}
+
+			this->animations.push_back(clip);
+
+		}
 
 	}
 
-	void LoaderGLTF::recursiveGetNode(unsigned int nextNode, glm::mat4 matrix) {
+	void LoaderGLTF::loadSkin(unsigned int indSkin) {
+
+		nlohmann::json skin = this->json_file["skins"][indSkin];
+
+		// Get the inverse bind matrices, the joints are already in place without them.
+		std::vector<float> matrices;
+		if (skin.find("inverseBindMatrices") != skin.end())
+			matrices = getFloats(this->json_file["accessors"][(unsigned int)skin["inverseBindMatrices"]]);
+
+		for (unsigned int i = 0; i < skin["joints"].size(); i++) {
+
+			this->skin.joints.push_back(this->node_indices[skin["joints"][i]]);
+			this->skin.inverse_binds.push_back(matrices.size() >= (i + 1) * 16 ? glm::make_mat4(&matrices[i * 16]) : glm::mat4(1.0f));
+
+		}
+
+	}
+
+	void LoaderGLTF::recursiveGetNode(unsigned int nextNode, int parent) {
 
 		// Get the current node.
 		nlohmann::json node = json_file["nodes"][nextNode];
@@ -89,43 +231,44 @@ namespace aladdin_3d {
 		if (node.find("scale") != node.end())
 			scale = glm::vec3(node["scale"][0], node["scale"][1], node["scale"][2]);
 
-		// Get matrix if it exists
-		glm::mat4 matNode = glm::mat4(1.0f);
+		// Get matrix if it exists. GLTF nodes have either a matrix or the separate transforms.
 		if (node.find("matrix") != node.end())
 		{
 			float matValues[16];
 			for (unsigned int i = 0; i < node["matrix"].size(); i++)
 				matValues[i] = (node["matrix"][i]);
-			matNode = glm::make_mat4(matValues);
+			SceneGraph::decompose(glm::make_mat4(matValues), &translation, &rotation, &scale);
 		}
 
-		// Initialize matrices.
-		glm::mat4 trans = glm::mat4(1.0f);
-		glm::mat4 rot = glm::mat4(1.0f);
-		glm::mat4 sca = glm::mat4(1.0f);
+		// Add the node to the hierarchy, relative to its parent.
+		SceneNode scene_node;
+		scene_node.parent = parent;
+		scene_node.translation = translation;
+		scene_node.rotation = rotation;
+		scene_node.scale = scale;
 
-		// Use translation, rotation, and scale to change the initialized matrices
-		trans = glm::translate(trans, translation);
-		rot = glm::mat4_cast(rotation);
-		sca = glm::scale(sca, scale);
+		int index = (int)this->nodes.size();
+		this->nodes.push_back(scene_node);
+		this->node_indices[nextNode] = index;
 
-		// Multiply all matrices together to obtain the final transform.
-		glm::mat4 transform_matrix = matrix * matNode * trans * rot * sca;
+		// The skinned meshes are placed by their joints. All of them use the first skin.
+		if (node.find("skin") != node.end() && this->skin_index < 0)
+			this->skin_index = node["skin"];
 
 		// Check if the node contains a mesh and if it does load it
 		if (node.find("mesh") != node.end()) {
 
-			this->transform_matrixes.push_back(transform_matrix);
+			this->nodes[index].geometry = (int)this->geometries.size();
 
 			loadGeometry(node["mesh"]);
 
 		}
 
-		// Check if the node has children, and if it does, apply this function to them with the matNextNode
+		// Check if the node has children, and if it does, apply this function to them.
 		if (node.find("children") != node.end()) {
 
 			for (unsigned int i = 0; i < node["children"].size(); i++)
-				recursiveGetNode(node["children"][i], transform_matrix);
+				recursiveGetNode(node["children"][i], index);
 
 		}
 
@@ -153,11 +296,33 @@ namespace aladdin_3d {
 		// Grab the indices.
 		std::vector<GLuint> indices = getIndices(this->json_file["accessors"][indAccInd]);
 
-		// Obtain the textures.
-		std::vector<aladdin_3d::Texture> textures = getTextures();
+		// Obtain the textures. They are loaded only once and shared by all the meshes.
+		if (this->textures.empty())
+			this->textures = getTextures();
 
 		// Create a Geometry object that contains all this data.
-		this->geometries.push_back(aladdin_3d::Geometry(vertices, indices, textures));
+		this->geometries.push_back(aladdin_3d::Geometry(vertices, indices, this->textures));
+
+		// Skinned meshes also have the joints that move every vertex. The weights can be
+		// floats or normalized integers.
+		nlohmann::json attributes = this->json_file["meshes"][indMesh]["primitives"][0]["attributes"];
+
+		if (attributes.find("JOINTS_0") != attributes.end() && attributes.find("WEIGHTS_0") != attributes.end()) {
+
+			std::vector<glm::vec4> joints = getVec4s(this->json_file["accessors"][(unsigned int)attributes["JOINTS_0"]], false);
+			std::vector<glm::vec4> weights = getVec4s(this->json_file["accessors"][(unsigned int)attributes["WEIGHTS_0"]], true);
+
+			std::vector<SkinVertex> skin(joints.size());
+			for (size_t i = 0; i < skin.size(); i++) {
+
+				skin[i].joints = joints[i];
+				skin[i].weights = weights[i];
+
+			}
+
+			this->geometries.back().getMesh()->setSkin(skin);
+
+		}
 
 	}
 
@@ -181,7 +346,8 @@ namespace aladdin_3d {
 		else if (type == "VEC2") numPerVert = 2;
 		else if (type == "VEC3") numPerVert = 3;
 		else if (type == "VEC4") numPerVert = 4;
-		else throw std::invalid_argument("Type is invalid (not SCALAR, VEC2, VEC3, or VEC4)");
+		else if (type == "MAT4") numPerVert = 16;
+		else throw std::invalid_argument("Type is invalid (not SCALAR, VEC2, VEC3, VEC4 or MAT4)");
 
 		// Go over all the bytes in the data at the correct place using the properties from above
 		unsigned int beginningOfData = byteOffset + accByteOffset;
@@ -247,10 +413,63 @@ namespace aladdin_3d {
 		return indices;
 	}
 
-	std::vector<aladdin_3d::Texture> LoaderGLTF::getTextures() {
+	std::vector<glm::vec4> LoaderGLTF::getVec4s(nlohmann::json accessor, bool normalize) {
+
+		std::vector<glm::vec4> vectors;
+
+		// Get properties from the accessor
+		unsigned int buffViewInd = accessor.value("bufferView", 0);
+		unsigned int count = accessor["count"];
+		unsigned int accByteOffset = accessor.value("byteOffset", 0);
+		unsigned int componentType = accessor["componentType"];
+
+		// Get properties from the bufferView
+		nlohmann::json bufferView = this->json_file["bufferViews"][buffViewInd];
+		unsigned int byteOffset = bufferView.value("byteOffset", 0);
+
+		// Interpret the type of the components: unsigned byte, unsigned short or float
+		unsigned int componentSize;
+		if (componentType == 5121) componentSize = 1;
+		else if (componentType == 5123) componentSize = 2;
+		else if (componentType == 5126) componentSize = 4;
+		else throw std::invalid_argument("Component type is invalid (not UNSIGNED_BYTE, UNSIGNED_SHORT or FLOAT)");
+
+		// Interleaved attributes are byteStride apart, packed ones right after each other
+		unsigned int stride = bufferView.value("byteStride", componentSize * 4);
+
+		// Get four components per vertex, mapping the normalized integers to [0, 1]
+		unsigned int beginningOfData = byteOffset + accByteOffset;
+		for (unsigned int i = 0; i < count; i++)
+		{
+			glm::vec4 vector;
+			for (unsigned int j = 0; j < 4; j++)
+			{
+				const unsigned char *bytes = &this->bin_data[beginningOfData + i * stride + j * componentSize];
+				if (componentType == 5121)
+				{
+					vector[j] = normalize ? bytes[0] / 255.0f : (float)bytes[0];
+				}
+				else if (componentType == 5123)
+				{
+					unsigned short value;
+					std::memcpy(&value, bytes, sizeof(unsigned short));
+					vector[j] = normalize ? value / 65535.0f : (float)value;
+				}
+				else
+				{
+					std::memcpy(&vector[j], bytes, sizeof(float));
+				}
+			}
+			vectors.push_back(vector);
+		}
+
+		return vectors;
+	}
+
+	std::vector<std::shared_ptr<aladdin_3d::Texture>> LoaderGLTF::getTextures() {
 
 		// Init the textures holder.
-		std::vector<aladdin_3d::Texture> textures;
+		std::vector<std::shared_ptr<aladdin_3d::Texture>> textures;
 
 		// Get the path to this model.
 		std::string filename_str(filename);
@@ -264,11 +483,8 @@ namespace aladdin_3d {
 			int texture_index = this->json_file["materials"][i]["pbrMetallicRoughness"]["baseColorTexture"]["index"];
 			std::string texture_uri = this->json_file["images"][texture_index]["uri"];
 
-			// Create the new texture.
-			aladdin_3d::Texture new_texture = aladdin_3d::Texture((file_dir_path + texture_uri).c_str(), material_name.c_str(), textures.size());
-
-			// Add it to the textures.
-			textures.push_back(new_texture);
+			// Create the new texture and add it to the textures.
+			textures.push_back(std::make_shared<aladdin_3d::Texture>((file_dir_path + texture_uri).c_str(), material_name.c_str(), textures.size()));
 
 		}
 
@@ -323,17 +539,17 @@ namespace aladdin_3d {
 	std::vector<glm::vec4> LoaderGLTF::groupFloatsVec4(std::vector<float> floatVec)
 	{
 		std::vector<glm::vec4> vectors;
-		for (size_t i = 0; i < floatVec.size(); i)
+		for (size_t i = 0; i + 3 < floatVec.size(); i += 4)
 		{
-			vectors.push_back(glm::vec4(floatVec[i++], floatVec[i++], floatVec[i++], floatVec[i++]));
+			vectors.push_back(glm::vec4(floatVec[i], floatVec[i + 1], floatVec[i + 2], floatVec[i + 3]));
 		}
 		return vectors;
 	}
 
-	void LoaderGLTF::getGeometries(std::vector<Geometry> *geoms, std::vector<glm::mat4> *matrices) {
+	void LoaderGLTF::getGeometries(std::vector<Geometry> *geoms, std::vector<SceneNode> *nodes) {
 
 		(*geoms) = this->geometries;
-		(*matrices) = this->transform_matrixes;
+		(*nodes) = this->nodes;
 
 	}
 
@@ -18,11 +18,14 @@
 
 #include "Classes/Loader/Loader.h"
 
+#include <memory>
 #include <vector>
 
 #include "glm/glm.hpp"
 #include "json/json.h"
 
+#include "Structs/SceneNode/SceneNode.h"
+
 namespace aladdin_3d {
 
 	/**
@@ -49,9 +52,9 @@ namespace aladdin_3d {
 			 * Get the geometries from the loaded model.
 			 * 
 			 * @param geoms Outputs the geometries returned.
-			 * @param matrices Outputs the transformation matrices.
+			 * @param nodes Outputs the node hierarchy, parents first.
 			 */
-			void getGeometries(std::vector<Geometry> *geoms, std::vector<glm::mat4> *matrices);
+			void getGeometries(std::vector<Geometry> *geoms, std::vector<SceneNode> *nodes);
 
 			/**
 			 * @brief Loads the data from the file.
@@ -62,6 +65,15 @@ namespace aladdin_3d {
 
 		private:
 
+			/**
+			 * @brief Loads the animations.
+			 *
+			 * Loads the channels of every animation that move the nodes in the hierarchy.
+			 * The step keys become pairs of keys at the same time, and the cubic spline
+			 * channels are skipped with a warning.
+			 */
+			void loadAnimations();
+
 			/**
 			 * @brief Loads a mesh by its index.
 			 *
@@ -71,20 +83,32 @@ namespace aladdin_3d {
 			 */
 			void loadGeometry(unsigned int indMesh);
 
+			/**
+			 * @brief Loads a skin by its index.
+			 *
+			 * Loads the joints of a skin, as nodes of the hierarchy, and their inverse
+			 * bind matrices.
+			 *
+			 * @param indSkin The index of the skin.
+			 */
+			void loadSkin(unsigned int indSkin);
+
 			/**
 			 * @brief Traverses the nodes in the file.
 			 *
-			 * Traverses the nodes in the file.
+			 * Traverses the nodes in the file, adding them to the hierarchy with their
+			 * transforms relative to their parent.
 			 *
 			 * @param nextNode The index of the next node.
-			 * @param matrix The matrx that will be used.
+			 * @param parent The index of its parent in the hierarchy, -1 for the root.
 			 */
-			void recursiveGetNode(unsigned int nextNode, glm::mat4 matrix = glm::mat4(1.0f));
+			void recursiveGetNode(unsigned int nextNode, int parent = -1);
 
 			// Interprets the binary data into floats, indices, and textures
 			std::vector<float> getFloats(nlohmann::json accessor);
 			std::vector<GLuint> getIndices(nlohmann::json accessor);
-			std::vector<Texture> getTextures();
+			std::vector<glm::vec4> getVec4s(nlohmann::json accessor, bool normalize);
+			std::vector<std::shared_ptr<Texture>> getTextures();
 
 			// Assembles all the floats into vertices
 			std::vector<Vertex> assembleVertices(std::vector<glm::vec3> positions, std::vector<glm::vec3> normals, std::vector<glm::vec2> texUVs);
@@ -96,6 +120,9 @@ namespace aladdin_3d {
 
 			std::vector<unsigned char> bin_data;	/// Binary data stored for convenience.
 			nlohmann::json json_file;				/// The model JSON file contents.
+			std::vector<std::shared_ptr<Texture>> textures;	/// Textures of the file, shared by all its meshes.
+			std::vector<int> node_indices;			/// Index in the hierarchy of every node of the file, -1 if not in it.
+			int skin_index = -1;					/// Index of the skin of the skinned meshes, -1 if none.
 
 	};
 
@@ -0,0 +1,182 @@
+/**
+ * @file MeshAsset.cpp
+ * @brief MeshAsset class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "MeshAsset.h"
+
+#include <memory>
+#include <vector>
+
+#include "glew/glew.h"
+#include "glm/glm.hpp"
+
+#include "Classes/BatchMaths/BatchMaths.h"
+#include "Classes/EBO/EBO.h"
+#include "Classes/Shader/Shader.h"
+#include "Classes/Texture/Texture.h"
+#include "Classes/VAO/VAO.h"
+#include "Classes/VBO/VBO.h"
+#include "Structs/BoundingBox/BoundingBox.h"
+#include "Structs/BoundingSphere/BoundingSphere.h"
+#include "Structs/SkinVertex/SkinVertex.h"
+#include "Structs/Vertex/Vertex.h"
+
+namespace aladdin_3d {
+
+	MeshAsset::MeshAsset(const std::vector<Vertex> &vertices, const std::vector<GLuint> &indices, const std::vector<std::shared_ptr<Texture>> &textures) {
+
+		// Store a copy of these in the attributes.
+		this->vertices = vertices;
+		this->indices = indices;
+		this->textures = textures;
+		this->vertex_count = (GLsizei)vertices.size();
+		this->index_count = (GLsizei)indices.size();
+
+		// Generate a VAO and bind it, generate a VBO for the vertices and a EBO for the indices.
+		// The mesh keeps the buffers so that they are freed together with the VAO.
+		this->vao.bind();
+		this->vbo = VBO(vertices);
+		this->ebo = EBO(indices);
+
+		// Links VBO attributes such as coordinates and colors to VAO.
+		this->vao.link_attribute(this->vbo, 0, 3, GL_FLOAT, sizeof(aladdin_3d::Vertex), (void*)0);
+		this->vao.link_attribute(this->vbo, 1, 3, GL_FLOAT, sizeof(aladdin_3d::Vertex), (void*)(3 * sizeof(float)));
+		this->vao.link_attribute(this->vbo, 2, 3, GL_FLOAT, sizeof(aladdin_3d::Vertex), (void*)(6 * sizeof(float)));
+		this->vao.link_attribute(this->vbo, 3, 2, GL_FLOAT, sizeof(aladdin_3d::Vertex), (void*)(9 * sizeof(float)));
+
+		this->vao.unbind();
+		this->vbo.unbind();
+		this->ebo.unbind();
+
+		// Keep the bounds, they are needed even after the vertices are released.
+		this->bounds = BatchMaths::getBoundingBox(this->vertices.data(), this->vertices.size());
+		this->sphere = BatchMaths::getBoundingSphere(this->vertices.data(), this->vertices.size(), this->bounds);
+
+	}
+
+	void MeshAsset::bind(Shader &shader) {
+
+		this->vao.bind();
+
+		for (size_t i = 0; i < this->textures.size(); i++) {
+
+			shader.passTexture(*this->textures[i]);
+			this->textures[i]->bind();
+
+		}
+
+	}
+
+	void MeshAsset::bindVertices() {
+
+		this->vao.bind();
+
+	}
+
+	const BoundingBox &MeshAsset::getBoundingBox() const {
+
+		return this->bounds;
+
+	}
+
+	const BoundingSphere &MeshAsset::getBoundingSphere() const {
+
+		return this->sphere;
+
+	}
+
+	size_t MeshAsset::getCPUBytes() const {
+
+		return sizeof(MeshAsset) + this->vertices.capacity() * sizeof(Vertex) +
+			this->indices.capacity() * sizeof(GLuint) + this->textures.capacity() * sizeof(std::shared_ptr<Texture>);
+
+	}
+
+	size_t MeshAsset::getGPUBytes() {
+
+		size_t bytes = this->vertex_count * sizeof(Vertex) + this->index_count * sizeof(GLuint) + this->skin_count * sizeof(SkinVertex);
+
+		for (size_t i = 0; i < this->textures.size(); i++)
+			bytes += this->textures[i]->getGPUBytes();
+
+		return bytes;
+
+	}
+
+	GLsizei MeshAsset::getIndexCount() const {
+
+		return this->index_count;
+
+	}
+
+	const std::vector<GLuint> &MeshAsset::getIndices() const {
+
+		return this->indices;
+
+	}
+
+	const std::vector<std::shared_ptr<Texture>> &MeshAsset::getTextures() const {
+
+		return this->textures;
+
+	}
+
+	VAO &MeshAsset::getVAO() {
+
+		return this->vao;
+
+	}
+
+	const std::vector<Vertex> &MeshAsset::getVertices() const {
+
+		return this->vertices;
+
+	}
+
+	GLsizei MeshAsset::getVertexCount() const {
+
+		return this->vertex_count;
+
+	}
+
+	bool MeshAsset::hasCPUData() const {
+
+		return !this->vertices.empty();
+
+	}
+
+	void MeshAsset::releaseCPUData() {
+
+		// Swap them with empty vectors, clearing them would keep their memory.
+		std::vector<Vertex>().swap(this->vertices);
+		std::vector<GLuint>().swap(this->indices);
+
+	}
+
+	void MeshAsset::setSkin(const std::vector<SkinVertex> &skin) {
+
+		this->skin_count = (GLsizei)skin.size();
+
+		// The skin goes in a buffer of its own, so the meshes without one stay the same.
+		this->vao.bind();
+		this->skin_vbo = VBO(skin);
+
+		this->vao.link_attribute(this->skin_vbo, 4, 4, GL_FLOAT, sizeof(aladdin_3d::SkinVertex), (void*)0);
+		this->vao.link_attribute(this->skin_vbo, 5, 4, GL_FLOAT, sizeof(aladdin_3d::SkinVertex), (void*)(4 * sizeof(float)));
+
+		this->vao.unbind();
+
+	}
+
+}  // namespace aladdin_3d
@@ -0,0 +1,218 @@
+/**
+ * @file MeshAsset.h
+ * @brief MeshAsset class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_MESHASSET_H_
+#define ALADDIN_3D_CLASSES_MESHASSET_H_
+
+#include <memory>
+#include <vector>
+
+#include "glew/glew.h"
+
+#include "Classes/EBO/EBO.h"
+#include "Classes/Shader/Shader.h"
+#include "Classes/Texture/Texture.h"
+#include "Classes/VAO/VAO.h"
+#include "Classes/VBO/VBO.h"
+#include "Structs/BoundingBox/BoundingBox.h"
+#include "Structs/BoundingSphere/BoundingSphere.h"
+#include "Structs/SkinVertex/SkinVertex.h"
+#include "Structs/Vertex/Vertex.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of a MeshAsset class.
+	 *
+	 * Holds the part of a geometry that never changes: its buffers on the GPU, its
+	 * textures, its bounds and, until they are released, its vertices and indices.
+	 * It is shared by every Geometry that draws it, so copying a Geometry never
+	 * copies the mesh. It cannot be copied itself.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class MeshAsset {
+
+		public:
+
+			/**
+			 * @brief Uploads a mesh.
+			 *
+			 * Uploads the vertices and indices to OpenGL and keeps a copy of them.
+			 *
+			 * @param vertices Vertices of the mesh.
+			 * @param indices Indices of the vertices.
+			 * @param textures Textures in connection with this mesh, which may be shared with other meshes.
+			 */
+			MeshAsset(const std::vector<Vertex> &vertices, const std::vector<GLuint> &indices, const std::vector<std::shared_ptr<Texture>> &textures);
+
+			MeshAsset(const MeshAsset&) = delete;
+			MeshAsset &operator=(const MeshAsset&) = delete;
+
+			/**
+			 * @brief Binds the mesh.
+			 *
+			 * Binds the VAO of the mesh and passes its textures to the shader.
+			 *
+			 * @param shader The shader the mesh will be drawn with.
+			 */
+			void bind(Shader &shader);
+
+			/**
+			 * @brief Binds the vertices of the mesh.
+			 *
+			 * Binds the VAO of the mesh without its textures.
+			 */
+			void bindVertices();
+
+			/**
+			 * @brief Gets the bounding box.
+			 *
+			 * Gets the bounding box of the mesh, computed when it was uploaded.
+			 *
+			 * @returns The bounding box struct.
+			 */
+			const BoundingBox &getBoundingBox() const;
+
+			/**
+			 * @brief Gets the bounding sphere.
+			 *
+			 * Gets the bounding sphere of the mesh, computed when it was uploaded.
+			 *
+			 * @returns The bounding sphere struct.
+			 */
+			const BoundingSphere &getBoundingSphere() const;
+
+			/**
+			 * @brief Gets the memory used on the CPU.
+			 *
+			 * Gets the bytes used by the mesh in main memory, including its vertices and
+			 * indices while they are kept.
+			 *
+			 * @returns The number of bytes.
+			 */
+			size_t getCPUBytes() const;
+
+			/**
+			 * @brief Gets the memory used on the GPU.
+			 *
+			 * Gets the bytes of the vertex, index and texture data uploaded to OpenGL. A
+			 * texture shared with other meshes is counted in each of them.
+			 *
+			 * @returns The number of bytes.
+			 */
+			size_t getGPUBytes();
+
+			/**
+			 * @brief Get the number of indices.
+			 *
+			 * Get the number of indices uploaded to the GPU.
+			 *
+			 * @returns The number of indices.
+			 */
+			GLsizei getIndexCount() const;
+
+			/**
+			 * @brief Get the indices of the mesh.
+			 *
+			 * Get the indices of the mesh. They are empty once the CPU data is released.
+			 *
+			 * @returns The indices.
+			 */
+			const std::vector<GLuint> &getIndices() const;
+
+			/**
+			 * @brief Get the textures.
+			 *
+			 * Get the textures.
+			 *
+			 * @returns The textures.
+			 */
+			const std::vector<std::shared_ptr<Texture>> &getTextures() const;
+
+			/**
+			 * @brief Get the VAO.
+			 *
+			 * Get the VAO.
+			 *
+			 * @returns The VAO.
+			 */
+			VAO &getVAO();
+
+			/**
+			 * @brief Get the vertices of the mesh.
+			 *
+			 * Get the vertices of the mesh. They are empty once the CPU data is released.
+			 *
+			 * @returns The vertices.
+			 */
+			const std::vector<Vertex> &getVertices() const;
+
+			/**
+			 * @brief Get the number of vertices.
+			 *
+			 * Get the number of vertices uploaded to the GPU.
+			 *
+			 * @returns The number of vertices.
+			 */
+			GLsizei getVertexCount() const;
+
+			/**
+			 * @brief Checks if the CPU data is kept.
+			 *
+			 * Checks if the vertices and indices are still in main memory.
+			 *
+			 * @returns True if they have not been released.
+			 */
+			bool hasCPUData() const;
+
+			/**
+			 * @brief Releases the CPU data.
+			 *
+			 * Frees the vertices and indices, which are already on the GPU. The bounds and
+			 * the number of indices are kept. Every geometry sharing the mesh loses them.
+			 */
+			void releaseCPUData();
+
+			/**
+			 * @brief Skins the mesh.
+			 *
+			 * Uploads the joints and weights of every vertex to their own buffer and links
+			 * them to the attributes 4 and 5 of the VAO, next to the vertices.
+			 *
+			 * @param skin The skinning attributes of every vertex.
+			 */
+			void setSkin(const std::vector<SkinVertex> &skin);
+
+		private:
+
+			std::vector<GLuint> indices;				/// Indices of the vertices.
+			std::vector<std::shared_ptr<Texture>> textures;	/// Textures that will color this mesh.
+			VAO vao;									/// VAO containing this mesh.
+			VBO vbo;									/// VBO with the vertices of the mesh.
+			EBO ebo;									/// EBO with the indices of the mesh.
+			VBO skin_vbo;								/// VBO with the joints and weights of the vertices, if skinned.
+			std::vector<Vertex> vertices;				/// Mesh vertices.
+			BoundingBox bounds;							/// Bounding box of the vertices.
+			BoundingSphere sphere;						/// Bounding sphere of the vertices.
+			GLsizei vertex_count = 0;					/// Number of vertices uploaded to the GPU.
+			GLsizei index_count = 0;					/// Number of indices uploaded to the GPU.
+			GLsizei skin_count = 0;						/// Number of skinning attributes uploaded to the GPU.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_MESHASSET_H_
@@ -17,26 +17,37 @@
 
 #include <cassert>
 #include <iostream>
+#include <memory>
+#include <string>
 
 #include "json/json.h"
 
+#include "Classes/Animator/Animator.h"
 #include "Classes/Loader/Loader.h"
 #include "Classes/LoaderGLTF/LoaderGLTF.h"
+#include "Classes/SceneGraph/SceneGraph.h"
+#include "Structs/AnimationClip/AnimationClip.h"
 #include "Structs/Vertex/Vertex.h"
 #include "Structs/BoundingBox/BoundingBox.h"
+#include "Structs/BoundingSphere/BoundingSphere.h"
+#include "Structs/SceneNode/SceneNode.h"
+#include "Structs/Skin/Skin.h"
+#include "Structs/SkinVertex/SkinVertex.h"
 
 namespace aladdin_3d {
 
+	const size_t Object::max_joints;
+
 	Object::Object(const char *filename, const char* filetype) {
 
-		// Build the loader for this file type.
-		Loader *model_loader;
+		// Build the loader for this file type. It has to live until the geometries are
+		// copied, and then free its own copy of them.
+		std::unique_ptr<Loader> model_loader;
 
 		// Choose the specific loader type.
 		if (filetype == "GLTF") {
 
-			LoaderGLTF model_loader_gltf(filename);
-			model_loader = &model_loader_gltf;
+			model_loader = std::make_unique<LoaderGLTF>(filename);
 
 		} else {
 
@@ -47,7 +58,52 @@ namespace aladdin_3d {
 		
 		(*model_loader).loadModel();
 
-		(*model_loader).getGeometries(&this->geoms, &this->matrices_geoms);
+		std::vector<SceneNode> nodes;
+		(*model_loader).getGeometries(&this->geoms, &nodes);
+
+		Skin skin;
+		std::vector<AnimationClip> animations;
+		(*model_loader).getAnimations(&skin, &animations);
+
+		// The root holds the transforms of the object and the nodes of the model hang
+		// from it, one position later than in the model.
+		this->graph.addNode(-1);
+		std::vector<int> nodes_geoms(this->geoms.size(), 0);
+
+		for (size_t i = 0; i < nodes.size(); i++) {
+
+			int node = this->graph.addNode(nodes[i].parent + 1, nodes[i].translation, nodes[i].rotation, nodes[i].scale);
+
+			if (nodes[i].geometry >= 0)
+				nodes_geoms[nodes[i].geometry] = node;
+
+		}
+
+		// The nodes of the geometries and the name are the same for every copy, so they are shared.
+		this->geometry_nodes = std::make_shared<std::vector<int>>(nodes_geoms);
+		this->name = std::make_shared<std::string>(filename);
+
+		// The skin and the animations move the nodes of the model, which are also one position later.
+		for (size_t i = 0; i < animations.size(); i++) {
+
+			for (size_t j = 0; j < animations[i].channels.size(); j++)
+				animations[i].channels[j].node++;
+
+		}
+
+		if (!animations.empty())
+			this->animations = std::make_shared<std::vector<AnimationClip>>(animations);
+
+		if (!skin.joints.empty()) {
+
+			for (size_t i = 0; i < skin.joints.size(); i++)
+				skin.joints[i]++;
+
+			this->setSkin(skin);
+
+		}
+
+		this->update();
 
 	}
 
@@ -56,126 +112,453 @@ namespace aladdin_3d {
 		// Copy the geometries.
 		this->geoms = geometries;
 
-		// Get an identity matrix for each.
-		this->matrices_geoms = std::vector<glm::mat4>(geometries.size(), glm::mat4(1.0f));
+		// Hang a node from the root for each, keeping the transforms it had.
+		this->graph.addNode(-1);
+		std::vector<int> nodes_geoms;
+
+		for (size_t i = 0; i < geometries.size(); i++) {
+
+			glm::vec3 translation;
+			glm::quat rotation;
+			glm::vec3 scale;
+			SceneGraph::decompose(geometries[i].getTransforms(), &translation, &rotation, &scale);
+			nodes_geoms.push_back(this->graph.addNode(0, translation, rotation, scale));
+
+		}
+
+		this->geometry_nodes = std::make_shared<std::vector<int>>(nodes_geoms);
+
+		this->update();
 
 	}
 
-	void Object::draw(aladdin_3d::Shader& shader, aladdin_3d::Camera& camera)
+	void Object::animate(Animator &animator, float time) {
+
+		animator.apply(time, &this->graph);
+		this->bounds_dirty = true;
+
+	}
+
+	void Object::bindRigidSkin() {
+
+		// Every geometry becomes a joint of its own, and all its vertices follow it.
+		const std::vector<int> &nodes = *this->geometry_nodes;
+		Skin skin;
+
+		for (size_t i = 0; i < this->geoms.size(); i++) {
+
+			skin.joints.push_back(nodes[i]);
+			skin.inverse_binds.push_back(glm::mat4(1.0f));
+
+			SkinVertex vertex;
+			vertex.joints = glm::vec4((float)i, 0.0f, 0.0f, 0.0f);
+			vertex.weights = glm::vec4(1.0f, 0.0f, 0.0f, 0.0f);
+
+			const std::shared_ptr<MeshAsset> &mesh = this->geoms[i].getMesh();
+			mesh->setSkin(std::vector<SkinVertex>(mesh->getVertexCount(), vertex));
+
+		}
+
+		this->setSkin(skin);
+
+	}
+
+	void Object::draw(aladdin_3d::Shader& shader)
 	{
 		// Go over all meshes and draw each one
 		for (unsigned int i = 0; i < this->geoms.size(); i++)
 		{
-			geoms[i].draw(shader, camera);
+			geoms[i].draw(shader);
 		}
 	}
 
-	BoundingBox Object::getBoundingBox() {
+	void Object::draw(Shader &shader, const GLint *draw_indices) {
+
+		for (size_t i = 0; i < this->geoms.size(); i++) {
 
-		// Create the bb.
-		BoundingBox global_bb = this->geoms[0].getBoundingBox();
+			geoms[i].draw(shader, draw_indices[i]);
 
-		// Loop through the vertices and get tge min and max values.
-		for (int i = 1; i < this->geoms.size(); i++) {
+		}
 
-			// Get the current bb.
-			BoundingBox bb = this->geoms[i].getBoundingBox();
+	}
 
-			if (global_bb.min.x > bb.min.x)
-				global_bb.min.x = bb.min.x;
+	void Object::drawDepth(Shader &shader) {
 
-			if (global_bb.min.y > bb.min.y)
-				global_bb.min.y = bb.min.y;
+		// Go over all meshes and draw their depth.
+		for (size_t i = 0; i < this->geoms.size(); i++) {
 
-			if (global_bb.min.z > bb.min.z)
-				global_bb.min.z = bb.min.z;
+			geoms[i].drawDepth(shader);
 
-			if (global_bb.max.x < bb.max.x)
-				global_bb.max.x = bb.max.x;
+		}
+
+	}
 
-			if (global_bb.max.y < bb.max.y)
-				global_bb.max.y = bb.max.y;
+	void Object::drawDepth(Shader &shader, const GLint *draw_indices) {
 
-			if (global_bb.max.z < bb.max.z)
-				global_bb.max.z = bb.max.z;
+		for (size_t i = 0; i < this->geoms.size(); i++) {
+
+			geoms[i].drawDepth(shader, draw_indices[i]);
 
 		}
 
-		return global_bb;
+	}
+
+	void Object::drawInstanced(Shader &shader, GLsizei instances) {
+
+		// Go over all meshes and draw all their instances.
+		for (size_t i = 0; i < this->geoms.size(); i++) {
+
+			geoms[i].drawInstanced(shader, instances);
+
+		}
+
+	}
+
+	const std::vector<AnimationClip> &Object::getAnimations() const {
+
+		// Most models have no animations.
+		static const std::vector<AnimationClip> none;
+
+		return this->animations ? *this->animations : none;
+
+	}
+
+	BoundingBox Object::getBoundingBox() const {
+
+		this->updateBounds();
+
+		return this->bounds;
+
+	}
+
+	BoundingBox Object::getWorldBoundingBox() const {
+
+		this->updateBounds();
+
+		return this->world_bounds;
+
+	}
+
+	BoundingSphere Object::getWorldBoundingSphere() const {
+
+		this->updateBounds();
+
+		return this->world_sphere;
+
+	}
+
+	glm::mat4 Object::getWorldMatrix(size_t num) const {
+
+		// The skinned geometries are placed by the root.
+		int node = this->skin ? 0 : (*this->geometry_nodes)[num];
+
+		return this->graph.getRelativeMatrix(node, -1);
 
 	}
 
-	std::vector<Geometry> Object::getGeometries() {
+	size_t Object::getCPUBytes() const {
+
+		size_t bytes = sizeof(Object) + this->graph.getCPUBytes() + this->palette.capacity() * sizeof(glm::mat4);
+
+		for (size_t i = 0; i < this->geoms.size(); i++)
+			bytes += this->geoms[i].getCPUBytes();
+
+		return bytes;
+
+	}
+
+	size_t Object::getGPUBytes() {
+
+		size_t bytes = 0;
+
+		for (size_t i = 0; i < this->geoms.size(); i++)
+			bytes += this->geoms[i].getGPUBytes();
+
+		return bytes;
+
+	}
+
+	size_t Object::getSharedCPUBytes() const {
+
+		size_t bytes = this->geometry_nodes->capacity() * sizeof(int);
+
+		if (this->name)
+			bytes += sizeof(std::string) + this->name->capacity();
+
+		if (this->skin)
+			bytes += sizeof(Skin) + this->skin->joints.capacity() * sizeof(int) + this->skin->inverse_binds.capacity() * sizeof(glm::mat4);
+
+		for (size_t i = 0; i < this->geoms.size(); i++)
+			bytes += this->geoms[i].getSharedCPUBytes();
+
+		return bytes;
+
+	}
+
+	const std::vector<Geometry> &Object::getGeometries() {
+
+		this->update();
 
 		return this->geoms;
 
 	}
 
-	std::vector<glm::mat4> Object::getGeometryMatrices() {
+	size_t Object::getGeometryCount() {
 
-		return this->matrices_geoms;
+		return this->geoms.size();
 
 	}
 
-	void Object::resetTransforms() {
+	int Object::getGeometryNode(int num) const {
 
-		// Do the same for the subobjects.
-		for (size_t i = 0; i < geoms.size(); i++) {
+		return (*this->geometry_nodes)[num];
 
-			geoms[i].resetTransforms();
+	}
 
-		}
+	const std::vector<glm::mat4> &Object::getPalette() {
+
+		this->update();
+
+		return this->palette;
 
 	}
 
-	void Object::rotate(float x, float y, float z, float angle) {
+	const SceneGraph &Object::getSceneGraph() {
+
+		this->update();
+
+		return this->graph;
+
+	}
+
+	void Object::getTransforms(int num, glm::vec3 *translation, glm::quat *rotation, glm::vec3 *scale) {
+
+		this->graph.getTransforms((*this->geometry_nodes)[num], translation, rotation, scale);
+
+	}
+
+	const std::string &Object::getName() {
+
+		// Objects made from geometries have no name until they are given one.
+		static const std::string unnamed;
+
+		return this->name ? *this->name : unnamed;
+
+	}
+
+	bool Object::isSkinned() const {
+
+		return this->skin != nullptr;
+
+	}
+
+	void Object::releaseCPUData() {
 
-		// Do the same for the subobjects.
 		for (size_t i = 0; i < geoms.size(); i++) {
 
-			geoms[i].rotate(x, y, z, angle);
+			geoms[i].releaseCPUData();
 
 		}
 
 	}
 
+	void Object::resetTransforms() {
+
+		// Only the root, the model keeps its own nodes.
+		this->graph.setTransforms(0, glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f));
+		this->bounds_dirty = true;
+
+	}
+
+	void Object::rotate(float x, float y, float z, float angle) {
+
+		// The geometries hang from the root, so they all follow it.
+		this->graph.rotate(0, glm::vec3(x, y, z), angle);
+		this->bounds_dirty = true;
+
+	}
+
 	void Object::rotate(int num, float x, float y, float z, float angle) {
 
-		geoms[num].rotate(x, y, z, angle);
+		this->graph.rotate((*this->geometry_nodes)[num], glm::vec3(x, y, z), angle);
+		this->bounds_dirty = true;
 
 	}
 
 	void Object::scale(float x, float y, float z) {
 
-		// Do the same for the subobjects.
-		for (size_t i = 0; i < geoms.size(); i++) {
+		this->graph.scale(0, glm::vec3(x, y, z));
+		this->bounds_dirty = true;
+
+	}
+
+	void Object::scale(int num, float x, float y, float z) {
+
+		this->graph.scale((*this->geometry_nodes)[num], glm::vec3(x, y, z));
+		this->bounds_dirty = true;
 
-			geoms[i].scale(x, y, z);
+	}
+
+	void Object::setName(const char *name) {
+
+		this->name = std::make_shared<std::string>(name);
+
+	}
+
+	void Object::setSkin(const Skin &skin) {
+
+		if (skin.joints.size() > max_joints) {
+
+			std::cerr << "Error 121-1007 - The skin has more joints than the shaders support." << std::endl;
+			exit(1);
 
 		}
 
+		this->skin = std::make_shared<Skin>(skin);
+		this->palette = std::vector<glm::mat4>(skin.joints.size(), glm::mat4(1.0f));
+
+		// Place the geometries and the joints once, after that only what changes is updated.
+		this->graph.update();
+		this->bounds_dirty = true;
+
+		for (size_t i = 0; i < this->geoms.size(); i++)
+			this->geoms[i].setTransforms(this->graph.getWorld(0));
+
+		for (size_t i = 0; i < skin.joints.size(); i++)
+			this->palette[i] = this->graph.getRelativeMatrix(skin.joints[i], 0) * skin.inverse_binds[i];
+
 	}
 
-	void Object::scale(int num, float x, float y, float z) {
+	void Object::setTransforms(int num, const glm::vec3 &translation, const glm::quat &rotation, const glm::vec3 &scale) {
 
-		geoms[num].scale(x, y, z);
+		this->graph.setTransforms((*this->geometry_nodes)[num], translation, rotation, scale);
+		this->bounds_dirty = true;
 
 	}
 
-	void Object::translate(float x, float y, float z) {
+	void Object::stage(TransformBatch &batch) {
+
+		this->update();
 
 		// Do the same for the subobjects.
 		for (size_t i = 0; i < geoms.size(); i++) {
 
-			geoms[i].translate(x, y, z);
+			geoms[i].stage(batch);
 
 		}
 
 	}
 
+	void Object::translate(float x, float y, float z) {
+
+		this->graph.translate(0, glm::vec3(x, y, z));
+		this->bounds_dirty = true;
+
+	}
+
 	void Object::translate(int num, float x, float y, float z) {
 
-		geoms[num].translate(x, y, z);
+		this->graph.translate((*this->geometry_nodes)[num], glm::vec3(x, y, z));
+		this->bounds_dirty = true;
+
+	}
+
+	BoundingBox Object::transformBoundingBox(const BoundingBox &box) const {
+
+		return Geometry::transformBoundingBox(this->getWorldMatrix(0), box);
+
+	}
+
+	void Object::update() {
+
+		if (!this->graph.isDirty())
+			return;
+
+		this->graph.update();
+
+		// The skinned geometries are placed by the root, and the joints move their vertices.
+		if (this->skin) {
+
+			if (this->graph.hasChanged(0)) {
+
+				for (size_t i = 0; i < this->geoms.size(); i++)
+					this->geoms[i].setTransforms(this->graph.getWorld(0));
+
+			}
+
+			for (size_t i = 0; i < this->skin->joints.size(); i++) {
+
+				if (this->graph.hasChanged(this->skin->joints[i]))
+					this->palette[i] = this->graph.getRelativeMatrix(this->skin->joints[i], 0) * this->skin->inverse_binds[i];
+
+			}
+
+			return;
+
+		}
+
+		// Hand the new world matrices to the geometries whose nodes changed.
+		const std::vector<int> &nodes = *this->geometry_nodes;
+
+		for (size_t i = 0; i < this->geoms.size(); i++) {
+
+			if (this->graph.hasChanged(nodes[i]))
+				this->geoms[i].setTransforms(this->graph.getWorld(nodes[i]));
+
+		}
+
+	}
+
+	void Object::updateBounds() const {
+
+		if (!this->bounds_dirty)
+			return;
+
+		this->bounds_dirty = false;
+
+		// Place every geometry with the nodes of the model below the root, and with the whole graph. The
+		// matrices come from the local transforms, so the graph does not need to be updated first.
+		const std::vector<int> &nodes = *this->geometry_nodes;
+
+		for (size_t i = 0; i < this->geoms.size(); i++) {
+
+			glm::mat4 world = this->getWorldMatrix(i);
+			BoundingBox bb = Geometry::transformBoundingBox(this->graph.getRelativeMatrix(nodes[i], 0), this->geoms[i].getBoundingBox());
+			BoundingBox world_bb = Geometry::transformBoundingBox(world, this->geoms[i].getBoundingBox());
+			BoundingSphere sphere = Geometry::transformBoundingSphere(world, this->geoms[i].getBoundingSphere());
+
+			if (i == 0) {
+
+				this->bounds = bb;
+				this->world_bounds = world_bb;
+				this->world_sphere = sphere;
+				continue;
+
+			}
+
+			this->bounds.min = glm::min(this->bounds.min, bb.min);
+			this->bounds.max = glm::max(this->bounds.max, bb.max);
+			this->world_bounds.min = glm::min(this->world_bounds.min, world_bb.min);
+			this->world_bounds.max = glm::max(this->world_bounds.max, world_bb.max);
+
+			// Grow the sphere just enough to hold the new one, unless one already holds the other.
+			float distance = glm::length(sphere.centre - this->world_sphere.centre);
+
+			if (distance + sphere.radius <= this->world_sphere.radius)
+				continue;
+
+			if (distance + this->world_sphere.radius <= sphere.radius) {
+
+				this->world_sphere = sphere;
+				continue;
+
+			}
+
+			float radius = (distance + this->world_sphere.radius + sphere.radius) * 0.5f;
+			this->world_sphere.centre += (sphere.centre - this->world_sphere.centre) * ((radius - this->world_sphere.radius) / distance);
+			this->world_sphere.radius = radius;
+
+		}
 
 	}
 
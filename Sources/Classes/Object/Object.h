@@ -16,13 +16,21 @@
 #ifndef ALADDIN_3D_CLASSES_OBJECT_H_
 #define ALADDIN_3D_CLASSES_OBJECT_H_
 
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "json/json.h"
 
+#include "Classes/Animator/Animator.h"
 #include "Classes/Geometry/Geometry.h"
 #include "Classes/Loader/Loader.h"
+#include "Classes/SceneGraph/SceneGraph.h"
+#include "Classes/TransformBatch/TransformBatch.h"
+#include "Structs/AnimationClip/AnimationClip.h"
 #include "Structs/BoundingBox/BoundingBox.h"
+#include "Structs/BoundingSphere/BoundingSphere.h"
+#include "Structs/Skin/Skin.h"
 
 namespace aladdin_3d {
 
@@ -49,40 +57,234 @@ namespace aladdin_3d {
 			 */
 			Object(std::vector<Geometry> geometries);
 
+			/**
+			 * @brief Animates the object.
+			 *
+			 * Plays a clip on the nodes of the object at a time. Only the animated nodes
+			 * are recomputed in the next update.
+			 *
+			 * @param animator The animator with the clip.
+			 * @param time The time in seconds.
+			 */
+			void animate(Animator &animator, float time);
+
+			/**
+			 * @brief Skins the object with its own nodes.
+			 *
+			 * Turns the node of every geometry into a joint that moves the whole geometry,
+			 * so that animating the nodes only changes the palette. It needs no vertices,
+			 * so it can be done after releasing them.
+			 */
+			void bindRigidSkin();
+
 			/**
 			 * @brief Draws this object.
 			 *
 			 * Draws this object.
+			 *
+			 * @param shader The shader used to draw the object.
 			 */
-			void draw(Shader &shader, Camera &camera);
+			void draw(Shader &shader);
+
+			/**
+			 * @brief Draws this object with its matrices somewhere else.
+			 *
+			 * Draws this object, reading the matrices of every geometry from the stream
+			 * buffer at the draw indices staged by someone else.
+			 *
+			 * @param shader The shader used to draw the object.
+			 * @param draw_indices The draw index of every geometry.
+			 */
+			void draw(Shader &shader, const GLint *draw_indices);
+
+			/**
+			 * @brief Draws the depth of this object.
+			 *
+			 * Draws the depth of this object for the depth pre-pass.
+			 *
+			 * @param shader The depth shader.
+			 */
+			void drawDepth(Shader &shader);
+
+			/**
+			 * @brief Draws the depth of this object with its matrices somewhere else.
+			 *
+			 * Draws the depth of this object for the depth pre-pass, reading the matrices
+			 * of every geometry at the draw indices staged by someone else.
+			 *
+			 * @param shader The depth shader.
+			 * @param draw_indices The draw index of every geometry.
+			 */
+			void drawDepth(Shader &shader, const GLint *draw_indices);
+
+			/**
+			 * @brief Draws several instances of this object.
+			 *
+			 * Draws every geometry of this object several times, one call per geometry.
+			 *
+			 * @param shader The shader used to draw the object.
+			 * @param instances The number of instances.
+			 */
+			void drawInstanced(Shader &shader, GLsizei instances);
+
+			/**
+			 * @brief Gets the animations.
+			 *
+			 * Gets the animations of the model the object was loaded from, if any.
+			 *
+			 * @returns The animations.
+			 */
+			const std::vector<AnimationClip> &getAnimations() const;
 
 			/**
 			 * @brief Gets the bounding box.
 			 *
-			 * Gets the bounding box of all the geometries.
+			 * Gets the bounding box of all the geometries in the coordinates of the model,
+			 * with the transforms of its own nodes but not those of the object. It is kept
+			 * until a node moves.
 			 *
 			 * @returns The bounding box struct.
 			 */
-			BoundingBox getBoundingBox();
+			BoundingBox getBoundingBox() const;
+
+			/**
+			 * @brief Gets the world bounding box.
+			 *
+			 * Gets the bounding box of all the geometries after applying their transforms.
+			 * It is kept until a node moves.
+			 *
+			 * @returns The bounding box struct.
+			 */
+			BoundingBox getWorldBoundingBox() const;
+
+			/**
+			 * @brief Gets the world bounding sphere.
+			 *
+			 * Gets a sphere that contains the bounding spheres of all the geometries after
+			 * applying their transforms. It is kept until a node moves.
+			 *
+			 * @returns The bounding sphere struct.
+			 */
+			BoundingSphere getWorldBoundingSphere() const;
+
+			/**
+			 * @brief Gets the memory used on the CPU.
+			 *
+			 * Gets the bytes used by this copy of the object and its geometries in main
+			 * memory, without what is shared with the other copies.
+			 *
+			 * @returns The number of bytes.
+			 */
+			size_t getCPUBytes() const;
+
+			/**
+			 * @brief Gets the memory used on the GPU.
+			 *
+			 * Gets the bytes uploaded to OpenGL by the geometries, which are shared by
+			 * all the copies of the object.
+			 *
+			 * @returns The number of bytes.
+			 */
+			size_t getGPUBytes();
+
+			/**
+			 * @brief Gets the shared memory used on the CPU.
+			 *
+			 * Gets the bytes used in main memory by the meshes, nodes and name that all
+			 * the copies of the object share.
+			 *
+			 * @returns The number of bytes.
+			 */
+			size_t getSharedCPUBytes() const;
 
 			/**
 			 * @brief Get the geometries of the object.
 			 * 
-			 * Get the geometries of the object.
+			 * Get the geometries of the object, with their transforms up to date.
 			 */
-			std::vector<Geometry> getGeometries();
+			const std::vector<Geometry> &getGeometries();
 
 			/**
-			 * @brief Get the matrices of the geometries.
-			 * 
-			 * Get the matrices of the geometries.
+			 * @brief Get the number of geometries of the object.
+			 *
+			 * Get the number of geometries of the object.
 			 */
-			std::vector<glm::mat4> getGeometryMatrices();
+			size_t getGeometryCount();
 
 			/**
-			 * @brief Reset 
+			 * @brief Get the node of a geometry.
 			 *
-			 * Add a translation matrix to the model.
+			 * Get the index of the node of a geometry in the scene graph.
+			 *
+			 * @param num The geometry index.
+			 *
+			 * @returns The index of the node.
+			 */
+			int getGeometryNode(int num) const;
+
+			/**
+			 * @brief Get the joint palette.
+			 *
+			 * Get the matrix of every joint of the skin, which takes the vertices to the
+			 * coordinates of the root, with the current pose.
+			 *
+			 * @returns The palette, empty if the object is not skinned.
+			 */
+			const std::vector<glm::mat4> &getPalette();
+
+			/**
+			 * @brief Get the scene graph of the object.
+			 *
+			 * Get the node hierarchy of the object. Node 0 holds the transforms of the
+			 * object and the nodes of the model hang from it.
+			 *
+			 * @returns The scene graph.
+			 */
+			const SceneGraph &getSceneGraph();
+
+			/**
+			 * @brief Get the transforms of a geometry.
+			 *
+			 * Get the transforms of the node of a geometry relative to its parent.
+			 *
+			 * @param num The geometry index.
+			 * @param translation Outputs the translation.
+			 * @param rotation Outputs the rotation.
+			 * @param scale Outputs the scale.
+			 */
+			void getTransforms(int num, glm::vec3 *translation, glm::quat *rotation, glm::vec3 *scale);
+
+			/**
+			 * @brief Get the name of the object.
+			 *
+			 * Get the name of the asset the object comes from.
+			 *
+			 * @returns The name of the object.
+			 */
+			const std::string &getName();
+
+			/**
+			 * @brief Checks if the object is skinned.
+			 *
+			 * Checks if the geometries are moved by the joints of a skin.
+			 *
+			 * @returns True if the object has a skin.
+			 */
+			bool isSkinned() const;
+
+			/**
+			 * @brief Releases the CPU data.
+			 *
+			 * Frees the vertices and indices of all the geometries, which are already on
+			 * the GPU. Objects that still need their meshes, for instance to fit an
+			 * occluder, must do it before.
+			 */
+			void releaseCPUData();
+
+			/**
+			 * @brief Reset the transforms of the object.
+			 *
+			 * Resets the transforms of the object, keeping those of the model nodes.
 			 */
 			void resetTransforms();
 
@@ -134,6 +336,51 @@ namespace aladdin_3d {
 			 */
 			void scale(int num, float x, float y, float z);
 
+			/**
+			 * @brief Sets the transforms of a geometry.
+			 *
+			 * Replaces the transforms of the node of a geometry relative to its parent.
+			 * Only its subtree is recomputed in the next update.
+			 *
+			 * @param num The geometry index this will apply to.
+			 * @param translation The translation.
+			 * @param rotation The rotation.
+			 * @param scale The scale.
+			 */
+			void setTransforms(int num, const glm::vec3 &translation, const glm::quat &rotation, const glm::vec3 &scale);
+
+			/**
+			 * @brief Set the name of the object.
+			 *
+			 * Set the name of the asset the object comes from.
+			 *
+			 * @param name The name of the object.
+			 */
+			void setName(const char *name);
+
+			/**
+			 * @brief Sets the skin of the object.
+			 *
+			 * Makes the object skinned. From then on the geometries are placed by the root
+			 * and their vertices are moved by the palette of the joints, which the shader
+			 * needs to draw them.
+			 *
+			 * @param skin The skin, with nodes of this object as joints.
+			 *
+			 * @throws 121-1007 The skin has more joints than the shaders support.
+			 */
+			void setSkin(const Skin &skin);
+
+			/**
+			 * @brief Adds the object to the transform batch.
+			 *
+			 * Updates the transforms and adds all the geometries to the batch that
+			 * computes the per-draw data.
+			 *
+			 * @param batch The transform batch of the current frame.
+			 */
+			void stage(TransformBatch &batch);
+
 			/**
 			 * @brief Add a translation matrix to the model.
 			 * 
@@ -157,11 +404,71 @@ namespace aladdin_3d {
 			 */
 			void translate(int num, float x, float y, float z);
 
+			/**
+			 * @brief Transforms a bounding box.
+			 *
+			 * Applies the transforms of the object to a box in the local coordinates of its
+			 * geometries. It uses the first geometry, so the rest must not have been moved apart.
+			 *
+			 * @param box The box in local coordinates.
+			 *
+			 * @returns The bounding box of the transformed box.
+			 */
+			BoundingBox transformBoundingBox(const BoundingBox &box) const;
+
+			/**
+			 * @brief Updates the transforms.
+			 *
+			 * Recomputes the world matrices of the nodes that changed and hands them to
+			 * their geometries, or to the palette if the object is skinned. It does nothing
+			 * if no node changed. The moves only mark the nodes dirty, and it runs when the
+			 * object is staged or its geometries, palette or graph are read.
+			 */
+			void update();
+
+			static const size_t max_joints = 32;	/// Number of joints the shaders support.
+
 		private:
 
-			// All the geometries and transformations
+			/**
+			 * @brief Gets the world matrix of a geometry.
+			 *
+			 * Composes the local transforms from the node of a geometry up to the root, so
+			 * it is right even before the graph is updated.
+			 *
+			 * @param num The number of the geometry.
+			 *
+			 * @returns The world matrix.
+			 */
+			glm::mat4 getWorldMatrix(size_t num) const;
+
+			/**
+			 * @brief Updates the bounds.
+			 *
+			 * Merges the bounds of the geometries again if a node moved since the last time.
+			 */
+			void updateBounds() const;
+
+			// All the geometries and their transforms. The node of every geometry is the
+			// same for every copy, so it is shared.
 			std::vector<Geometry> geoms;
-			std::vector<glm::mat4> matrices_geoms;
+			std::shared_ptr<const std::vector<int>> geometry_nodes;
+			SceneGraph graph;
+
+			// Name of the asset, the file it was loaded from by default.
+			std::shared_ptr<const std::string> name;
+
+			// The skin and the animations of the model, shared by every copy, and the
+			// palette of this copy.
+			std::shared_ptr<const Skin> skin;
+			std::shared_ptr<const std::vector<AnimationClip>> animations;
+			std::vector<glm::mat4> palette;
+
+			// The bounds of this copy, merged again on the first query after a node moves.
+			mutable BoundingBox bounds;
+			mutable BoundingBox world_bounds;
+			mutable BoundingSphere world_sphere;
+			mutable bool bounds_dirty = true;
 
 	};
 
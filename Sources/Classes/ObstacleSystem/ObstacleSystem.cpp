@@ -0,0 +1,129 @@
+/**
+ * @file ObstacleSystem.cpp
+ * @brief ObstacleSystem class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+
+#include "ObstacleSystem.h"
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "glm/glm.hpp"
+
+#include "Structs/BoundingBox/BoundingBox.h"
+
+namespace aladdin_3d {
+
+	void ObstacleSystem::add(ObstacleTypes type, const BoundingBox &bounds, float position) {
+
+		this->positions.push_back(position);
+		this->types.push_back((unsigned char)type);
+		this->bounds_min.push_back(bounds.min);
+		this->bounds_max.push_back(bounds.max);
+
+	}
+
+	void ObstacleSystem::clear() {
+
+		this->positions.clear();
+		this->types.clear();
+		this->bounds_min.clear();
+		this->bounds_max.clear();
+
+	}
+
+	BoundingBox ObstacleSystem::getBounds(size_t obstacle) const {
+
+		BoundingBox bounds;
+		bounds.min = this->bounds_min[obstacle];
+		bounds.max = this->bounds_max[obstacle];
+
+		return bounds;
+
+	}
+
+	size_t ObstacleSystem::getCPUBytes() const {
+
+		return this->positions.capacity() * sizeof(float) +
+			this->types.capacity() * sizeof(unsigned char) +
+			(this->bounds_min.capacity() + this->bounds_max.capacity()) * sizeof(glm::vec3);
+
+	}
+
+	float ObstacleSystem::getPosition(size_t obstacle) const {
+
+		return this->positions[obstacle];
+
+	}
+
+	ObstacleSystem::ObstacleTypes ObstacleSystem::getType(size_t obstacle) const {
+
+		return (ObstacleTypes)this->types[obstacle];
+
+	}
+
+	void ObstacleSystem::reserve(size_t count) {
+
+		this->positions.reserve(count);
+		this->types.reserve(count);
+		this->bounds_min.reserve(count);
+		this->bounds_max.reserve(count);
+
+	}
+
+	size_t ObstacleSystem::size() const {
+
+		return this->positions.size();
+
+	}
+
+	void ObstacleSystem::sort() {
+
+		std::vector<size_t> order(this->positions.size());
+		std::iota(order.begin(), order.end(), 0);
+
+		const std::vector<float> &positions = this->positions;
+
+		std::stable_sort(order.begin(), order.end(), [&positions](size_t a, size_t b) {
+
+			return positions[a] < positions[b];
+
+		});
+
+		// Move every array into the new order.
+		std::vector<float> sorted_positions(order.size());
+		std::vector<unsigned char> sorted_types(order.size());
+		std::vector<glm::vec3> sorted_min(order.size());
+		std::vector<glm::vec3> sorted_max(order.size());
+
+		for (size_t i = 0; i < order.size(); i++) {
+
+			sorted_positions[i] = this->positions[order[i]];
+			sorted_types[i] = this->types[order[i]];
+			sorted_min[i] = this->bounds_min[order[i]];
+			sorted_max[i] = this->bounds_max[order[i]];
+
+		}
+
+		this->positions.swap(sorted_positions);
+		this->types.swap(sorted_types);
+		this->bounds_min.swap(sorted_min);
+		this->bounds_max.swap(sorted_max);
+
+	}
+
+}  // namespace aladdin_3d
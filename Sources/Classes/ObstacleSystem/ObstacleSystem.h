@@ -0,0 +1,144 @@
+/**
+ * @file ObstacleSystem.h
+ * @brief ObstacleSystem class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_OBSTACLESYSTEM_H_
+#define ALADDIN_3D_CLASSES_OBSTACLESYSTEM_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "glm/glm.hpp"
+
+#include "Structs/BoundingBox/BoundingBox.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of an ObstacleSystem class.
+	 *
+	 * Keeps the obstacles of the corridor as a structure of arrays sorted by their
+	 * position along Z, with a compact type and the world bounds of each one. The
+	 * broadphase is filled from it in that order.
+	 *
+	 * The obstacles are added once when the scene is built and then sorted, and do
+	 * not change after that.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class ObstacleSystem {
+
+		public:
+
+			enum ObstacleTypes { BOX };
+
+			/**
+			 * @brief Adds an obstacle.
+			 *
+			 * Adds an obstacle at the end of the system. The system has to be sorted
+			 * again before testing it.
+			 *
+			 * @param type The type of the obstacle.
+			 * @param bounds The world bounding box of the obstacle.
+			 * @param position The position of the obstacle along Z.
+			 */
+			void add(ObstacleTypes type, const BoundingBox &bounds, float position);
+
+			/**
+			 * @brief Removes every obstacle.
+			 *
+			 * Removes every obstacle, keeping the memory of the arrays.
+			 */
+			void clear();
+
+			/**
+			 * @brief Gets the world bounding box of an obstacle.
+			 *
+			 * Gets the world bounding box of an obstacle.
+			 *
+			 * @param obstacle The index of the obstacle, in order along Z.
+			 *
+			 * @returns The bounding box.
+			 */
+			BoundingBox getBounds(size_t obstacle) const;
+
+			/**
+			 * @brief Gets the memory used on the CPU.
+			 *
+			 * Gets the bytes reserved by the arrays.
+			 *
+			 * @returns The number of bytes.
+			 */
+			size_t getCPUBytes() const;
+
+			/**
+			 * @brief Gets the position of an obstacle.
+			 *
+			 * Gets the position of an obstacle along Z.
+			 *
+			 * @param obstacle The index of the obstacle, in order along Z.
+			 *
+			 * @returns The position.
+			 */
+			float getPosition(size_t obstacle) const;
+
+			/**
+			 * @brief Gets the type of an obstacle.
+			 *
+			 * Gets the type of an obstacle.
+			 *
+			 * @param obstacle The index of the obstacle, in order along Z.
+			 *
+			 * @returns The type.
+			 */
+			ObstacleTypes getType(size_t obstacle) const;
+
+			/**
+			 * @brief Reserves memory for a number of obstacles.
+			 *
+			 * Reserves every array for a number of obstacles.
+			 *
+			 * @param count The number of obstacles.
+			 */
+			void reserve(size_t count);
+
+			/**
+			 * @brief Gets the number of obstacles.
+			 *
+			 * Gets the number of obstacles in the system.
+			 *
+			 * @returns The number of obstacles.
+			 */
+			size_t size() const;
+
+			/**
+			 * @brief Sorts the obstacles.
+			 *
+			 * Sorts the obstacles by their position along Z.
+			 */
+			void sort();
+
+		private:
+
+			std::vector<float> positions;				/// Position along Z of every obstacle, in order.
+			std::vector<unsigned char> types;			/// Type of every obstacle.
+			std::vector<glm::vec3> bounds_min;			/// Minimum corner of the world bounds of every obstacle.
+			std::vector<glm::vec3> bounds_max;			/// Maximum corner of the world bounds of every obstacle.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_OBSTACLESYSTEM_H_
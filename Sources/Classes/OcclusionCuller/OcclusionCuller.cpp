@@ -0,0 +1,734 @@
+/**
+ * @file OcclusionCuller.cpp
+ * @brief OcclusionCuller class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "OcclusionCuller.h"
+
+#include <math.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define ALADDIN_3D_OCCLUSION_SSE
+#include <xmmintrin.h>
+#endif
+
+#include "glm/glm.hpp"
+
+#include "Classes/BatchMaths/BatchMaths.h"
+#include "Classes/Object/Object.h"
+#include "Classes/ThreadPool/ThreadPool.h"
+#include "Structs/BoundingBox/BoundingBox.h"
+
+namespace aladdin_3d {
+
+	const int OcclusionCuller::width;
+	const int OcclusionCuller::height;
+	const int OcclusionCuller::tile_size;
+	const size_t OcclusionCuller::max_occluders;
+	const int OcclusionCuller::occluder_resolution;
+	const char OcclusionCuller::visible;
+	const char OcclusionCuller::occluded;
+	const char OcclusionCuller::outside;
+
+	/// Corners of every face of a box, counter-clockwise when seen from outside.
+	static const int box_faces[6][4] = {
+		{0, 4, 6, 2},	// -x
+		{5, 1, 3, 7},	// +x
+		{0, 1, 5, 4},	// -y
+		{6, 7, 3, 2},	// +y
+		{0, 2, 3, 1},	// -z
+		{4, 5, 7, 6}	// +z
+	};
+
+	/// Number of candidates tested by every job.
+	static const size_t candidates_per_job = 64;
+
+	/**
+	 * @brief Gets the index of a pixel in the tiled depth buffer.
+	 *
+	 * Gets the index of a pixel in the tiled depth buffer, where the pixels of every
+	 * tile are stored together row by row.
+	 *
+	 * @param x The column of the pixel.
+	 * @param y The row of the pixel.
+	 *
+	 * @returns The index of the pixel.
+	 */
+	static inline int pixelIndex(int x, int y) {
+
+		const int tiles_x = OcclusionCuller::width / OcclusionCuller::tile_size;
+		const int tile_pixels = OcclusionCuller::tile_size * OcclusionCuller::tile_size;
+
+		int tile = (y / OcclusionCuller::tile_size) * tiles_x + x / OcclusionCuller::tile_size;
+
+		return tile * tile_pixels + (y % OcclusionCuller::tile_size) * OcclusionCuller::tile_size + x % OcclusionCuller::tile_size;
+
+	}
+
+	/**
+	 * @brief Takes a clip space point to the depth buffer.
+	 *
+	 * Divides by w and maps the point to pixel coordinates and a depth in [0, 1].
+	 *
+	 * @param point The point in clip space.
+	 *
+	 * @returns The point in screen coordinates.
+	 */
+	static inline glm::vec3 toScreen(const glm::vec4 &point) {
+
+		glm::vec3 ndc = glm::vec3(point) / point.w;
+
+		return glm::vec3((ndc.x * 0.5f + 0.5f) * OcclusionCuller::width,
+			(ndc.y * 0.5f + 0.5f) * OcclusionCuller::height, ndc.z * 0.5f + 0.5f);
+
+	}
+
+	size_t OcclusionCuller::addCandidate(const BoundingBox &box) {
+
+		this->candidates.push_back(box);
+		this->states.push_back(visible);
+
+		return this->candidates.size() - 1;
+
+	}
+
+	void OcclusionCuller::addOccluder(const BoundingBox &box) {
+
+		this->occluders.push_back(box);
+
+	}
+
+	void OcclusionCuller::addTriangles(const glm::vec4 corners[8]) {
+
+		for (int face = 0; face < 6; face++) {
+
+			// Clip the face against the near plane (z >= -w), which can add one corner.
+			glm::vec4 polygon[5];
+			int count = 0;
+
+			for (int i = 0; i < 4; i++) {
+
+				const glm::vec4 &current = corners[box_faces[face][i]];
+				const glm::vec4 &next = corners[box_faces[face][(i + 1) % 4]];
+				float current_distance = current.z + current.w;
+				float next_distance = next.z + next.w;
+
+				if (current_distance >= 0.0f)
+					polygon[count++] = current;
+
+				if ((current_distance >= 0.0f) != (next_distance >= 0.0f))
+					polygon[count++] = current + (next - current) * (current_distance / (current_distance - next_distance));
+
+			}
+
+			if (count < 3)
+				continue;
+
+			// Project the polygon.
+			glm::vec3 screen[5];
+			for (int i = 0; i < count; i++)
+				screen[i] = toScreen(polygon[i]);
+
+			// Only keep the faces that look at the camera.
+			glm::vec3 edge_1 = screen[1] - screen[0];
+			glm::vec3 edge_2 = screen[2] - screen[0];
+
+			if (edge_1.x * edge_2.y - edge_1.y * edge_2.x <= 0.0f)
+				continue;
+
+			// Split it in a triangle fan.
+			for (int i = 1; i + 1 < count; i++) {
+
+				this->triangles.push_back(screen[0]);
+				this->triangles.push_back(screen[i]);
+				this->triangles.push_back(screen[i + 1]);
+
+			}
+
+		}
+
+	}
+
+	void OcclusionCuller::cull(const glm::mat4 &view_projection, ThreadPool &pool) {
+
+		this->view_projection = view_projection;
+		BatchMaths::getFrustumPlanes(view_projection, this->planes);
+
+		// Clear the depth buffer.
+		this->depth.assign(width * height, 1.0f);
+		this->tile_depth.assign((width / tile_size) * (height / tile_size), 1.0f);
+
+		// Get the triangles of the biggest occluders. Room for the worst case is reserved
+		// once, every face of every occluder clipped into a pentagon, so culling never allocates.
+		this->triangles.reserve(max_occluders * 6 * 3 * 3);
+		this->ranking.reserve(this->occluders.size());
+		this->triangles.clear();
+		this->selectOccluders();
+
+		// Rasterize every row of tiles in parallel, they do not share any pixel.
+		pool.run(height / tile_size, [this](size_t row) { this->rasterize((int)row); });
+
+		// Test the candidates in parallel.
+		size_t jobs = (this->candidates.size() + candidates_per_job - 1) / candidates_per_job;
+
+		pool.run(jobs, [this](size_t job) {
+
+			size_t first = job * candidates_per_job;
+			size_t last = std::min(this->candidates.size(), (job + 1) * candidates_per_job);
+
+			// Drop the boxes outside the frustum in batches, and test only the rest one by one.
+			BatchMaths::cullBoxes(this->planes, &this->candidates[first], &this->states[first], last - first);
+
+			for (size_t i = first; i < last; i++)
+				this->states[i] = this->states[i] ? this->test(this->candidates[i]) : outside;
+
+		});
+
+		// Count the results.
+		this->occluded_count = std::count(this->states.begin(), this->states.end(), occluded);
+		this->outside_count = std::count(this->states.begin(), this->states.end(), outside);
+
+	}
+
+	bool OcclusionCuller::fitOccluder(Object &object, BoundingBox *box) {
+
+		const int n = occluder_resolution;
+
+		// Flat objects cannot hide anything.
+		BoundingBox bounds = object.getBoundingBox();
+		glm::vec3 size = bounds.max - bounds.min;
+
+		if (size.x <= 0.0f || size.y <= 0.0f || size.z <= 0.0f)
+			return false;
+
+		// Get all the triangles of the object.
+		std::vector<glm::vec3> triangles;
+		const std::vector<Geometry> &geometries = object.getGeometries();
+
+		for (size_t i = 0; i < geometries.size(); i++) {
+
+			const std::vector<Vertex> &vertices = geometries[i].getVertices();
+			const std::vector<GLuint> &indices = geometries[i].getIndices();
+
+			for (size_t j = 0; j < indices.size(); j++)
+				triangles.push_back(vertices[indices[j]].position);
+
+		}
+
+		// Nothing to voxelize if the mesh was released from the CPU.
+		if (triangles.empty())
+			return false;
+
+		// Keep the voxels that are inside according to rays along x and along z.
+		std::vector<char> solid(n * n * n, 1);
+		voxelize(triangles, bounds, 0, solid);
+		voxelize(triangles, bounds, 2, solid);
+
+		// Prefix sums to check if a block of voxels is solid in constant time.
+		const int m = n + 1;
+		std::vector<int> sums(m * m * m, 0);
+
+		for (int z = 1; z <= n; z++) {
+
+			for (int y = 1; y <= n; y++) {
+
+				for (int x = 1; x <= n; x++) {
+
+					sums[(z * m + y) * m + x] = solid[((z - 1) * n + y - 1) * n + x - 1]
+						+ sums[((z - 1) * m + y) * m + x] + sums[(z * m + y - 1) * m + x] + sums[(z * m + y) * m + x - 1]
+						- sums[((z - 1) * m + y - 1) * m + x] - sums[((z - 1) * m + y) * m + x - 1] - sums[(z * m + y - 1) * m + x - 1]
+						+ sums[((z - 1) * m + y - 1) * m + x - 1];
+
+				}
+
+			}
+
+		}
+
+		auto isSolid = [&](const int low[3], const int high[3]) {
+
+			int x0 = low[0], y0 = low[1], z0 = low[2];
+			int x1 = high[0] + 1, y1 = high[1] + 1, z1 = high[2] + 1;
+
+			int count = sums[(z1 * m + y1) * m + x1] - sums[(z0 * m + y1) * m + x1] - sums[(z1 * m + y0) * m + x1]
+				- sums[(z1 * m + y1) * m + x0] + sums[(z0 * m + y0) * m + x1] + sums[(z0 * m + y1) * m + x0]
+				+ sums[(z1 * m + y0) * m + x0] - sums[(z0 * m + y0) * m + x0];
+
+			return count == (x1 - x0) * (y1 - y0) * (z1 - z0);
+
+		};
+
+		// Grow a box from several seeds, one face at a time, and keep the biggest.
+		int best_low[3] = {0, 0, 0};
+		int best_high[3] = {-1, -1, -1};
+		int best_volume = 0;
+
+		for (int z = 0; z < n; z += 2) {
+
+			for (int y = 0; y < n; y += 2) {
+
+				for (int x = 0; x < n; x += 2) {
+
+					if (!solid[(z * n + y) * n + x])
+						continue;
+
+					int low[3] = {x, y, z};
+					int high[3] = {x, y, z};
+					bool grown = true;
+
+					while (grown) {
+
+						grown = false;
+
+						for (int face = 0; face < 6; face++) {
+
+							int axis = face / 2;
+							int new_low[3] = {low[0], low[1], low[2]};
+							int new_high[3] = {high[0], high[1], high[2]};
+
+							if (face % 2 == 0)
+								new_low[axis]--;
+							else
+								new_high[axis]++;
+
+							if (new_low[axis] < 0 || new_high[axis] >= n || !isSolid(new_low, new_high))
+								continue;
+
+							low[axis] = new_low[axis];
+							high[axis] = new_high[axis];
+							grown = true;
+
+						}
+
+					}
+
+					int volume = (high[0] - low[0] + 1) * (high[1] - low[1] + 1) * (high[2] - low[2] + 1);
+
+					if (volume > best_volume) {
+
+						best_volume = volume;
+						std::copy(low, low + 3, best_low);
+						std::copy(high, high + 3, best_high);
+
+					}
+
+				}
+
+			}
+
+		}
+
+		// Go from the centres of the outer voxels, which are known to be inside.
+		glm::vec3 cell = (bounds.max - bounds.min) / (float)n;
+		box->min = bounds.min + (glm::vec3(best_low[0], best_low[1], best_low[2]) + 0.5f) * cell;
+		box->max = bounds.min + (glm::vec3(best_high[0], best_high[1], best_high[2]) + 0.5f) * cell;
+
+		return best_high[0] > best_low[0] && best_high[1] > best_low[1] && best_high[2] > best_low[2];
+
+	}
+
+	size_t OcclusionCuller::getOccludedCount() {
+
+		return this->occluded_count;
+
+	}
+
+	size_t OcclusionCuller::getOutsideCount() {
+
+		return this->outside_count;
+
+	}
+
+	size_t OcclusionCuller::getVisibleCount() {
+
+		return this->candidates.size() - this->occluded_count - this->outside_count;
+
+	}
+
+	bool OcclusionCuller::isVisible(size_t candidate) {
+
+		return this->states[candidate] == visible;
+
+	}
+
+	void OcclusionCuller::rasterize(int row) {
+
+		const int first_y = row * tile_size;
+		const int last_y = first_y + tile_size - 1;
+
+		for (size_t i = 0; i < this->triangles.size(); i += 3) {
+
+			const glm::vec3 &a = this->triangles[i];
+			const glm::vec3 &b = this->triangles[i + 1];
+			const glm::vec3 &c = this->triangles[i + 2];
+
+			// Get the pixels covered by the triangle in this row.
+			int min_x = std::max(0, (int)floorf(std::min(a.x, std::min(b.x, c.x))));
+			int max_x = std::min(width - 1, (int)ceilf(std::max(a.x, std::max(b.x, c.x))));
+			int min_y = std::max(first_y, (int)floorf(std::min(a.y, std::min(b.y, c.y))));
+			int max_y = std::min(last_y, (int)ceilf(std::max(a.y, std::max(b.y, c.y))));
+
+			if (min_x > max_x || min_y > max_y)
+				continue;
+
+			// Edge functions as E(x, y) = A * x + B * y + C, positive inside the triangle.
+			float edge_a[3] = {a.y - b.y, b.y - c.y, c.y - a.y};
+			float edge_b[3] = {b.x - a.x, c.x - b.x, a.x - c.x};
+			float edge_c[3] = {
+				-(edge_a[0] * a.x + edge_b[0] * a.y),
+				-(edge_a[1] * b.x + edge_b[1] * b.y),
+				-(edge_a[2] * c.x + edge_b[2] * c.y)
+			};
+
+			// Depth plane as z(x, y) = A * x + B * y + C.
+			float area = edge_b[0] * (c.y - a.y) + edge_a[0] * (c.x - a.x);
+			float depth_a = ((b.z - a.z) * (c.y - a.y) - (c.z - a.z) * (b.y - a.y)) / area;
+			float depth_b = ((c.z - a.z) * (b.x - a.x) - (b.z - a.z) * (c.x - a.x)) / area;
+			float depth_c = a.z - depth_a * a.x - depth_b * a.y;
+
+			// Work in groups of four pixels, which never cross a tile.
+			min_x &= ~3;
+
+			for (int y = min_y; y <= max_y; y++) {
+
+				float pixel_y = y + 0.5f;
+
+#ifdef ALADDIN_3D_OCCLUSION_SSE
+
+				__m128 offsets = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+				__m128 zero = _mm_setzero_ps();
+
+				for (int x = min_x; x <= max_x; x += 4) {
+
+					__m128 pixel_x = _mm_add_ps(_mm_set1_ps((float)x), offsets);
+
+					// Evaluate the three edges for the four pixels.
+					__m128 inside = _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(edge_a[0]), pixel_x),
+						_mm_set1_ps(edge_b[0] * pixel_y + edge_c[0])), zero);
+					inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(edge_a[1]), pixel_x),
+						_mm_set1_ps(edge_b[1] * pixel_y + edge_c[1])), zero));
+					inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(edge_a[2]), pixel_x),
+						_mm_set1_ps(edge_b[2] * pixel_y + edge_c[2])), zero));
+
+					if (_mm_movemask_ps(inside) == 0)
+						continue;
+
+					// Keep the nearest depth of the covered pixels.
+					__m128 pixel_z = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(depth_a), pixel_x), _mm_set1_ps(depth_b * pixel_y + depth_c));
+					float *target = &this->depth[pixelIndex(x, y)];
+					__m128 current = _mm_loadu_ps(target);
+					__m128 nearest = _mm_min_ps(current, pixel_z);
+
+					_mm_storeu_ps(target, _mm_or_ps(_mm_and_ps(inside, nearest), _mm_andnot_ps(inside, current)));
+
+				}
+
+#else
+
+				for (int x = min_x; x <= max_x; x++) {
+
+					float pixel_x = x + 0.5f;
+
+					if (edge_a[0] * pixel_x + edge_b[0] * pixel_y + edge_c[0] < 0.0f ||
+						edge_a[1] * pixel_x + edge_b[1] * pixel_y + edge_c[1] < 0.0f ||
+						edge_a[2] * pixel_x + edge_b[2] * pixel_y + edge_c[2] < 0.0f)
+						continue;
+
+					float &target = this->depth[pixelIndex(x, y)];
+					target = std::min(target, depth_a * pixel_x + depth_b * pixel_y + depth_c);
+
+				}
+
+#endif
+
+			}
+
+		}
+
+		// Store the farthest depth of every tile in the row.
+		const int tiles_x = width / tile_size;
+		const int tile_pixels = tile_size * tile_size;
+
+		for (int tile = row * tiles_x; tile < (row + 1) * tiles_x; tile++) {
+
+			const float *pixels = &this->depth[tile * tile_pixels];
+			this->tile_depth[tile] = *std::max_element(pixels, pixels + tile_pixels);
+
+		}
+
+	}
+
+	void OcclusionCuller::selectOccluders() {
+
+		this->ranking.clear();
+
+		for (size_t i = 0; i < this->occluders.size(); i++) {
+
+			glm::vec4 corners[8];
+			this->transformCorners(this->occluders[i], corners);
+
+			// Skip the occluders outside the view.
+			bool out[5] = {true, true, true, true, true};
+			bool crosses_near = false;
+			glm::vec2 min_screen(1e30f);
+			glm::vec2 max_screen(-1e30f);
+
+			for (int j = 0; j < 8; j++) {
+
+				out[0] = out[0] && corners[j].x < -corners[j].w;
+				out[1] = out[1] && corners[j].x > corners[j].w;
+				out[2] = out[2] && corners[j].y < -corners[j].w;
+				out[3] = out[3] && corners[j].y > corners[j].w;
+				out[4] = out[4] && corners[j].z < -corners[j].w;
+
+				if (corners[j].z < -corners[j].w) {
+
+					crosses_near = true;
+
+				} else {
+
+					glm::vec3 screen = toScreen(corners[j]);
+					min_screen = glm::min(min_screen, glm::vec2(screen));
+					max_screen = glm::max(max_screen, glm::vec2(screen));
+
+				}
+
+			}
+
+			if (out[0] || out[1] || out[2] || out[3] || out[4])
+				continue;
+
+			// Rank them by the area they cover, the ones around the camera first.
+			min_screen = glm::clamp(min_screen, glm::vec2(0.0f), glm::vec2(width, height));
+			max_screen = glm::clamp(max_screen, glm::vec2(0.0f), glm::vec2(width, height));
+			glm::vec2 size = glm::max(max_screen - min_screen, glm::vec2(0.0f));
+
+			float score = crosses_near ? (float)(width * height) : size.x * size.y;
+			this->ranking.push_back(std::make_pair(score, i));
+
+		}
+
+		// Keep the biggest ones.
+		size_t count = std::min(this->ranking.size(), max_occluders);
+		std::partial_sort(this->ranking.begin(), this->ranking.begin() + count, this->ranking.end(),
+			[](const std::pair<float, size_t> &a, const std::pair<float, size_t> &b) { return a.first > b.first; });
+
+		for (size_t i = 0; i < count; i++) {
+
+			glm::vec4 corners[8];
+			this->transformCorners(this->occluders[this->ranking[i].second], corners);
+			this->addTriangles(corners);
+
+		}
+
+	}
+
+	char OcclusionCuller::test(const BoundingBox &box) {
+
+		glm::vec4 corners[8];
+		this->transformCorners(box, corners);
+
+		// Check the view frustum and whether the box crosses the near plane.
+		bool out[6] = {true, true, true, true, true, true};
+		bool crosses_near = false;
+
+		for (int i = 0; i < 8; i++) {
+
+			out[0] = out[0] && corners[i].x < -corners[i].w;
+			out[1] = out[1] && corners[i].x > corners[i].w;
+			out[2] = out[2] && corners[i].y < -corners[i].w;
+			out[3] = out[3] && corners[i].y > corners[i].w;
+			out[4] = out[4] && corners[i].z < -corners[i].w;
+			out[5] = out[5] && corners[i].z > corners[i].w;
+			crosses_near = crosses_near || corners[i].z < -corners[i].w;
+
+		}
+
+		if (out[0] || out[1] || out[2] || out[3] || out[4] || out[5])
+			return outside;
+
+		// Boxes around the camera cannot be projected safely, so draw them.
+		if (crosses_near)
+			return visible;
+
+		// Get the rectangle and the nearest depth of the box on screen.
+		glm::vec3 min_screen(1e30f);
+		glm::vec3 max_screen(-1e30f);
+
+		for (int i = 0; i < 8; i++) {
+
+			glm::vec3 screen = toScreen(corners[i]);
+			min_screen = glm::min(min_screen, screen);
+			max_screen = glm::max(max_screen, screen);
+
+		}
+
+		int min_x = std::max(0, (int)floorf(min_screen.x));
+		int max_x = std::min(width - 1, (int)floorf(max_screen.x));
+		int min_y = std::max(0, (int)floorf(min_screen.y));
+		int max_y = std::min(height - 1, (int)floorf(max_screen.y));
+
+		if (min_x > max_x || min_y > max_y)
+			return outside;
+
+		float nearest = min_screen.z;
+
+		// Check every tile under the rectangle, going down to the pixels only when needed.
+		const int tiles_x = width / tile_size;
+
+		for (int tile_y = min_y / tile_size; tile_y <= max_y / tile_size; tile_y++) {
+
+			for (int tile_x = min_x / tile_size; tile_x <= max_x / tile_size; tile_x++) {
+
+				if (nearest > this->tile_depth[tile_y * tiles_x + tile_x])
+					continue;
+
+				int first_x = std::max(min_x, tile_x * tile_size);
+				int last_x = std::min(max_x, tile_x * tile_size + tile_size - 1);
+				int first_y = std::max(min_y, tile_y * tile_size);
+				int last_y = std::min(max_y, tile_y * tile_size + tile_size - 1);
+
+				for (int y = first_y; y <= last_y; y++) {
+
+					for (int x = first_x; x <= last_x; x++) {
+
+						if (nearest <= this->depth[pixelIndex(x, y)])
+							return visible;
+
+					}
+
+				}
+
+			}
+
+		}
+
+		return occluded;
+
+	}
+
+	void OcclusionCuller::transformCorners(const BoundingBox &box, glm::vec4 corners[8]) {
+
+		for (int i = 0; i < 8; i++) {
+
+			glm::vec4 corner((i & 1) ? box.max.x : box.min.x, (i & 2) ? box.max.y : box.min.y, (i & 4) ? box.max.z : box.min.z, 1.0f);
+			corners[i] = this->view_projection * corner;
+
+		}
+
+	}
+
+	void OcclusionCuller::voxelize(const std::vector<glm::vec3> &triangles, const BoundingBox &bounds, int axis, std::vector<char> &solid) {
+
+		const int n = occluder_resolution;
+		const int u = (axis + 1) % 3;
+		const int v = (axis + 2) % 3;
+
+		// Move the rays slightly off the centres so they do not go through the vertices of the grid.
+		const float row_offset = 0.5f + 0.0137f;
+
+		glm::vec3 cell = (bounds.max - bounds.min) / (float)n;
+		std::vector<std::vector<float>> crossings(n * n);
+
+		for (size_t i = 0; i < triangles.size(); i += 3) {
+
+			const glm::vec3 &a = triangles[i];
+			const glm::vec3 &b = triangles[i + 1];
+			const glm::vec3 &c = triangles[i + 2];
+
+			float area = (b[u] - a[u]) * (c[v] - a[v]) - (c[u] - a[u]) * (b[v] - a[v]);
+
+			if (area == 0.0f)
+				continue;
+
+			// Only check the rows that can go through the triangle.
+			int first_u = std::max(0, (int)ceilf((std::min(a[u], std::min(b[u], c[u])) - bounds.min[u]) / cell[u] - row_offset));
+			int last_u = std::min(n - 1, (int)floorf((std::max(a[u], std::max(b[u], c[u])) - bounds.min[u]) / cell[u] - row_offset));
+			int first_v = std::max(0, (int)ceilf((std::min(a[v], std::min(b[v], c[v])) - bounds.min[v]) / cell[v] - row_offset));
+			int last_v = std::min(n - 1, (int)floorf((std::max(a[v], std::max(b[v], c[v])) - bounds.min[v]) / cell[v] - row_offset));
+
+			for (int row_v = first_v; row_v <= last_v; row_v++) {
+
+				for (int row_u = first_u; row_u <= last_u; row_u++) {
+
+					float point_u = bounds.min[u] + (row_u + row_offset) * cell[u];
+					float point_v = bounds.min[v] + (row_v + row_offset) * cell[v];
+
+					// Barycentric coordinates of the ray in the triangle.
+					float weight_b = ((point_u - a[u]) * (c[v] - a[v]) - (c[u] - a[u]) * (point_v - a[v])) / area;
+					float weight_c = ((b[u] - a[u]) * (point_v - a[v]) - (point_u - a[u]) * (b[v] - a[v])) / area;
+
+					if (weight_b < 0.0f || weight_c < 0.0f || weight_b + weight_c > 1.0f)
+						continue;
+
+					crossings[row_v * n + row_u].push_back(a[axis] + weight_b * (b[axis] - a[axis]) + weight_c * (c[axis] - a[axis]));
+
+				}
+
+			}
+
+		}
+
+		for (int row_v = 0; row_v < n; row_v++) {
+
+			for (int row_u = 0; row_u < n; row_u++) {
+
+				std::vector<float> &row = crossings[row_v * n + row_u];
+				std::sort(row.begin(), row.end());
+
+				// Drop repeated crossings, such as double sided faces, which would break the parity.
+				std::vector<float> surfaces;
+				float epsilon = cell[axis] * 1e-3f;
+
+				for (size_t i = 0; i < row.size(); i++) {
+
+					if (i + 1 < row.size() && row[i + 1] - row[i] < epsilon)
+						i++;
+					else
+						surfaces.push_back(row[i]);
+
+				}
+
+				// A voxel is inside if an odd number of surfaces is before its centre.
+				size_t before = 0;
+
+				for (int k = 0; k < n; k++) {
+
+					float centre = bounds.min[axis] + (k + 0.5f) * cell[axis];
+
+					while (before < surfaces.size() && surfaces[before] < centre)
+						before++;
+
+					if (before % 2 == 1)
+						continue;
+
+					int voxel[3];
+					voxel[axis] = k;
+					voxel[u] = row_u;
+					voxel[v] = row_v;
+
+					solid[(voxel[2] * n + voxel[1]) * n + voxel[0]] = 0;
+
+				}
+
+			}
+
+		}
+
+	}
+
+}  // namespace aladdin_3d
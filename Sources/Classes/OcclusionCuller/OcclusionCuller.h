@@ -0,0 +1,217 @@
+/**
+ * @file OcclusionCuller.h
+ * @brief OcclusionCuller class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_OCCLUSIONCULLER_H_
+#define ALADDIN_3D_CLASSES_OCCLUSIONCULLER_H_
+
+#include <utility>
+#include <vector>
+
+#include "glm/glm.hpp"
+
+#include "Classes/Object/Object.h"
+#include "Classes/ThreadPool/ThreadPool.h"
+#include "Structs/BoundingBox/BoundingBox.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of an OcclusionCuller class.
+	 *
+	 * Implementation of a software occlusion culler. Every frame, the largest occluder
+	 * boxes on screen are rasterized into a small tiled depth buffer, and the bounding
+	 * boxes of the candidates are tested against the farthest depth of every tile first
+	 * and against the pixels of the tiles that could not reject them after. Both the
+	 * rasterization and the tests are split across the thread pool.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class OcclusionCuller {
+
+		public:
+
+			/**
+			 * @brief Adds a candidate.
+			 *
+			 * Adds an object that can be culled.
+			 *
+			 * @param box The bounding box of the object in world coordinates.
+			 *
+			 * @returns The index of the candidate.
+			 */
+			size_t addCandidate(const BoundingBox &box);
+
+			/**
+			 * @brief Adds an occluder.
+			 *
+			 * Adds a box that hides whatever is behind it. The box must be fully inside
+			 * the geometry it stands for, otherwise visible objects could be culled.
+			 *
+			 * @param box The occluder box in world coordinates.
+			 */
+			void addOccluder(const BoundingBox &box);
+
+			/**
+			 * @brief Culls the candidates.
+			 *
+			 * Rasterizes the occluders and tests all the candidates for the current frame.
+			 *
+			 * @param view_projection The matrix that takes world coordinates to clip space.
+			 * @param pool The thread pool to run the work on.
+			 */
+			void cull(const glm::mat4 &view_projection, ThreadPool &pool);
+
+			/**
+			 * @brief Fits an occluder inside an object.
+			 *
+			 * Voxelizes the object in its local coordinates and finds a large box of solid
+			 * voxels, so that holes such as doors and arches never hide anything. The mesh
+			 * is expected to be closed, and still have its CPU data.
+			 *
+			 * @param object The object.
+			 * @param box Outputs the occluder box in the local coordinates of the object.
+			 *
+			 * @returns True if a box was found.
+			 */
+			static bool fitOccluder(Object &object, BoundingBox *box);
+
+			/**
+			 * @brief Get the number of occluded candidates.
+			 *
+			 * Get the number of candidates hidden by the occluders in the last frame.
+			 *
+			 * @returns The number of occluded candidates.
+			 */
+			size_t getOccludedCount();
+
+			/**
+			 * @brief Get the number of candidates outside the view.
+			 *
+			 * Get the number of candidates outside the view frustum in the last frame.
+			 *
+			 * @returns The number of candidates outside the view.
+			 */
+			size_t getOutsideCount();
+
+			/**
+			 * @brief Get the number of visible candidates.
+			 *
+			 * Get the number of candidates that passed the tests in the last frame.
+			 *
+			 * @returns The number of visible candidates.
+			 */
+			size_t getVisibleCount();
+
+			/**
+			 * @brief Checks if a candidate is visible.
+			 *
+			 * Checks if a candidate passed the tests in the last frame.
+			 *
+			 * @param candidate The index of the candidate.
+			 *
+			 * @returns True if the candidate has to be drawn.
+			 */
+			bool isVisible(size_t candidate);
+
+			static const int width = 256;			/// Width of the depth buffer.
+			static const int height = 128;			/// Height of the depth buffer.
+			static const int tile_size = 8;			/// Width and height of a tile.
+			static const size_t max_occluders = 32;	/// Maximum number of occluders rasterized per frame.
+			static const int occluder_resolution = 32;	/// Voxels per axis used to fit the occluders.
+
+		private:
+
+			/**
+			 * @brief Adds the triangles of an occluder.
+			 *
+			 * Clips the front faces of an occluder against the near plane and adds them to
+			 * the triangles of the frame in screen coordinates.
+			 *
+			 * @param corners The corners of the occluder in clip space.
+			 */
+			void addTriangles(const glm::vec4 corners[8]);
+
+			/**
+			 * @brief Rasterizes a row of tiles.
+			 *
+			 * Rasterizes all the triangles of the frame into a row of tiles and updates
+			 * the farthest depth of those tiles.
+			 *
+			 * @param row The index of the row of tiles.
+			 */
+			void rasterize(int row);
+
+			/**
+			 * @brief Selects the occluders of the frame.
+			 *
+			 * Picks the occluders that cover the largest part of the screen.
+			 */
+			void selectOccluders();
+
+			/**
+			 * @brief Tests a candidate.
+			 *
+			 * Tests a candidate against the view frustum and the depth buffer.
+			 *
+			 * @param box The bounding box of the candidate.
+			 *
+			 * @returns One of the visibility states.
+			 */
+			char test(const BoundingBox &box);
+
+			/**
+			 * @brief Transforms the corners of a box.
+			 *
+			 * Transforms the corners of a box to clip space.
+			 *
+			 * @param box The box.
+			 * @param corners Outputs the corners in clip space.
+			 */
+			void transformCorners(const BoundingBox &box, glm::vec4 corners[8]);
+
+			/**
+			 * @brief Removes the voxels outside a mesh.
+			 *
+			 * Casts a ray along an axis through every row of voxels and clears the voxels
+			 * whose centre is outside the mesh, according to the parity of the crossings.
+			 *
+			 * @param triangles The triangles of the mesh, three points each.
+			 * @param bounds The bounding box of the mesh.
+			 * @param axis The axis of the rays.
+			 * @param solid The voxels, set to 1 where they are inside.
+			 */
+			static void voxelize(const std::vector<glm::vec3> &triangles, const BoundingBox &bounds, int axis, std::vector<char> &solid);
+
+			static const char visible = 0;		/// The candidate has to be drawn.
+			static const char occluded = 1;		/// The candidate is behind the occluders.
+			static const char outside = 2;		/// The candidate is outside the view.
+
+			std::vector<BoundingBox> candidates;			/// Bounding boxes of the candidates.
+			std::vector<BoundingBox> occluders;				/// Boxes of the occluders.
+			std::vector<char> states;						/// Visibility state of every candidate.
+			std::vector<std::pair<float, size_t>> ranking;	/// Occluders sorted by their size on screen.
+			std::vector<glm::vec3> triangles;				/// Occluder triangles of the frame in screen coordinates.
+			std::vector<float> depth;						/// Tiled depth buffer.
+			std::vector<float> tile_depth;					/// Farthest depth of every tile.
+			glm::mat4 view_projection = glm::mat4(1.0f);	/// Matrix of the frame being culled.
+			glm::vec4 planes[6];							/// Planes of the frustum of the frame.
+			size_t occluded_count = 0;						/// Occluded candidates in the last frame.
+			size_t outside_count = 0;						/// Candidates outside the view in the last frame.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_OCCLUSIONCULLER_H_
@@ -0,0 +1,345 @@
+/**
+ * @file Profiler.cpp
+ * @brief Profiler class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "Profiler.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <vector>
+
+#include "glew/glew.h"
+#include "freeglut/freeglut.h"
+#include "json/json.h"
+
+#include "Structs/ProfileSection/ProfileSection.h"
+
+namespace aladdin_3d {
+
+	const GLuint Profiler::regions;
+	const size_t Profiler::window;
+	const unsigned long Profiler::refresh;
+
+	void Profiler::addSample(ProfileSection &section, float sample) {
+
+		section.samples[section.next] = sample;
+		section.next = (section.next + 1) % window;
+
+		if (section.count < window)
+			section.count++;
+
+	}
+
+	void Profiler::beginCPU(const char *name) {
+
+		ProfileSection &section = this->getSection(name, false);
+
+		section.started = true;
+		section.start = std::chrono::steady_clock::now();
+
+	}
+
+	void Profiler::beginFrame() {
+
+		this->frames++;
+
+		// Move to the next region and collect what it measured last time.
+		this->region = (this->region + 1) % regions;
+		this->collect(this->region);
+
+		// The whole frame is a section of its own on both sides.
+		this->beginCPU("Frame");
+		this->beginGPU("Frame");
+
+	}
+
+	void Profiler::beginGPU(const char *name) {
+
+		ProfileSection &section = this->getSection(name, true);
+
+		glQueryCounter(section.queries[this->region * 2], GL_TIMESTAMP);
+		section.started = true;
+
+	}
+
+	void Profiler::collect(GLuint region) {
+
+		for (size_t i = 0; i < this->sections.size(); i++) {
+
+			ProfileSection &section = this->sections[i];
+
+			if (!section.gpu || section.query_frames[region] == 0)
+				continue;
+
+			section.query_frames[region] = 0;
+
+			// The end timestamp comes last, so the begin one is there if the end one is.
+			GLint available = 0;
+			glGetQueryObjectiv(section.queries[region * 2 + 1], GL_QUERY_RESULT_AVAILABLE, &available);
+
+			if (!available)
+				continue;
+
+			GLuint64 begin = 0;
+			GLuint64 end = 0;
+			glGetQueryObjectui64v(section.queries[region * 2], GL_QUERY_RESULT, &begin);
+			glGetQueryObjectui64v(section.queries[region * 2 + 1], GL_QUERY_RESULT, &end);
+
+			this->addSample(section, (float)((end - begin) / 1000000.0));
+
+		}
+
+	}
+
+	void Profiler::drawOverlay(int height) {
+
+		// Refresh the statistics the first time they are shown.
+		if (this->frames < refresh)
+			this->updateStatistics();
+
+		// Draw the text with the fixed pipeline, on top of everything.
+		glUseProgram(0);
+		glBindVertexArray(0);
+		glDisable(GL_DEPTH_TEST);
+		glColor3f(0.0f, 0.0f, 0.0f);
+
+		char line[128];
+		int y = height - 20;
+
+		snprintf(line, sizeof(line), "%-3s %-16s %8s %8s %8s", "", "Section (ms)", "min", "avg", "p99");
+		glWindowPos2i(10, y);
+		glutBitmapString(GLUT_BITMAP_9_BY_15, (const unsigned char*)line);
+
+		for (size_t i = 0; i < this->sections.size(); i++) {
+
+			ProfileSection &section = this->sections[i];
+
+			y -= 15;
+			snprintf(line, sizeof(line), "%-3s %-16s %8.3f %8.3f %8.3f", section.gpu ? "GPU" : "CPU",
+				section.name.c_str(), section.min, section.average, section.p99);
+			glWindowPos2i(10, y);
+			glutBitmapString(GLUT_BITMAP_9_BY_15, (const unsigned char*)line);
+
+		}
+
+		glEnable(GL_DEPTH_TEST);
+
+	}
+
+	void Profiler::endCPU(const char *name) {
+
+		ProfileSection &section = this->getSection(name, false);
+
+		if (!section.started)
+			return;
+
+		// Add this run to the time of the frame.
+		auto now = std::chrono::steady_clock::now();
+		section.frame_time += std::chrono::duration<double, std::milli>(now - section.start).count();
+		section.measured = true;
+		section.started = false;
+
+	}
+
+	void Profiler::endFrame() {
+
+		this->endGPU("Frame");
+		this->endCPU("Frame");
+
+		// Store the CPU sections that ran this frame.
+		for (size_t i = 0; i < this->sections.size(); i++) {
+
+			ProfileSection &section = this->sections[i];
+
+			if (section.gpu || !section.measured)
+				continue;
+
+			this->addSample(section, (float)section.frame_time);
+			section.frame_time = 0.0;
+			section.measured = false;
+
+		}
+
+		if (this->frames % refresh == 0)
+			this->updateStatistics();
+
+	}
+
+	void Profiler::endGPU(const char *name) {
+
+		ProfileSection &section = this->getSection(name, true);
+
+		if (!section.started)
+			return;
+
+		glQueryCounter(section.queries[this->region * 2 + 1], GL_TIMESTAMP);
+		section.query_frames[this->region] = this->frames;
+		section.started = false;
+
+	}
+
+	unsigned long Profiler::getFrames() {
+
+		return this->frames;
+
+	}
+
+	ProfileSection &Profiler::getSection(const char *name, bool gpu) {
+
+		// There are only a few sections, so a linear search is enough.
+		for (size_t i = 0; i < this->sections.size(); i++) {
+
+			if (this->sections[i].gpu == gpu && strcmp(this->sections[i].name.c_str(), name) == 0)
+				return this->sections[i];
+
+		}
+
+		ProfileSection section;
+		section.name = name;
+		section.gpu = gpu;
+		section.samples = std::vector<float>(window, 0.0f);
+
+		if (gpu) {
+
+			section.queries = std::vector<GLuint>(regions * 2, 0);
+			section.query_frames = std::vector<unsigned long>(regions, 0);
+			glGenQueries(regions * 2, section.queries.data());
+
+		}
+
+		this->sections.push_back(section);
+
+		return this->sections.back();
+
+	}
+
+	void Profiler::remove() {
+
+		// Only the queries go, the statistics are kept so they can still be written.
+		for (size_t i = 0; i < this->sections.size(); i++) {
+
+			ProfileSection &section = this->sections[i];
+
+			if (!section.gpu || section.queries.empty())
+				continue;
+
+			glDeleteQueries(regions * 2, section.queries.data());
+			section.queries.clear();
+			std::fill(section.query_frames.begin(), section.query_frames.end(), 0);
+
+		}
+
+	}
+
+	void Profiler::updateStatistics() {
+
+		for (size_t i = 0; i < this->sections.size(); i++) {
+
+			ProfileSection &section = this->sections[i];
+
+			if (section.count == 0)
+				continue;
+
+			// Copy the window to find the percentile without reordering the samples. The
+			// scratch space takes a whole window at once so it does not grow as it fills.
+			this->sorted.reserve(window);
+			this->sorted.assign(section.samples.begin(), section.samples.begin() + section.count);
+
+			float sum = 0.0f;
+			section.min = this->sorted[0];
+
+			for (size_t j = 0; j < this->sorted.size(); j++) {
+
+				sum += this->sorted[j];
+				section.min = std::min(section.min, this->sorted[j]);
+
+			}
+
+			section.average = sum / section.count;
+
+			// Nearest-rank percentile.
+			size_t rank = (size_t)ceil(0.99 * section.count) - 1;
+			std::nth_element(this->sorted.begin(), this->sorted.begin() + rank, this->sorted.end());
+			section.p99 = this->sorted[rank];
+
+		}
+
+	}
+
+	bool Profiler::writeCSV(const char *filename) {
+
+		this->updateStatistics();
+
+		std::ofstream file(filename);
+
+		if (!file.is_open())
+			return false;
+
+		file << "section,type,samples,min_ms,avg_ms,p99_ms" << std::endl;
+
+		for (size_t i = 0; i < this->sections.size(); i++) {
+
+			ProfileSection &section = this->sections[i];
+
+			file << section.name << "," << (section.gpu ? "gpu" : "cpu") << "," << section.count << ",";
+			file << section.min << "," << section.average << "," << section.p99 << std::endl;
+
+		}
+
+		return file.good();
+
+	}
+
+	bool Profiler::writeJSON(const char *filename) {
+
+		this->updateStatistics();
+
+		nlohmann::json output;
+		output["frames"] = this->frames;
+		output["window"] = window;
+		output["sections"] = nlohmann::json::array();
+
+		for (size_t i = 0; i < this->sections.size(); i++) {
+
+			ProfileSection &section = this->sections[i];
+
+			nlohmann::json entry;
+			entry["name"] = section.name;
+			entry["type"] = section.gpu ? "gpu" : "cpu";
+			entry["samples"] = section.count;
+			entry["min_ms"] = section.min;
+			entry["avg_ms"] = section.average;
+			entry["p99_ms"] = section.p99;
+
+			output["sections"].push_back(entry);
+
+		}
+
+		std::ofstream file(filename);
+
+		if (!file.is_open())
+			return false;
+
+		file << output.dump(4) << std::endl;
+
+		return file.good();
+
+	}
+
+}  // namespace aladdin_3d
@@ -0,0 +1,198 @@
+/**
+ * @file Profiler.h
+ * @brief Profiler class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_PROFILER_H_
+#define ALADDIN_3D_CLASSES_PROFILER_H_
+
+#include <vector>
+
+#include "glew/glew.h"
+
+#include "Structs/ProfileSection/ProfileSection.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of a Profiler class.
+	 *
+	 * Measures named sections of every frame, on the CPU with a steady clock and on
+	 * the GPU with timestamp queries. Each GPU section keeps a ring of queries, one
+	 * pair per frame in flight, that are read a few frames later and only once their
+	 * results are available, so the profiler never stalls the pipeline. Every section
+	 * keeps a rolling window of samples with its minimum, average and 99th percentile.
+	 *
+	 * The sections are created the first time they are used. A GPU section should run
+	 * at most once per frame, while a CPU section adds up all its runs in a frame.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class Profiler {
+
+		public:
+
+			/**
+			 * @brief Starts a CPU section.
+			 *
+			 * Starts measuring a CPU section.
+			 *
+			 * @param name The name of the section.
+			 */
+			void beginCPU(const char *name);
+
+			/**
+			 * @brief Starts profiling a frame.
+			 *
+			 * Collects the GPU results of an old frame and starts measuring the frame.
+			 */
+			void beginFrame();
+
+			/**
+			 * @brief Starts a GPU section.
+			 *
+			 * Places the timestamp that starts a GPU section.
+			 *
+			 * @param name The name of the section.
+			 */
+			void beginGPU(const char *name);
+
+			/**
+			 * @brief Draws the statistics on the screen.
+			 *
+			 * Draws the statistics of every section as text on the top left corner of
+			 * the window. It leaves no shader program bound.
+			 *
+			 * @param height The height of the window.
+			 */
+			void drawOverlay(int height);
+
+			/**
+			 * @brief Stops a CPU section.
+			 *
+			 * Stops measuring a CPU section.
+			 *
+			 * @param name The name of the section.
+			 */
+			void endCPU(const char *name);
+
+			/**
+			 * @brief Stops profiling a frame.
+			 *
+			 * Stops measuring the frame and stores the CPU samples of this frame.
+			 */
+			void endFrame();
+
+			/**
+			 * @brief Stops a GPU section.
+			 *
+			 * Places the timestamp that ends a GPU section.
+			 *
+			 * @param name The name of the section.
+			 */
+			void endGPU(const char *name);
+
+			/**
+			 * @brief Get the number of profiled frames.
+			 *
+			 * Get the number of frames profiled so far.
+			 *
+			 * @returns The number of frames.
+			 */
+			unsigned long getFrames();
+
+			/**
+			 * @brief Removes the queries from OpenGL.
+			 *
+			 * Removes the queries of every GPU section from OpenGL. The statistics are kept,
+			 * so they can be written after the context is gone.
+			 */
+			void remove();
+
+			/**
+			 * @brief Writes the statistics in a CSV file.
+			 *
+			 * Writes one line per section with its minimum, average and 99th percentile.
+			 *
+			 * @param filename The path of the file.
+			 *
+			 * @returns True if the file could be written.
+			 */
+			bool writeCSV(const char *filename);
+
+			/**
+			 * @brief Writes the statistics in a JSON file.
+			 *
+			 * Writes one object per section with its minimum, average and 99th percentile.
+			 *
+			 * @param filename The path of the file.
+			 *
+			 * @returns True if the file could be written.
+			 */
+			bool writeJSON(const char *filename);
+
+			static const GLuint regions = 3;		/// Number of frames in flight.
+			static const size_t window = 240;		/// Number of samples in the rolling window.
+			static const unsigned long refresh = 30;	/// Frames between statistics updates.
+
+		private:
+
+			/**
+			 * @brief Adds a sample to a section.
+			 *
+			 * Adds a sample to the rolling window of a section, replacing the oldest one.
+			 *
+			 * @param section The section.
+			 * @param sample The sample in milliseconds.
+			 */
+			void addSample(ProfileSection &section, float sample);
+
+			/**
+			 * @brief Collects the GPU results of a region.
+			 *
+			 * Reads the queries of a region whose results are available. The rest are
+			 * dropped, since their queries are about to be reused.
+			 *
+			 * @param region The index of the region.
+			 */
+			void collect(GLuint region);
+
+			/**
+			 * @brief Gets a section.
+			 *
+			 * Gets a section by its name, creating it if it does not exist yet.
+			 *
+			 * @param name The name of the section.
+			 * @param gpu Whether the section is measured on the GPU.
+			 *
+			 * @returns The section.
+			 */
+			ProfileSection &getSection(const char *name, bool gpu);
+
+			/**
+			 * @brief Updates the statistics of every section.
+			 *
+			 * Computes the minimum, average and 99th percentile of every window.
+			 */
+			void updateStatistics();
+
+			std::vector<ProfileSection> sections;	/// Sections in order of creation.
+			std::vector<float> sorted;				/// Scratch space to find the percentiles.
+			GLuint region = 0;						/// Region being measured.
+			unsigned long frames = 0;				/// Frames profiled so far.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_PROFILER_H_
@@ -0,0 +1,89 @@
+/**
+ * @file ResourceTracker.cpp
+ * @brief ResourceTracker class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "ResourceTracker.h"
+
+#include <assert.h>
+#include <stddef.h>
+
+namespace aladdin_3d {
+
+	const unsigned int ResourceTracker::vertex_arrays;
+	const unsigned int ResourceTracker::buffers;
+	const unsigned int ResourceTracker::textures;
+	const unsigned int ResourceTracker::programs;
+	const unsigned int ResourceTracker::types;
+
+	size_t ResourceTracker::counts[ResourceTracker::types] = {};
+	size_t ResourceTracker::bytes[ResourceTracker::types] = {};
+
+	void ResourceTracker::add(unsigned int type, size_t bytes) {
+
+		assert(type < types);
+
+		ResourceTracker::counts[type]++;
+		ResourceTracker::bytes[type] += bytes;
+
+	}
+
+	size_t ResourceTracker::getBytes(unsigned int type) {
+
+		return ResourceTracker::bytes[type];
+
+	}
+
+	size_t ResourceTracker::getCount(unsigned int type) {
+
+		return ResourceTracker::counts[type];
+
+	}
+
+	const char *ResourceTracker::getName(unsigned int type) {
+
+		static const char *names[types] = { "Vertex arrays", "Buffers", "Textures", "Programs" };
+
+		return names[type];
+
+	}
+
+	size_t ResourceTracker::getTotalCount() {
+
+		size_t total = 0;
+
+		for (unsigned int i = 0; i < types; i++)
+			total += ResourceTracker::counts[i];
+
+		return total;
+
+	}
+
+	void ResourceTracker::remove(unsigned int type, size_t bytes) {
+
+		assert(type < types && ResourceTracker::counts[type] > 0 && ResourceTracker::bytes[type] >= bytes);
+
+		ResourceTracker::counts[type]--;
+		ResourceTracker::bytes[type] -= bytes;
+
+	}
+
+	void ResourceTracker::resize(unsigned int type, size_t old_bytes, size_t new_bytes) {
+
+		assert(type < types && ResourceTracker::bytes[type] >= old_bytes);
+
+		ResourceTracker::bytes[type] += new_bytes - old_bytes;
+
+	}
+
+}  // namespace aladdin_3d
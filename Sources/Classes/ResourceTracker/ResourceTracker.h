@@ -0,0 +1,125 @@
+/**
+ * @file ResourceTracker.h
+ * @brief ResourceTracker class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_RESOURCETRACKER_H_
+#define ALADDIN_3D_CLASSES_RESOURCETRACKER_H_
+
+#include <stddef.h>
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of a ResourceTracker class.
+	 *
+	 * Keeps count of the OpenGL objects that are alive and of the bytes they hold,
+	 * per type. Every GLHandle adds itself when it takes a name and removes itself
+	 * when it frees it, so whatever is left once everything has been released is a
+	 * leak. It is only used from the thread that owns the OpenGL context.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class ResourceTracker {
+
+		public:
+
+			/**
+			 * @brief Adds a resource.
+			 *
+			 * Counts a new live resource of a type.
+			 *
+			 * @param type The type of the resource.
+			 * @param bytes The bytes it holds on the GPU.
+			 */
+			static void add(unsigned int type, size_t bytes);
+
+			/**
+			 * @brief Gets the bytes of a type.
+			 *
+			 * Gets the bytes held by the live resources of a type.
+			 *
+			 * @param type The type of the resources.
+			 *
+			 * @returns The number of bytes.
+			 */
+			static size_t getBytes(unsigned int type);
+
+			/**
+			 * @brief Gets the number of resources of a type.
+			 *
+			 * Gets the number of live resources of a type.
+			 *
+			 * @param type The type of the resources.
+			 *
+			 * @returns The number of resources.
+			 */
+			static size_t getCount(unsigned int type);
+
+			/**
+			 * @brief Gets the name of a type.
+			 *
+			 * Gets a readable name for a type of resource.
+			 *
+			 * @param type The type of the resources.
+			 *
+			 * @returns The name of the type.
+			 */
+			static const char *getName(unsigned int type);
+
+			/**
+			 * @brief Gets the number of resources.
+			 *
+			 * Gets the number of live resources of every type.
+			 *
+			 * @returns The number of resources.
+			 */
+			static size_t getTotalCount();
+
+			/**
+			 * @brief Removes a resource.
+			 *
+			 * Stops counting a live resource of a type.
+			 *
+			 * @param type The type of the resource.
+			 * @param bytes The bytes it held on the GPU.
+			 */
+			static void remove(unsigned int type, size_t bytes);
+
+			/**
+			 * @brief Changes the bytes of a resource.
+			 *
+			 * Changes the bytes held by a live resource, once its storage is known.
+			 *
+			 * @param type The type of the resource.
+			 * @param old_bytes The bytes it held so far.
+			 * @param new_bytes The bytes it holds now.
+			 */
+			static void resize(unsigned int type, size_t old_bytes, size_t new_bytes);
+
+			static const unsigned int vertex_arrays = 0;	/// Vertex array objects.
+			static const unsigned int buffers = 1;			/// Buffer objects.
+			static const unsigned int textures = 2;			/// Texture objects.
+			static const unsigned int programs = 3;			/// Shader programs.
+			static const unsigned int types = 4;			/// Number of types.
+
+		private:
+
+			static size_t counts[types];	/// Live resources of every type.
+			static size_t bytes[types];		/// Bytes held by the live resources of every type.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_RESOURCETRACKER_H_
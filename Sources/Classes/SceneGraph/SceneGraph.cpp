@@ -0,0 +1,245 @@
+/**
+ * @file SceneGraph.cpp
+ * @brief SceneGraph class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+
+#include "SceneGraph.h"
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#include "glm/glm.hpp"
+#include "glm/gtc/quaternion.hpp"
+
+namespace aladdin_3d {
+
+	int SceneGraph::addNode(int parent, const glm::vec3 &translation, const glm::quat &rotation, const glm::vec3 &scale) {
+
+		int node = (int)this->parents.size();
+
+		// Grow the subtrees of the ancestors, which have to end right here.
+		for (int ancestor = parent; ancestor >= 0; ancestor = this->parents[ancestor]) {
+
+			if (this->ends[ancestor] != node) {
+
+				std::cerr << "Error 121-1006 - A scene graph node was added after the subtree of its parent." << std::endl;
+				exit(1);
+
+			}
+
+			this->ends[ancestor] = node + 1;
+
+		}
+
+		this->parents.push_back(parent);
+		this->ends.push_back(node + 1);
+		Transform local;
+		local.translation = translation;
+		local.rotation = rotation;
+		local.scale = scale;
+
+		this->locals.push_back(local);
+		this->worlds.push_back(glm::mat4(1.0f));
+		this->dirty.push_back(0);
+		this->changed.push_back(0);
+
+		this->markDirty(node);
+
+		return node;
+
+	}
+
+	void SceneGraph::decompose(const glm::mat4 &matrix, glm::vec3 *translation, glm::quat *rotation, glm::vec3 *scale) {
+
+		glm::vec3 x_axis = glm::vec3(matrix[0]);
+		glm::vec3 y_axis = glm::vec3(matrix[1]);
+		glm::vec3 z_axis = glm::vec3(matrix[2]);
+
+		// The scale is the length of the axes, with a mirror on X if the axes are left-handed.
+		*scale = glm::vec3(glm::length(x_axis), glm::length(y_axis), glm::length(z_axis));
+
+		if (glm::dot(x_axis, glm::cross(y_axis, z_axis)) < 0.0f)
+			scale->x = -scale->x;
+
+		// What is left once the scale is removed is the rotation.
+		glm::mat3 rotation_matrix(x_axis / scale->x, y_axis / scale->y, z_axis / scale->z);
+
+		*rotation = glm::normalize(glm::quat_cast(rotation_matrix));
+		*translation = glm::vec3(matrix[3]);
+
+	}
+
+	size_t SceneGraph::getCPUBytes() const {
+
+		size_t per_node = sizeof(int) * 2 + sizeof(Transform) + sizeof(glm::mat4) + 2;
+
+		return this->parents.capacity() * per_node;
+
+	}
+
+	size_t SceneGraph::getNodeCount() const {
+
+		return this->parents.size();
+
+	}
+
+	int SceneGraph::getParent(int node) const {
+
+		return this->parents[node];
+
+	}
+
+	glm::mat4 SceneGraph::getRelativeMatrix(int node, int ancestor) const {
+
+		if (node == ancestor || node < 0)
+			return glm::mat4(1.0f);
+
+		// Start from the node itself instead of multiplying it by the identity.
+		glm::mat4 matrix = toMatrix(this->locals[node]);
+
+		for (int current = this->parents[node]; current != ancestor && current >= 0; current = this->parents[current])
+			matrix = toMatrix(this->locals[current]) * matrix;
+
+		return matrix;
+
+	}
+
+	void SceneGraph::getTransforms(int node, glm::vec3 *translation, glm::quat *rotation, glm::vec3 *scale) const {
+
+		*translation = this->locals[node].translation;
+		*rotation = this->locals[node].rotation;
+		*scale = this->locals[node].scale;
+
+	}
+
+	const glm::mat4 &SceneGraph::getWorld(int node) const {
+
+		return this->worlds[node];
+
+	}
+
+	bool SceneGraph::hasChanged(int node) const {
+
+		return this->changed[node] != 0;
+
+	}
+
+	bool SceneGraph::isDirty() const {
+
+		return this->first_dirty < this->parents.size();
+
+	}
+
+	void SceneGraph::markDirty(int node) {
+
+		this->dirty[node] = 1;
+		this->first_dirty = std::min(this->first_dirty, (size_t)node);
+
+	}
+
+	void SceneGraph::rotate(int node, const glm::vec3 &axis, float angle) {
+
+		this->locals[node].rotation = glm::normalize(this->locals[node].rotation * glm::angleAxis(glm::radians(angle), glm::normalize(axis)));
+		this->markDirty(node);
+
+	}
+
+	void SceneGraph::scale(int node, const glm::vec3 &factors) {
+
+		this->locals[node].scale *= factors;
+		this->markDirty(node);
+
+	}
+
+	void SceneGraph::setTransforms(int node, const glm::vec3 &translation, const glm::quat &rotation, const glm::vec3 &scale) {
+
+		this->locals[node].translation = translation;
+		this->locals[node].rotation = rotation;
+		this->locals[node].scale = scale;
+		this->markDirty(node);
+
+	}
+
+	void SceneGraph::translate(int node, const glm::vec3 &offset) {
+
+		// The offset is in the coordinates of the node, so it gets its rotation and scale.
+		this->locals[node].translation += this->locals[node].rotation * (this->locals[node].scale * offset);
+		this->markDirty(node);
+
+	}
+
+	glm::mat4 SceneGraph::toMatrix(const Transform &transform) {
+
+		// Rotate and scale the axes, then place the origin.
+		glm::mat4 matrix = glm::mat4_cast(transform.rotation);
+		matrix[0] *= transform.scale.x;
+		matrix[1] *= transform.scale.y;
+		matrix[2] *= transform.scale.z;
+		matrix[3] = glm::vec4(transform.translation, 1.0f);
+
+		return matrix;
+
+	}
+
+	void SceneGraph::update() {
+
+		size_t count = this->parents.size();
+
+		// Forget what was recomputed in the last update.
+		for (size_t i = this->changed_begin; i < this->changed_end; i++)
+			this->changed[i] = 0;
+
+		this->changed_begin = count;
+		this->changed_end = 0;
+
+		// Nodes before the first dirty one are up to date.
+		size_t node = this->first_dirty;
+
+		while (node < count) {
+
+			if (!this->dirty[node]) {
+
+				node++;
+				continue;
+
+			}
+
+			// Recompute the whole subtree. Parents come first, so they are always ready.
+			size_t end = this->ends[node];
+
+			for (size_t i = node; i < end; i++) {
+
+				int parent = this->parents[i];
+				glm::mat4 local = toMatrix(this->locals[i]);
+
+				this->worlds[i] = parent < 0 ? local : this->worlds[parent] * local;
+				this->dirty[i] = 0;
+				this->changed[i] = 1;
+
+			}
+
+			this->changed_begin = std::min(this->changed_begin, node);
+			this->changed_end = end;
+			node = end;
+
+		}
+
+		this->first_dirty = count;
+
+	}
+
+}  // namespace aladdin_3d
@@ -0,0 +1,252 @@
+/**
+ * @file SceneGraph.h
+ * @brief SceneGraph class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+
+#ifndef ALADDIN_3D_CLASSES_SCENEGRAPH_H_
+#define ALADDIN_3D_CLASSES_SCENEGRAPH_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "glm/glm.hpp"
+#include "glm/gtc/quaternion.hpp"
+
+#include "Structs/Transform/Transform.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of a SceneGraph class.
+	 *
+	 * Keeps a hierarchy of nodes in flat arrays, with every parent before its children
+	 * and every subtree in a contiguous range. Each node holds its transforms relative
+	 * to its parent as a translation, a rotation and a scale, packed in ten floats, and
+	 * caches its world matrix. Moving a node composes quaternions, and its matrix is
+	 * only built when the world matrices are updated.
+	 *
+	 * Changing a node only marks it as dirty. The world matrices are recomputed when
+	 * the graph is updated, and only for the dirty subtrees, in a single forward pass
+	 * in which every parent is always ready before its children.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class SceneGraph {
+
+		public:
+
+			/**
+			 * @brief Adds a node.
+			 *
+			 * Adds a node at the end of the graph. The parent has to be the last subtree
+			 * of the graph, so that the subtrees stay contiguous.
+			 *
+			 * @param parent The index of the parent node, -1 for a root.
+			 * @param translation The translation relative to the parent.
+			 * @param rotation The rotation relative to the parent.
+			 * @param scale The scale relative to the parent.
+			 *
+			 * @returns The index of the new node.
+			 */
+			int addNode(int parent, const glm::vec3 &translation = glm::vec3(0.0f),
+				const glm::quat &rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f), const glm::vec3 &scale = glm::vec3(1.0f));
+
+			/**
+			 * @brief Splits a matrix into its transforms.
+			 *
+			 * Gets the translation, rotation and scale of an affine matrix without shear.
+			 *
+			 * @param matrix The matrix.
+			 * @param translation Outputs the translation.
+			 * @param rotation Outputs the rotation.
+			 * @param scale Outputs the scale.
+			 */
+			static void decompose(const glm::mat4 &matrix, glm::vec3 *translation, glm::quat *rotation, glm::vec3 *scale);
+
+			/**
+			 * @brief Gets the memory used on the CPU.
+			 *
+			 * Gets the bytes used by the nodes, without the graph itself.
+			 *
+			 * @returns The number of bytes.
+			 */
+			size_t getCPUBytes() const;
+
+			/**
+			 * @brief Gets the transforms of a node relative to an ancestor.
+			 *
+			 * Multiplies the local transforms from an ancestor, excluded, down to a node.
+			 *
+			 * @param node The index of the node.
+			 * @param ancestor The index of the ancestor, -1 for the whole path from the root.
+			 *
+			 * @returns The transform matrix.
+			 */
+			glm::mat4 getRelativeMatrix(int node, int ancestor) const;
+
+			/**
+			 * @brief Gets the number of nodes.
+			 *
+			 * Gets the number of nodes in the graph.
+			 *
+			 * @returns The number of nodes.
+			 */
+			size_t getNodeCount() const;
+
+			/**
+			 * @brief Gets the parent of a node.
+			 *
+			 * Gets the index of the parent of a node.
+			 *
+			 * @param node The index of the node.
+			 *
+			 * @returns The index of the parent, -1 for a root.
+			 */
+			int getParent(int node) const;
+
+			/**
+			 * @brief Gets the transforms of a node.
+			 *
+			 * Gets the transforms of a node relative to its parent.
+			 *
+			 * @param node The index of the node.
+			 * @param translation Outputs the translation.
+			 * @param rotation Outputs the rotation.
+			 * @param scale Outputs the scale.
+			 */
+			void getTransforms(int node, glm::vec3 *translation, glm::quat *rotation, glm::vec3 *scale) const;
+
+			/**
+			 * @brief Gets the world matrix of a node.
+			 *
+			 * Gets the world matrix of a node as of the last update.
+			 *
+			 * @param node The index of the node.
+			 *
+			 * @returns The world matrix.
+			 */
+			const glm::mat4 &getWorld(int node) const;
+
+			/**
+			 * @brief Checks if a node changed in the last update.
+			 *
+			 * Checks if the world matrix of a node was recomputed in the last update.
+			 *
+			 * @param node The index of the node.
+			 *
+			 * @returns True if it was recomputed.
+			 */
+			bool hasChanged(int node) const;
+
+			/**
+			 * @brief Checks if the graph needs an update.
+			 *
+			 * Checks if any node changed since the last update.
+			 *
+			 * @returns True if some world matrix is out of date.
+			 */
+			bool isDirty() const;
+
+			/**
+			 * @brief Rotates a node.
+			 *
+			 * Rotates a node in its own coordinates, as if its matrix was multiplied by a
+			 * rotation on the right. It is exact as long as the scale of the node is uniform.
+			 *
+			 * @param node The index of the node.
+			 * @param axis The axis of the rotation.
+			 * @param angle The angle in degrees.
+			 */
+			void rotate(int node, const glm::vec3 &axis, float angle);
+
+			/**
+			 * @brief Scales a node.
+			 *
+			 * Scales a node in its own coordinates, as if its matrix was multiplied by a
+			 * scale on the right.
+			 *
+			 * @param node The index of the node.
+			 * @param factors The scale on each axis.
+			 */
+			void scale(int node, const glm::vec3 &factors);
+
+			/**
+			 * @brief Sets the transforms of a node.
+			 *
+			 * Sets the transforms of a node relative to its parent.
+			 *
+			 * @param node The index of the node.
+			 * @param translation The translation.
+			 * @param rotation The rotation.
+			 * @param scale The scale.
+			 */
+			void setTransforms(int node, const glm::vec3 &translation, const glm::quat &rotation, const glm::vec3 &scale);
+
+			/**
+			 * @brief Translates a node.
+			 *
+			 * Translates a node in its own coordinates, as if its matrix was multiplied by
+			 * a translation on the right.
+			 *
+			 * @param node The index of the node.
+			 * @param offset The translation.
+			 */
+			void translate(int node, const glm::vec3 &offset);
+
+			/**
+			 * @brief Expands a transform into a matrix.
+			 *
+			 * Builds the matrix that scales, rotates and translates like the transform.
+			 *
+			 * @param transform The transform.
+			 *
+			 * @returns The matrix.
+			 */
+			static glm::mat4 toMatrix(const Transform &transform);
+
+			/**
+			 * @brief Updates the world matrices.
+			 *
+			 * Recomputes the world matrices of the dirty subtrees. Nothing is done if no
+			 * node changed since the last update.
+			 */
+			void update();
+
+		private:
+
+			/**
+			 * @brief Marks a node as dirty.
+			 *
+			 * Marks a node so that its subtree is recomputed in the next update.
+			 *
+			 * @param node The index of the node.
+			 */
+			void markDirty(int node);
+
+			std::vector<int> parents;				/// Parent of every node, -1 for the roots.
+			std::vector<int> ends;					/// Index right after the subtree of every node.
+			std::vector<Transform> locals;			/// Transforms of every node relative to its parent.
+			std::vector<glm::mat4> worlds;			/// World matrix of every node as of the last update.
+			std::vector<unsigned char> dirty;		/// Whether every node changed since the last update.
+			std::vector<unsigned char> changed;		/// Whether every node was recomputed in the last update.
+			size_t first_dirty = 0;					/// First dirty node, the number of nodes if none.
+			size_t changed_begin = 0;				/// First node recomputed in the last update.
+			size_t changed_end = 0;					/// Index right after the last node recomputed in the last update.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_SCENEGRAPH_H_
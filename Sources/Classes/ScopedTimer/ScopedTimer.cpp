@@ -0,0 +1,36 @@
+/**
+ * @file ScopedTimer.cpp
+ * @brief ScopedTimer class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "ScopedTimer.h"
+
+#include "Classes/Profiler/Profiler.h"
+
+namespace aladdin_3d {
+
+	ScopedTimer::ScopedTimer(Profiler &profiler, const char *name) {
+
+		this->profiler = &profiler;
+		this->name = name;
+		this->profiler->beginCPU(this->name);
+
+	}
+
+	ScopedTimer::~ScopedTimer() {
+
+		this->profiler->endCPU(this->name);
+
+	}
+
+}  // namespace aladdin_3d
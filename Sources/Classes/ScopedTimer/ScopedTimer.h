@@ -0,0 +1,64 @@
+/**
+ * @file ScopedTimer.h
+ * @brief ScopedTimer class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_SCOPEDTIMER_H_
+#define ALADDIN_3D_CLASSES_SCOPEDTIMER_H_
+
+#include "Classes/Profiler/Profiler.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of a ScopedTimer class.
+	 *
+	 * Measures a CPU section of the profiler from its construction until the end
+	 * of its scope.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class ScopedTimer {
+
+		public:
+
+			/**
+			 * @brief Starts measuring a section.
+			 *
+			 * Starts measuring a CPU section of the profiler.
+			 *
+			 * @param profiler The profiler.
+			 * @param name The name of the section. It has to outlive the timer.
+			 */
+			ScopedTimer(Profiler &profiler, const char *name);
+
+			/**
+			 * @brief Stops measuring the section.
+			 *
+			 * Stops measuring the CPU section.
+			 */
+			~ScopedTimer();
+
+			ScopedTimer(const ScopedTimer&) = delete;
+			ScopedTimer &operator=(const ScopedTimer&) = delete;
+
+		private:
+
+			Profiler *profiler = nullptr;		/// Profiler that owns the section.
+			const char *name = nullptr;			/// Name of the section.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_SCOPEDTIMER_H_
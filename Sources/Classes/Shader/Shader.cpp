@@ -19,6 +19,7 @@
 #include <fstream>
 #include <sstream>
 #include <iostream>
+#include <stdexcept>
 
 #include "glew/glew.h"
 #include "glm/glm.hpp"
@@ -26,23 +27,18 @@
 #include <glm/gtx/string_cast.hpp>
 
 #include "Classes/Camera/Camera.h"
+#include "Classes/GLHandle/GLHandle.h"
 #include "Classes/Light/Light.h"
+#include "Classes/ResourceTracker/ResourceTracker.h"
+#include "Classes/StreamBuffer/StreamBuffer.h"
 #include "Classes/Texture/Texture.h"
 
 namespace aladdin_3d {
 
-    Shader::Shader() {
-    
-        this->programID = NULL;
-
-        this->light = new Light(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec4(0.0f, 0.0f, 0.0f, 0.0f));
-    
-    }
+    Shader::Shader() {}
     
     Shader::Shader(const char* vertex_filename, const char* fragment_filename) {
 
-        this->light = new Light(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec4(0.0f, 0.0f, 0.0f, 0.0f));
-
         // Init the strings to store the source code in.
         std::string vertex_source_code = "";
         std::string fragment_source_code = "";
@@ -102,14 +98,14 @@ namespace aladdin_3d {
         }
 
         // Create the program and add the vertex and fragment shaders.
-        this->programID = glCreateProgram();
-        glAttachShader(this->programID, vertex);
-        glAttachShader(this->programID, fragment);
+        this->program = GLHandle(glCreateProgram(), ResourceTracker::programs);
+        glAttachShader(this->program.get(), vertex);
+        glAttachShader(this->program.get(), fragment);
 
         // Link this program and check for program errors.
-        glLinkProgram(this->programID);
+        glLinkProgram(this->program.get());
         error_msg = "";
-        if (!Shader::checkShader(this->programID, "PROGRAM", &error_msg)) {
+        if (!Shader::checkShader(this->program.get(), "PROGRAM", &error_msg)) {
 
             std::cerr << "Shader program error - Could not link the shaders: " << error_msg << std::endl;
             exit(1);
@@ -121,90 +117,109 @@ namespace aladdin_3d {
         glDeleteShader(vertex);
         glDeleteShader(fragment);
 
+        // Point the per-draw data sampler to its own slot before validating.
+        glUseProgram(this->program.get());
+        glUniform1i(glGetUniformLocation(this->program.get(), "drawData"), StreamBuffer::slot);
+
         // Validate the program.
-        glValidateProgram(this->programID);
+        glValidateProgram(this->program.get());
         error_msg = "";
-        if (!Shader::checkShader(this->programID, "VALIDATE", &error_msg)) {
+        if (!Shader::checkShader(this->program.get(), "VALIDATE", &error_msg)) {
 
             std::cerr << "Shader program error - Could not validate the program: " << error_msg << std::endl;
             exit(1);
 
         }
 
+        // The draw index is passed for every draw, so look its location up only once.
+        this->draw_index_location = glGetUniformLocation(this->program.get(), "drawIndex");
+
     }
 
     unsigned int Shader::getProgramID() {
 
-        return this->programID;
+        return this->program.get();
 
     }
 
     void Shader::activate() {
 
-        if (this->programID == NULL)
-            throw std::exception("Shader was not initialized.");
+        if (this->program.get() == 0)
+            throw std::runtime_error("Shader was not initialized.");
 
-        glUseProgram(this->programID);
+        glUseProgram(this->program.get());
 
     }
 
-    void Shader::passBool(const std::string& name, bool value) {
+    void Shader::passBool(const char *name, bool value) {
 
-        glUniform1i(glGetUniformLocation(this->programID, name.c_str()), (int)value);
+        glUniform1i(glGetUniformLocation(this->program.get(), name), (int)value);
 
     }
 
-    void Shader::passCamera(Camera camera) {
+    void Shader::passCamera(Camera &camera) {
 
         // Get the camera position.
         glm::vec3 camera_position = camera.getPosition();
 
         // Pass the View matrix to the shader.
         glm::mat4 view_matrix = camera.getView();
-        GLint location = glGetUniformLocation(this->programID, "View");
+        GLint location = glGetUniformLocation(this->program.get(), "View");
         glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(view_matrix));
 
         // Pass the Projection matrix to the shader.
         glm::mat4 projection_matrix = camera.getProjection();
-        location = glGetUniformLocation(this->programID, "Projection");
+        location = glGetUniformLocation(this->program.get(), "Projection");
         glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(projection_matrix));
 
         // Get the camera info and pass it to the shader.
-        glm::vec4 color = (*this->light).getColor();
-        glm::vec3 position = (*this->light).getPosition();
+        glm::vec4 color = this->light.getColor();
+        glm::vec3 position = this->light.getPosition();
 
         // Transform the camera position to view.
         position = glm::vec3(view_matrix * glm::vec4(position, 1.0f));
 
         // Pass it to the shader.
-        glUniform4f(glGetUniformLocation(this->programID, "lightColor"), color.x, color.y, color.z, color.w);
-        glUniform3f(glGetUniformLocation(this->programID, "lightPos"), position.x, position.y, position.z);
+        glUniform4f(glGetUniformLocation(this->program.get(), "lightColor"), color.x, color.y, color.z, color.w);
+        glUniform3f(glGetUniformLocation(this->program.get(), "lightPos"), position.x, position.y, position.z);
+
+    }
+
+    void Shader::passDrawIndex(int index) {
+
+        glUniform1i(this->draw_index_location, index);
 
     }
 
     void Shader::passLight(Light lightParam) {
 
         // Store the light.
-        this->light = new Light(lightParam.getPosition(), lightParam.getColor());
+        this->light = lightParam;
+
+    }
+
+    void Shader::passInt(const char *name, int value) {
+
+        glUniform1i(glGetUniformLocation(this->program.get(), name), value);
 
     }
 
-    void Shader::passInt(const std::string& name, int value) {
+    void Shader::passFloat(const char *name, float value) {
 
-        glUniform1i(glGetUniformLocation(this->programID, name.c_str()), value);
+        glUniform1f(glGetUniformLocation(this->program.get(), name), value);
 
     }
 
-    void Shader::passFloat(const std::string& name, float value) {
+    void Shader::passMatrices(const char *name, const glm::mat4 *matrices, GLsizei count) {
 
-        glUniform1f(glGetUniformLocation(this->programID, name.c_str()), value);
+        glUniformMatrix4fv(glGetUniformLocation(this->program.get(), name), count, GL_FALSE, glm::value_ptr(matrices[0]));
 
     }
 
-    void Shader::passTexture(Texture texture) {
+    void Shader::passTexture(Texture &texture) {
 
         // Gets the location of the uniform.
-        GLuint location = glGetUniformLocation(this->programID, texture.getName().c_str());
+        GLuint location = glGetUniformLocation(this->program.get(), texture.getName().c_str());
 
         // Activate the shader.
         this->activate();
@@ -216,7 +231,7 @@ namespace aladdin_3d {
 
     void Shader::remove() {
 
-        glDeleteProgram(this->programID);
+        this->program.reset();
 
     }
 
@@ -21,6 +21,7 @@
 #include "glm/glm.hpp"
 
 #include "Classes/Camera/Camera.h"
+#include "Classes/GLHandle/GLHandle.h"
 #include "Classes/Light/Light.h"
 #include "Classes/Texture/Texture.h"
 
@@ -30,7 +31,8 @@ namespace aladdin_3d {
      * @brief Implementation of a Shader class.
      *
      * Implementation of a Shader class to handle loading, activation and
-     * errors in vertex and fragment shaders.
+     * errors in vertex and fragment shaders. It owns its OpenGL program, so it can
+     * be moved but not copied, and frees it when it is destroyed.
      *
      * @author Borja Garca Quiroga <garcaqub@tcd.ie>
      */
@@ -55,6 +57,11 @@ namespace aladdin_3d {
          */
         Shader(const char* vertex_filename, const char* fragment_filename);
 
+        Shader(Shader&&) = default;
+        Shader &operator=(Shader&&) = default;
+        Shader(const Shader&) = delete;
+        Shader &operator=(const Shader&) = delete;
+
         /**
          *@brief Returns the program ID.
          *
@@ -79,7 +86,7 @@ namespace aladdin_3d {
          * @param name The name that the variable will receive within the shaders.
          * @param value The bool to be passed to the program.
          */
-        void passBool(const std::string& name, bool value);
+        void passBool(const char *name, bool value);
 
         /**
          * @brief Pass the camera matrix and camera position to the shader.
@@ -88,7 +95,16 @@ namespace aladdin_3d {
          *
          * @param camera The camera.
          */
-        void passCamera(Camera camera);
+        void passCamera(Camera &camera);
+
+        /**
+         * @brief Pass the draw index to the shader.
+         *
+         * Pass the index of the per-draw data in the stream buffer to the shader.
+         *
+         * @param index The draw index.
+         */
+        void passDrawIndex(int index);
 
         /**
          * @brief Pass a light to the shader.
@@ -107,7 +123,7 @@ namespace aladdin_3d {
          * @param name The name that the variable will receive within the shaders.
          * @param value The int to be passed to the program.
          */
-        void passInt(const std::string& name, int value);
+        void passInt(const char *name, int value);
 
         /**
          * @brief Pass a given float to the shaders.
@@ -117,7 +133,18 @@ namespace aladdin_3d {
          * @param name The name that the variable will receive within the shaders.
          * @param value The float to be passed to the program.
          */
-        void passFloat(const std::string& name, float value);
+        void passFloat(const char *name, float value);
+
+        /**
+         * @brief Pass an array of matrices to the shaders.
+         *
+         * Pass an array of 4x4 matrices to the shader program in a single upload.
+         *
+         * @param name The name that the array will receive within the shaders.
+         * @param matrices The first matrix.
+         * @param count The number of matrices.
+         */
+        void passMatrices(const char *name, const glm::mat4 *matrices, GLsizei count);
 
         /**
          * @brief Pass a texture to the shader.
@@ -126,12 +153,12 @@ namespace aladdin_3d {
          * 
          * @param texture The texture itself.
          */
-        void passTexture(Texture texture);
+        void passTexture(Texture &texture);
 
         /**
          * @brief Remove the shader from OpenGL.
          * 
-         * Remove the shader from OpenGL.
+         * Remove the shader from OpenGL. It does nothing if it was already removed.
          */
         void remove();
 
@@ -162,8 +189,9 @@ namespace aladdin_3d {
          */
         static void readFileContents(const char* filename, std::string *file_contents);
 
-        Light* light; /// The light that will be used in the shader.
-        unsigned int programID; /// OpenGL ID for this shader program.
+        int draw_index_location = -1; /// Location of the draw index uniform.
+        Light light = Light(glm::vec3(0.0f), glm::vec4(0.0f)); /// The light that will be used in the shader.
+        GLHandle program; /// OpenGL ID for this shader program.
 
     };
 
@@ -0,0 +1,54 @@
+/**
+ * @file StateBuffer.cpp
+ * @brief StateBuffer class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "StateBuffer.h"
+
+#include <atomic>
+
+#include "Structs/SimulationState/SimulationState.h"
+
+namespace aladdin_3d {
+
+	const unsigned int StateBuffer::fresh;
+
+	void StateBuffer::publish(const SimulationState &state) {
+
+		// Fill our slot and swap it with the middle one, marking it as fresh.
+		this->slots[this->back] = state;
+
+		unsigned int previous = this->middle.exchange(this->back | fresh, std::memory_order_acq_rel);
+		this->back = previous & ~fresh;
+
+	}
+
+	bool StateBuffer::read(SimulationState &state) {
+
+		// Only take the middle slot if it has something new.
+		bool updated = (this->middle.load(std::memory_order_acquire) & fresh) != 0;
+
+		if (updated) {
+
+			unsigned int previous = this->middle.exchange(this->front, std::memory_order_acq_rel);
+			this->front = previous & ~fresh;
+
+		}
+
+		state = this->slots[this->front];
+
+		return updated;
+
+	}
+
+}  // namespace aladdin_3d
@@ -0,0 +1,76 @@
+/**
+ * @file StateBuffer.h
+ * @brief StateBuffer class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_STATEBUFFER_H_
+#define ALADDIN_3D_CLASSES_STATEBUFFER_H_
+
+#include <atomic>
+
+#include "Structs/SimulationState/SimulationState.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of a StateBuffer class.
+	 *
+	 * Implementation of a lock-free triple buffer that hands the snapshots of the game
+	 * state from the simulation thread to the render thread. The writer always has a
+	 * slot of its own to fill, the reader always has a slot of its own to read, and the
+	 * third slot holds the latest snapshot. Both sides swap their slot with the middle
+	 * one atomically, so neither of them ever waits for the other.
+	 *
+	 * Only one thread may publish and only one thread may read.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class StateBuffer {
+
+		public:
+
+			/**
+			 * @brief Publishes a snapshot.
+			 *
+			 * Publishes a snapshot, replacing the previous one if it was not read.
+			 *
+			 * @param state The snapshot.
+			 */
+			void publish(const SimulationState &state);
+
+			/**
+			 * @brief Reads the latest snapshot.
+			 *
+			 * Reads the latest published snapshot, or the last one read if there is
+			 * nothing new.
+			 *
+			 * @param state Outputs the snapshot.
+			 *
+			 * @returns True if the snapshot is new.
+			 */
+			bool read(SimulationState &state);
+
+		private:
+
+			static const unsigned int fresh = 4;	/// Flag of the middle slot when it was not read.
+
+			SimulationState slots[3];				/// The three snapshots.
+			std::atomic<unsigned int> middle{1};	/// Slot with the latest snapshot and the fresh flag.
+			unsigned int back = 0;					/// Slot being written.
+			unsigned int front = 2;					/// Slot being read.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_STATEBUFFER_H_
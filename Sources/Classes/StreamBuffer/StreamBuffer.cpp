@@ -0,0 +1,227 @@
+/**
+ * @file StreamBuffer.cpp
+ * @brief StreamBuffer class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "StreamBuffer.h"
+
+#include <iostream>
+#include <vector>
+
+#include "glew/glew.h"
+
+#include "Classes/GLHandle/GLHandle.h"
+#include "Classes/ResourceTracker/ResourceTracker.h"
+#include "Structs/DrawData/DrawData.h"
+
+namespace aladdin_3d {
+
+	StreamBuffer::StreamBuffer() {}
+
+	StreamBuffer::StreamBuffer(GLuint capacity) {
+
+		// Store the parameters.
+		this->capacity = capacity;
+
+		// Persistent mapping needs buffer storage (core in OpenGL 4.4).
+		this->persistent = GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage;
+
+		// Check that the buffer texture can address every region.
+		GLint max_texels = 0;
+		glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &max_texels);
+		GLsizeiptr texels = (GLsizeiptr)this->capacity * regions * sizeof(DrawData) / sizeof(glm::vec4);
+
+		if (texels > max_texels)
+			std::cerr << "Warning - The stream buffer is larger than GL_MAX_TEXTURE_BUFFER_SIZE." << std::endl;
+
+		// Generate the buffer.
+		GLuint name = 0;
+		glGenBuffers(1, &name);
+		this->ID = GLHandle(name, ResourceTracker::buffers);
+		glBindBuffer(GL_TEXTURE_BUFFER, name);
+
+		if (this->persistent) {
+
+			// Allocate all the regions at once and keep them mapped for the whole execution.
+			GLsizeiptr size = (GLsizeiptr)this->capacity * regions * sizeof(DrawData);
+			GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			glBufferStorage(GL_TEXTURE_BUFFER, size, NULL, flags);
+			this->ID.setBytes(size);
+			this->mapped = (DrawData*)glMapBufferRange(GL_TEXTURE_BUFFER, 0, size, flags);
+
+		} else {
+
+			// A single region is enough because the buffer gets orphaned every frame.
+			glBufferData(GL_TEXTURE_BUFFER, (GLsizeiptr)this->capacity * sizeof(DrawData), NULL, GL_STREAM_DRAW);
+			this->ID.setBytes((size_t)this->capacity * sizeof(DrawData));
+			this->staging = std::vector<DrawData>(this->capacity);
+
+		}
+
+		// Expose the buffer to the shaders as a buffer texture.
+		glGenTextures(1, &name);
+		this->texture_ID = GLHandle(name, ResourceTracker::textures);
+		glBindTexture(GL_TEXTURE_BUFFER, name);
+		glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, this->ID.get());
+
+		// Unbind everything.
+		glBindTexture(GL_TEXTURE_BUFFER, 0);
+		glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+		// Start right before the first region so that the first frame writes to it.
+		this->region = regions - 1;
+
+	}
+
+	void StreamBuffer::beginFrame() {
+
+		// Rewind the cursors.
+		this->cursor = 0;
+		this->flushed = 0;
+
+		if (this->persistent) {
+
+			// Move to the next region and wait until the GPU has finished reading it.
+			this->region = (this->region + 1) % regions;
+			this->waitRegion(this->region);
+
+		} else {
+
+			// Orphan the buffer so the driver can hand us fresh memory without syncing.
+			glBindBuffer(GL_TEXTURE_BUFFER, this->ID.get());
+			glBufferData(GL_TEXTURE_BUFFER, (GLsizeiptr)this->capacity * sizeof(DrawData), NULL, GL_STREAM_DRAW);
+			glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+		}
+
+	}
+
+	void StreamBuffer::bind() {
+
+		// Activate the slot and bind the buffer texture.
+		glActiveTexture(GL_TEXTURE0 + slot);
+		glBindTexture(GL_TEXTURE_BUFFER, this->texture_ID.get());
+
+	}
+
+	void StreamBuffer::endFrame() {
+
+		// The fallback relies on orphaning, so it does not need fences.
+		if (!this->persistent)
+			return;
+
+		// Mark the point after which the region can be written again.
+		this->fences[this->region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+	}
+
+	void StreamBuffer::flush() {
+
+		// Persistent and coherent writes are already visible to the GPU.
+		if (this->persistent || this->flushed == this->cursor)
+			return;
+
+		// Upload the draws reserved since the last flush.
+		GLintptr offset = (GLintptr)this->flushed * sizeof(DrawData);
+		GLsizeiptr size = (GLsizeiptr)(this->cursor - this->flushed) * sizeof(DrawData);
+
+		glBindBuffer(GL_TEXTURE_BUFFER, this->ID.get());
+		glBufferSubData(GL_TEXTURE_BUFFER, offset, size, &this->staging[this->flushed]);
+		glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+		this->flushed = this->cursor;
+
+	}
+
+	GLuint StreamBuffer::getCapacity() {
+
+		return this->capacity;
+
+	}
+
+	bool StreamBuffer::isPersistent() {
+
+		return this->persistent;
+
+	}
+
+	void StreamBuffer::remove() {
+
+		// Wait for the GPU before releasing the memory.
+		for (GLuint i = 0; i < regions; i++)
+			this->waitRegion(i);
+
+		// Unmap the buffer if it was mapped.
+		if (this->mapped != nullptr) {
+
+			glBindBuffer(GL_TEXTURE_BUFFER, this->ID.get());
+			glUnmapBuffer(GL_TEXTURE_BUFFER);
+			glBindBuffer(GL_TEXTURE_BUFFER, 0);
+			this->mapped = nullptr;
+
+		}
+
+		this->texture_ID.reset();
+		this->ID.reset();
+
+	}
+
+	DrawData *StreamBuffer::reserve(GLuint count, GLint *first) {
+
+		// Check that there is room for these draws.
+		if (this->cursor + count > this->capacity) {
+
+			std::cerr << "Error 121-1003 - The stream buffer ran out of space." << std::endl;
+			exit(1);
+
+		}
+
+		// Find where the draws go.
+		DrawData *data = nullptr;
+
+		if (this->persistent) {
+
+			*first = this->region * this->capacity + this->cursor;
+			data = &this->mapped[*first];
+
+		} else {
+
+			*first = this->cursor;
+			data = &this->staging[*first];
+
+		}
+
+		this->cursor += count;
+
+		return data;
+
+	}
+
+	void StreamBuffer::waitRegion(GLuint region) {
+
+		// Nothing to wait for if the region was never used.
+		if (this->fences[region] == nullptr)
+			return;
+
+		// Check without blocking first, then flush and wait until it is signaled.
+		GLenum status = glClientWaitSync(this->fences[region], 0, 0);
+
+		while (status == GL_TIMEOUT_EXPIRED)
+			status = glClientWaitSync(this->fences[region], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+
+		glDeleteSync(this->fences[region]);
+		this->fences[region] = nullptr;
+
+	}
+
+}  // namespace aladdin_3d
@@ -0,0 +1,165 @@
+/**
+ * @file StreamBuffer.h
+ * @brief StreamBuffer class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_STREAMBUFFER_H_
+#define ALADDIN_3D_CLASSES_STREAMBUFFER_H_
+
+#include <vector>
+
+#include "glew/glew.h"
+
+#include "Classes/GLHandle/GLHandle.h"
+#include "Structs/DrawData/DrawData.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of a StreamBuffer class.
+	 *
+	 * Implementation of a ring buffer that streams the per-draw data to the shaders.
+	 * The buffer is split in one region per frame in flight. When the context supports
+	 * buffer storage the regions are persistently mapped and a fence guards every
+	 * region until the GPU is done with it. Otherwise, the data is kept in memory and
+	 * uploaded with glBufferSubData after orphaning the buffer at the start of the frame.
+	 *
+	 * The shaders read the data through a buffer texture, indexed by the draw index.
+	 * The buffer and its texture are owned by the stream buffer, which can be moved
+	 * but not copied.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class StreamBuffer {
+
+		public:
+
+			/**
+			 * @brief Constructs an empty stream buffer.
+			 *
+			 * Constructs an empty stream buffer. It will not hold anything until it is created.
+			 */
+			StreamBuffer();
+
+			/**
+			 * @brief Constructs a stream buffer.
+			 *
+			 * Constructs a stream buffer and allocates its regions in OpenGL.
+			 *
+			 * @param capacity Maximum number of draws in a single frame.
+			 */
+			StreamBuffer(GLuint capacity);
+
+			StreamBuffer(StreamBuffer&&) = default;
+			StreamBuffer &operator=(StreamBuffer&&) = default;
+			StreamBuffer(const StreamBuffer&) = delete;
+			StreamBuffer &operator=(const StreamBuffer&) = delete;
+
+			/**
+			 * @brief Starts a new frame.
+			 *
+			 * Moves to the next region and makes sure the GPU is no longer reading it.
+			 */
+			void beginFrame();
+
+			/**
+			 * @brief Binds the buffer texture.
+			 *
+			 * Binds the buffer texture in its slot so that the shaders can read it.
+			 */
+			void bind();
+
+			/**
+			 * @brief Ends the current frame.
+			 *
+			 * Places a fence after the draws that read the current region.
+			 */
+			void endFrame();
+
+			/**
+			 * @brief Makes the written data visible to the GPU.
+			 *
+			 * Uploads everything written since the last flush. It has to be called before
+			 * the draws that read that data are issued.
+			 */
+			void flush();
+
+			/**
+			 * @brief Get the capacity of the buffer.
+			 *
+			 * Get the maximum number of draws in a single frame.
+			 *
+			 * @returns The capacity of the buffer.
+			 */
+			GLuint getCapacity();
+
+			/**
+			 * @brief Checks if the buffer is persistently mapped.
+			 *
+			 * Checks if the buffer is persistently mapped or uses the glBufferSubData fallback.
+			 *
+			 * @returns True if the buffer is persistently mapped.
+			 */
+			bool isPersistent();
+
+			/**
+			 * @brief Removes the buffer from OpenGL.
+			 *
+			 * Removes the buffer, its texture and its fences from OpenGL. It does nothing
+			 * if it was already removed.
+			 */
+			void remove();
+
+			/**
+			 * @brief Reserves room for some draws.
+			 *
+			 * Reserves room for some consecutive draws in the current region so that
+			 * their data can be written in place.
+			 *
+			 * @param count The number of draws.
+			 * @param first Outputs the draw index of the first draw.
+			 *
+			 * @returns Where the data of the first draw has to be written.
+			 */
+			DrawData *reserve(GLuint count, GLint *first);
+
+			static const GLuint regions = 3;	/// Number of frames in flight.
+			static const GLuint slot = 8;		/// Texture slot the shaders read the data from.
+
+		private:
+
+			/**
+			 * @brief Waits until the GPU is done with a region.
+			 *
+			 * Waits until the GPU is done with a region and deletes its fence.
+			 *
+			 * @param region The index of the region.
+			 */
+			void waitRegion(GLuint region);
+
+			GLHandle ID;							/// OpenGL buffer ID.
+			GLHandle texture_ID;					/// OpenGL buffer texture ID.
+			GLuint capacity = 0;					/// Maximum number of draws per frame.
+			GLuint region = 0;						/// Region being written.
+			GLuint cursor = 0;						/// Next free draw in the region.
+			GLuint flushed = 0;						/// First draw that has not been uploaded.
+			bool persistent = false;				/// Whether the buffer is persistently mapped.
+			DrawData *mapped = nullptr;				/// Start of the mapped buffer.
+			GLsync fences[regions] = {};			/// Fences guarding each region.
+			std::vector<DrawData> staging;			/// Data waiting to be uploaded in the fallback.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_STREAMBUFFER_H_
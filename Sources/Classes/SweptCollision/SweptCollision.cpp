@@ -0,0 +1,119 @@
+/**
+ * @file SweptCollision.cpp
+ * @brief SweptCollision class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+
+#include "SweptCollision.h"
+
+#include <math.h>
+#include <stddef.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "glm/glm.hpp"
+
+#include "Classes/Broadphase/Broadphase.h"
+#include "Structs/BoundingBox/BoundingBox.h"
+
+namespace aladdin_3d {
+
+	SweptCollision::SweptCollision() {
+
+	}
+
+	SweptCollision::SweptCollision(float velocity, float jump_velocity, float gravity, float clearance, double cooldown) {
+
+		this->velocity = velocity;
+		this->jump_velocity = jump_velocity;
+		this->gravity = gravity;
+		this->cooldown = cooldown;
+		this->apex = -this->jump_velocity * this->jump_velocity / (2.0 * this->gravity);
+
+		// The feet are above the clearance between both roots of the parabola.
+		double discriminant = this->jump_velocity * this->jump_velocity + 2.0 * this->gravity * clearance;
+
+		if (discriminant > 0.0) {
+
+			this->rise = (-this->jump_velocity + sqrt(discriminant)) / this->gravity;
+			this->fall = (-this->jump_velocity - sqrt(discriminant)) / this->gravity;
+
+		}
+
+	}
+
+	bool SweptCollision::findHit(const Broadphase &broadphase, size_t proxy, double start, double end, double jump_start,
+		double last_hit, double *time) const {
+
+		bool found = false;
+		const std::vector<size_t> &contacts = broadphase.getContacts(proxy);
+
+		for (size_t i = 0; i < contacts.size(); i++) {
+
+			size_t other = contacts[i];
+
+			if (broadphase.getLayer(other) != Broadphase::obstacle)
+				continue;
+
+			// Keep the earliest of every obstacle the character went through.
+			double hit = 0.0;
+
+			if (this->findHit(broadphase.getBounds(other), start, end, jump_start, last_hit, &hit) && (!found || hit < *time)) {
+
+				*time = hit;
+				found = true;
+
+			}
+
+		}
+
+		return found;
+
+	}
+
+	bool SweptCollision::findHit(const BoundingBox &obstacle, double start, double end, double jump_start, double last_hit,
+		double *time) const {
+
+		if (this->velocity <= 0.0)
+			return false;
+
+		// The feet are over the obstacle between these two moments.
+		double first = std::max(std::max(start, last_hit + this->cooldown), obstacle.min.z / this->velocity);
+		double last = std::min(end, obstacle.max.z / this->velocity);
+
+		// Skip the part of the jump where the feet clear it.
+		if (jump_start >= 0.0 && first >= jump_start + this->rise && first <= jump_start + this->fall)
+			first = jump_start + this->fall;
+
+		if (first >= last)
+			return false;
+
+		*time = first;
+
+		return true;
+
+	}
+
+	BoundingBox SweptCollision::getSweptBounds(const BoundingBox &character, double start, double end) const {
+
+		BoundingBox bounds;
+		bounds.min = glm::vec3(character.min.x, character.min.y, (float)(this->velocity * start));
+		bounds.max = glm::vec3(character.max.x, character.max.y + (float)this->apex, (float)(this->velocity * end));
+
+		return bounds;
+
+	}
+
+}  // namespace aladdin_3d
@@ -0,0 +1,128 @@
+/**
+ * @file SweptCollision.h
+ * @brief SweptCollision class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_SWEPTCOLLISION_H_
+#define ALADDIN_3D_CLASSES_SWEPTCOLLISION_H_
+
+#include <stddef.h>
+
+#include "Classes/Broadphase/Broadphase.h"
+#include "Structs/BoundingBox/BoundingBox.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of a SweptCollision class.
+	 *
+	 * Finds when the running character hits an obstacle during a tick, following its
+	 * motion over the whole tick instead of looking at where it ends. The character
+	 * runs at a constant speed and jumps on a parabola, so the moments its feet are
+	 * over an obstacle and too low to clear it are found analytically, and the hits do
+	 * not depend on the length of the ticks.
+	 *
+	 * A hit happens while the feet are strictly inside the obstacle along Z and below
+	 * the clearance height, once the cooldown since the last hit is over.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class SweptCollision {
+
+		public:
+
+			/**
+			 * @brief SweptCollision constructor.
+			 *
+			 * Builds a collision test that never finds anything.
+			 */
+			SweptCollision();
+
+			/**
+			 * @brief SweptCollision constructor.
+			 *
+			 * Builds the collision test of a character.
+			 *
+			 * @param velocity The running speed of the character.
+			 * @param jump_velocity The initial vertical speed of the jumps.
+			 * @param gravity The vertical acceleration, negative.
+			 * @param clearance The height the feet need to clear the obstacles.
+			 * @param cooldown The time after a hit when the character cannot be hit again.
+			 */
+			SweptCollision(float velocity, float jump_velocity, float gravity, float clearance, double cooldown);
+
+			/**
+			 * @brief Finds the first hit of a tick.
+			 *
+			 * Finds the first moment of a tick when the character hits any of the
+			 * obstacles the broadphase found in contact with its proxy.
+			 *
+			 * @param broadphase The broadphase, updated with the swept bounds of the tick.
+			 * @param proxy The proxy of the character.
+			 * @param start The time at the start of the tick.
+			 * @param end The time at the end of the tick.
+			 * @param jump_start The time the current jump started, or a negative value.
+			 * @param last_hit The time of the last hit.
+			 * @param time Outputs the time of the hit.
+			 *
+			 * @returns True if there is a hit in the tick.
+			 */
+			bool findHit(const Broadphase &broadphase, size_t proxy, double start, double end, double jump_start,
+				double last_hit, double *time) const;
+
+			/**
+			 * @brief Gets the bounds swept in a tick.
+			 *
+			 * Gets the bounds covered by the character during a tick. Along Z they take
+			 * the line of its feet, and up they take the highest a jump can go.
+			 *
+			 * @param character The bounds of the character standing at the origin.
+			 * @param start The time at the start of the tick.
+			 * @param end The time at the end of the tick.
+			 *
+			 * @returns The swept bounds.
+			 */
+			BoundingBox getSweptBounds(const BoundingBox &character, double start, double end) const;
+
+		private:
+
+			/**
+			 * @brief Finds the hit with an obstacle.
+			 *
+			 * Finds the first moment of a tick when the character hits an obstacle.
+			 *
+			 * @param obstacle The bounds of the obstacle.
+			 * @param start The time at the start of the tick.
+			 * @param end The time at the end of the tick.
+			 * @param jump_start The time the current jump started, or a negative value.
+			 * @param last_hit The time of the last hit.
+			 * @param time Outputs the time of the hit.
+			 *
+			 * @returns True if there is a hit in the tick.
+			 */
+			bool findHit(const BoundingBox &obstacle, double start, double end, double jump_start, double last_hit,
+				double *time) const;
+
+			double velocity = 0.0;			/// Running speed of the character.
+			double jump_velocity = 0.0;		/// Initial vertical speed of the jumps.
+			double gravity = 0.0;			/// Vertical acceleration.
+			double cooldown = 0.0;			/// Time after a hit when nothing else hits.
+			double rise = 0.0;				/// Time from the start of a jump until the feet clear the obstacles.
+			double fall = 0.0;				/// Time from the start of a jump until the feet are too low again.
+			double apex = 0.0;				/// Highest the feet go in a jump.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_SWEPTCOLLISION_H_
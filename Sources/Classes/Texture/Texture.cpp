@@ -22,12 +22,17 @@
 #include "glew/glew.h"
 #include "stb/stb_image.h"
 
+#include "Classes/GLHandle/GLHandle.h"
+#include "Classes/ResourceTracker/ResourceTracker.h"
+
 namespace aladdin_3d {
 
 	Texture::Texture(const char* image, const char* name, GLuint slot) {
 
 		// Generate a texture in OpenGL and store the parameters in the attributes.
-		glGenTextures(1, &this->ID);
+		GLuint texture_name = 0;
+		glGenTextures(1, &texture_name);
+		this->ID = GLHandle(texture_name, ResourceTracker::textures);
 		this->name = std::string(name);
 		this->slot = slot;
 
@@ -41,7 +46,7 @@ namespace aladdin_3d {
 
 		// Set the slot for the texture.
 		glActiveTexture(GL_TEXTURE0 + slot);
-		glBindTexture(GL_TEXTURE_2D, this->ID);
+		glBindTexture(GL_TEXTURE_2D, texture_name);
 
 		// Configure the magnifying algorithm, minifying algorithm and repetition.
 		// This tells OpenGL how to apply intrpolation.
@@ -66,6 +71,7 @@ namespace aladdin_3d {
 		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, this->texture_width, this->texture_height,
 				0, color_model, GL_UNSIGNED_BYTE, image_bytes);
 		glGenerateMipmap(GL_TEXTURE_2D);
+		this->ID.setBytes(this->getGPUBytes());
 
 		// Clean the memory.
 		stbi_image_free(image_bytes);
@@ -77,7 +83,7 @@ namespace aladdin_3d {
 
 	GLuint Texture::getID() {
 
-		return this->ID;
+		return this->ID.get();
 
 	}
 
@@ -105,23 +111,32 @@ namespace aladdin_3d {
 
 	}
 
-	std::string Texture::getName() {
+	const std::string &Texture::getName() {
 
 		return this->name;
 
 	}
 
+	size_t Texture::getGPUBytes() {
+
+		// The mipmaps add up to a third of the base level.
+		size_t base = (size_t)this->texture_width * this->texture_height * 4;
+
+		return base + base / 3;
+
+	}
+
 	void Texture::bind() {
 
 		// Activate the texture and bind it.
 		glActiveTexture(GL_TEXTURE0 + this->slot);
-		glBindTexture(GL_TEXTURE_2D, this->ID);
+		glBindTexture(GL_TEXTURE_2D, this->ID.get());
 
 	}
 
 	void Texture::remove() {
 
-		glDeleteTextures(1, &this->ID);
+		this->ID.reset();
 
 	}
 
@@ -20,13 +20,17 @@
 
 #include "glew/glew.h"
 
+#include "Classes/GLHandle/GLHandle.h"
+
 namespace aladdin_3d {
 
 	/**
 	 * @brief Implements a texture class to handle object textures.
 	 * 
 	 * Implements a texture object to handle textures and their content to use
-	 * with the objects.
+	 * with the objects. It owns its OpenGL object, so it can be moved but not
+	 * copied, and frees it when it is destroyed. Textures used by several meshes
+	 * are shared through a std::shared_ptr.
 	 * 
 	 * @author Borja Garca Quiroga <garcaqub@tcd.ie>
 	 */
@@ -45,6 +49,11 @@ namespace aladdin_3d {
 			 */
 			Texture(const char* image, const char* type, GLuint slot);
 
+			Texture(Texture&&) = default;
+			Texture &operator=(Texture&&) = default;
+			Texture(const Texture&) = delete;
+			Texture &operator=(const Texture&) = delete;
+
 			/**
 			 * @brief Get the ID of the texture.
 			 * 
@@ -97,7 +106,16 @@ namespace aladdin_3d {
 			 * 
 			 * @returns A char string containing the name name of the texture.
 			 */
-			std::string getName();
+			const std::string &getName();
+
+			/**
+			 * @brief Gets the memory used on the GPU.
+			 *
+			 * Gets the bytes of the image and its mipmaps, which are stored as RGBA.
+			 *
+			 * @returns The number of bytes.
+			 */
+			size_t getGPUBytes();
 
 			/**
 			 * @brief Binds the texture.
@@ -109,7 +127,7 @@ namespace aladdin_3d {
 			/**
 			 * @brief Removes the texture from OpenGL.
 			 *
-			 *  Removes the texture from OpenGL.
+			 * Removes the texture from OpenGL. It does nothing if it was already removed.
 			 */
 			void remove();
 
@@ -122,7 +140,7 @@ namespace aladdin_3d {
 
 		private:
 
-			GLuint ID;					/// Texture OpenGL ID.
+			GLHandle ID;				/// Texture OpenGL ID.
 			GLuint slot;				/// Stores the texture slot number.
 			int texture_width = 0;		/// Width of the texture in pixels.
 			int texture_height = 0;		/// Height of the texture in pixels.
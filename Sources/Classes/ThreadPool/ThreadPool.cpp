@@ -0,0 +1,160 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief ThreadPool class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace aladdin_3d {
+
+	size_t ThreadPool::getWorkerCount() {
+
+		return this->threads.size();
+
+	}
+
+	void ThreadPool::run(size_t jobs, const std::function<void(size_t)> &job) {
+
+		// Run it here if there is nobody to help.
+		if (this->threads.empty() || jobs <= 1) {
+
+			for (size_t i = 0; i < jobs; i++)
+				job(i);
+
+			return;
+
+		}
+
+		// Publish the loop and wake up the workers.
+		{
+
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->job = &job;
+			this->job_count = jobs;
+			this->next_job = 0;
+			this->finished = 0;
+			this->generation++;
+
+		}
+
+		this->wake.notify_all();
+
+		// Help with the jobs.
+		this->runJobs();
+
+		// Wait until every job is done and no worker is still looking at this loop.
+		std::unique_lock<std::mutex> lock(this->mutex);
+		this->done.wait(lock, [this] { return this->finished == this->job_count && this->active == 0; });
+		this->job = nullptr;
+
+	}
+
+	void ThreadPool::runJobs() {
+
+		// Take jobs until there are none left.
+		size_t count = 0;
+		size_t index = this->next_job.fetch_add(1);
+
+		while (index < this->job_count) {
+
+			(*this->job)(index);
+			count++;
+			index = this->next_job.fetch_add(1);
+
+		}
+
+		// Report the finished jobs.
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->finished += count;
+
+		if (this->finished == this->job_count)
+			this->done.notify_all();
+
+	}
+
+	void ThreadPool::start(size_t workers) {
+
+		this->stopping = false;
+
+		for (size_t i = 0; i < workers; i++)
+			this->threads.push_back(std::thread(&ThreadPool::work, this));
+
+	}
+
+	void ThreadPool::stop() {
+
+		// Tell the workers to exit.
+		{
+
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->stopping = true;
+
+		}
+
+		this->wake.notify_all();
+
+		// Wait for them.
+		for (size_t i = 0; i < this->threads.size(); i++)
+			this->threads[i].join();
+
+		this->threads.clear();
+
+	}
+
+	void ThreadPool::work() {
+
+		size_t seen = 0;
+
+		while (true) {
+
+			// Sleep until there is a new loop or the pool stops.
+			{
+
+				std::unique_lock<std::mutex> lock(this->mutex);
+				this->wake.wait(lock, [&] { return this->stopping || this->generation != seen; });
+
+				if (this->stopping)
+					return;
+
+				seen = this->generation;
+
+				// The loop may be over already.
+				if (this->job == nullptr)
+					continue;
+
+				this->active++;
+
+			}
+
+			// Help with the jobs.
+			this->runJobs();
+
+			// Leave the loop.
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->active--;
+
+			if (this->active == 0)
+				this->done.notify_all();
+
+		}
+
+	}
+
+}  // namespace aladdin_3d
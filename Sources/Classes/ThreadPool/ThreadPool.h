@@ -0,0 +1,109 @@
+/**
+ * @file ThreadPool.h
+ * @brief ThreadPool class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_THREADPOOL_H_
+#define ALADDIN_3D_CLASSES_THREADPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of a ThreadPool class.
+	 *
+	 * Implementation of a pool of worker threads that run parallel loops. The workers
+	 * sleep between loops, and the calling thread takes part in every loop so a pool
+	 * without workers simply runs the loop serially.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class ThreadPool {
+
+		public:
+
+			/**
+			 * @brief Get the number of workers.
+			 *
+			 * Get the number of worker threads, not counting the calling thread.
+			 *
+			 * @returns The number of workers.
+			 */
+			size_t getWorkerCount();
+
+			/**
+			 * @brief Runs a parallel loop.
+			 *
+			 * Runs a job once for every index in [0, jobs) across the workers and the
+			 * calling thread, and returns when all of them are done.
+			 *
+			 * @param jobs The number of jobs.
+			 * @param job The job to run, which receives the index of the job.
+			 */
+			void run(size_t jobs, const std::function<void(size_t)> &job);
+
+			/**
+			 * @brief Starts the workers.
+			 *
+			 * Starts the worker threads.
+			 *
+			 * @param workers The number of worker threads.
+			 */
+			void start(size_t workers);
+
+			/**
+			 * @brief Stops the workers.
+			 *
+			 * Wakes up the worker threads and waits for them to finish.
+			 */
+			void stop();
+
+		private:
+
+			/**
+			 * @brief Runs jobs until there are none left.
+			 *
+			 * Takes jobs of the current loop until there are none left.
+			 */
+			void runJobs();
+
+			/**
+			 * @brief Main function of the workers.
+			 *
+			 * Waits for loops and helps running them until the pool is stopped.
+			 */
+			void work();
+
+			std::vector<std::thread> threads;				/// Worker threads.
+			std::mutex mutex;								/// Guards the state of the current loop.
+			std::condition_variable wake;					/// Wakes up the workers when a loop starts.
+			std::condition_variable done;					/// Wakes up the caller when a loop ends.
+			const std::function<void(size_t)> *job = nullptr;	/// Job of the current loop.
+			size_t job_count = 0;							/// Number of jobs in the current loop.
+			std::atomic<size_t> next_job{0};				/// Next job to take.
+			size_t finished = 0;							/// Number of finished jobs.
+			size_t active = 0;								/// Number of workers inside the current loop.
+			size_t generation = 0;							/// Number of loops started.
+			bool stopping = false;							/// Whether the workers have to exit.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_THREADPOOL_H_
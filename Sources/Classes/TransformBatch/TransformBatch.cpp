@@ -0,0 +1,111 @@
+/**
+ * @file TransformBatch.cpp
+ * @brief TransformBatch class implementation file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "TransformBatch.h"
+
+#include <vector>
+
+#include "glew/glew.h"
+#include "glm/glm.hpp"
+
+#include "Classes/BatchMaths/BatchMaths.h"
+#include "Classes/StreamBuffer/StreamBuffer.h"
+#include "Structs/DrawData/DrawData.h"
+
+namespace aladdin_3d {
+
+	void TransformBatch::add(const glm::mat4 *model, const glm::mat4 *normal, GLint *draw_index) {
+
+		this->models.push_back(model);
+		this->normals.push_back(normal);
+		this->draw_indices.push_back(draw_index);
+
+	}
+
+	void TransformBatch::clear() {
+
+		this->models.clear();
+		this->normals.clear();
+		this->draw_indices.clear();
+
+	}
+
+	void TransformBatch::compute(const glm::mat4 &view, StreamBuffer &stream) {
+
+		// Nothing to do for an empty batch.
+		if (this->models.empty())
+			return;
+
+		// Reserve room for the whole batch and write the data in place.
+		GLint first = 0;
+		DrawData *out = stream.reserve(this->models.size(), &first);
+		TransformBatch::transform(view, this->models.data(), this->normals.data(), out, this->models.size());
+
+		// Tell every draw where its data is.
+		for (size_t i = 0; i < this->draw_indices.size(); i++)
+			*this->draw_indices[i] = first + (GLint)i;
+
+	}
+
+	void TransformBatch::reserve(size_t draws) {
+
+		this->models.reserve(draws);
+		this->normals.reserve(draws);
+		this->draw_indices.reserve(draws);
+
+	}
+
+	size_t TransformBatch::size() {
+
+		return this->models.size();
+
+	}
+
+	void TransformBatch::transform(const glm::mat4 &view, const glm::mat4 *const *models,
+		const glm::mat4 *const *normals, DrawData *out, size_t count) {
+
+		// The normals only need the rotation of the view, whose inverse transpose is itself.
+		glm::mat4 view_rotation = view;
+		view_rotation[3] = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+
+		// The kernels read packed matrices, so gather the draws a few at a time. The
+		// products go straight into the per-draw data.
+		const size_t chunk = 32;
+		const size_t stride = sizeof(DrawData) / sizeof(glm::mat4);
+		glm::mat4 gathered_models[chunk];
+		glm::mat4 gathered_normals[chunk];
+
+		for (size_t first = 0; first < count; first += chunk) {
+
+			size_t size = count - first < chunk ? count - first : chunk;
+
+			for (size_t i = 0; i < size; i++) {
+
+				gathered_models[i] = *models[first + i];
+				gathered_normals[i] = *normals[first + i];
+
+			}
+
+			BatchMaths::multiply(view, gathered_models, &out[first].model_view, size, stride);
+			BatchMaths::multiply(view_rotation, gathered_normals, &out[first].normal_matrix, size, stride);
+
+			for (size_t i = 0; i < size; i++)
+				out[first + i].model = gathered_models[i];
+
+		}
+
+	}
+
+}  // namespace aladdin_3d
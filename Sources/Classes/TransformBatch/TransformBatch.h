@@ -0,0 +1,116 @@
+/**
+ * @file TransformBatch.h
+ * @brief TransformBatch class header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_CLASSES_TRANSFORMBATCH_H_
+#define ALADDIN_3D_CLASSES_TRANSFORMBATCH_H_
+
+#include <vector>
+
+#include "glew/glew.h"
+#include "glm/glm.hpp"
+
+#include "Classes/StreamBuffer/StreamBuffer.h"
+#include "Structs/DrawData/DrawData.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief Implementation of a TransformBatch class.
+	 *
+	 * Collects the cached world matrices of every visible geometry in a frame and
+	 * computes all the view-dependent products in a single pass, straight into the
+	 * stream buffer. The products go through the batch maths kernels, with the best
+	 * instruction set the CPU supports.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class TransformBatch {
+
+		public:
+
+			/**
+			 * @brief Adds a draw to the batch.
+			 *
+			 * Adds a draw to the batch. The matrices are read, and the draw index written,
+			 * when the batch is computed, so they must outlive the call to compute.
+			 *
+			 * @param model The world matrix of the draw.
+			 * @param normal The world normal matrix of the draw.
+			 * @param draw_index Where the index of the draw in the stream buffer will be written.
+			 */
+			void add(const glm::mat4 *model, const glm::mat4 *normal, GLint *draw_index);
+
+			/**
+			 * @brief Removes all the draws.
+			 *
+			 * Removes all the draws from the batch, keeping the memory for the next frame.
+			 */
+			void clear();
+
+			/**
+			 * @brief Computes the per-draw data of the batch.
+			 *
+			 * Computes the per-draw data of all the draws in the batch and writes it to
+			 * the stream buffer.
+			 *
+			 * @param view The view matrix of the current camera.
+			 * @param stream The stream buffer of the current frame.
+			 */
+			void compute(const glm::mat4 &view, StreamBuffer &stream);
+
+			/**
+			 * @brief Reserves memory for a number of draws.
+			 *
+			 * Reserves memory for a number of draws, so that adding them never allocates.
+			 *
+			 * @param draws The number of draws.
+			 */
+			void reserve(size_t draws);
+
+			/**
+			 * @brief Get the number of draws in the batch.
+			 *
+			 * Get the number of draws in the batch.
+			 *
+			 * @returns The number of draws in the batch.
+			 */
+			size_t size();
+
+			/**
+			 * @brief Computes the per-draw data of a set of draws.
+			 *
+			 * Computes the modelView and view-space normal matrix of every draw. The
+			 * view matrix is expected to be rigid, as the ones built by the camera are.
+			 *
+			 * @param view The view matrix of the current camera.
+			 * @param models The world matrices of the draws.
+			 * @param normals The world normal matrices of the draws.
+			 * @param out Where the per-draw data will be written.
+			 * @param count The number of draws.
+			 */
+			static void transform(const glm::mat4 &view, const glm::mat4 *const *models,
+				const glm::mat4 *const *normals, DrawData *out, size_t count);
+
+		private:
+
+			std::vector<const glm::mat4*> models;	/// World matrices of the draws.
+			std::vector<const glm::mat4*> normals;	/// World normal matrices of the draws.
+			std::vector<GLint*> draw_indices;		/// Where the draw indices go.
+
+	};
+
+}  // namespace aladdin_3d
+
+#endif  //!ALADDIN_3D_CLASSES_TRANSFORMBATCH_H_
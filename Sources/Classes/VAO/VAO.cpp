@@ -17,6 +17,8 @@
 
 #include "glew/glew.h"
 
+#include "Classes/GLHandle/GLHandle.h"
+#include "Classes/ResourceTracker/ResourceTracker.h"
 #include "Classes/VBO/VBO.h"
 
 namespace aladdin_3d {
@@ -24,15 +26,16 @@ namespace aladdin_3d {
 	VAO::VAO() {
 
 		// Generate the buffer.
-		glGenVertexArrays(1, &this->ID);
-		glBindBuffer(GL_ARRAY_BUFFER, this->ID);
+		GLuint name = 0;
+		glGenVertexArrays(1, &name);
+		this->ID = GLHandle(name, ResourceTracker::vertex_arrays);
 
 	}
 
 	void VAO::bind() {
 
 		// Bind the VAO.
-		glBindVertexArray(this->ID);
+		glBindVertexArray(this->ID.get());
 
 	}
 
@@ -54,7 +57,7 @@ namespace aladdin_3d {
 	void VAO::remove() {
 
 		// Deletes the VAO from the GL pipe.
-		glDeleteVertexArrays(1, &this->ID);
+		this->ID.reset();
 
 	}
 
@@ -18,6 +18,7 @@
 
 #include "glew/glew.h"
 
+#include "Classes/GLHandle/GLHandle.h"
 #include "Classes/VBO/VBO.h"
 
 namespace aladdin_3d {
@@ -26,7 +27,8 @@ namespace aladdin_3d {
 	 * @brief Implementation of a VAO class.
 	 *
 	 * Implementation of a VAO class that will allow us to bind it to the
-	 * OpenGL pipe, destroy it or deactivate it.
+	 * OpenGL pipe, destroy it or deactivate it. It owns its OpenGL object, so it
+	 * can be moved but not copied, and frees it when it is destroyed.
 	 *
 	 * @author Borja García Quiroga <garcaqub@tcd.ie>
 	 */
@@ -41,6 +43,11 @@ namespace aladdin_3d {
 		 */
 		VAO();
 
+		VAO(VAO&&) = default;
+		VAO &operator=(VAO&&) = default;
+		VAO(const VAO&) = delete;
+		VAO &operator=(const VAO&) = delete;
+
 		/**
 		 * @brief Binds the VBO.
 		 *
@@ -66,7 +73,7 @@ namespace aladdin_3d {
 		/**
 		 * @brief Remove the VAO.
 		 *
-		 * Removes the VAO in GL.
+		 * Removes the VAO in GL. It does nothing if it was already removed.
 		 */
 		void remove();
 
@@ -79,7 +86,7 @@ namespace aladdin_3d {
 
 	private:
 
-		GLuint ID; /// OpenGL VAO ID.
+		GLHandle ID; /// OpenGL VAO ID.
 	};
 
 }  // namespace aladdin_3d
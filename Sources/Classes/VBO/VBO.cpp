@@ -19,32 +19,52 @@
 
 #include "glew/glew.h"
 
+#include "Classes/GLHandle/GLHandle.h"
+#include "Classes/ResourceTracker/ResourceTracker.h"
+#include "Structs/SkinVertex/SkinVertex.h"
 #include "Structs/Vertex/Vertex.h"
 
 namespace aladdin_3d {
 
+	VBO::VBO() {}
+
 	VBO::VBO(const std::vector<Vertex> &vertices) {
 
 		// Generate the buffer.
-		glGenBuffers(1, &this->ID);
-		glBindBuffer(GL_ARRAY_BUFFER, this->ID);
+		GLuint name = 0;
+		glGenBuffers(1, &name);
+		this->ID = GLHandle(name, ResourceTracker::buffers, vertices.size() * sizeof(Vertex));
+		glBindBuffer(GL_ARRAY_BUFFER, name);
 
 		// Link the vertices.
 		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STATIC_DRAW);
 
 	}
 
+	VBO::VBO(const std::vector<SkinVertex> &skin) {
+
+		// Generate the buffer.
+		GLuint name = 0;
+		glGenBuffers(1, &name);
+		this->ID = GLHandle(name, ResourceTracker::buffers, skin.size() * sizeof(SkinVertex));
+		glBindBuffer(GL_ARRAY_BUFFER, name);
+
+		// Link the skinning attributes.
+		glBufferData(GL_ARRAY_BUFFER, skin.size() * sizeof(SkinVertex), skin.data(), GL_STATIC_DRAW);
+
+	}
+
 	void VBO::bind() {
 
 		// Bind the VBO.
-		glBindBuffer(GL_ARRAY_BUFFER, this->ID);
+		glBindBuffer(GL_ARRAY_BUFFER, this->ID.get());
 
 	}
 
 	void VBO::remove() {
 
 		// Delete the buffer in OpenGL.
-		glDeleteBuffers(1, &this->ID);
+		this->ID.reset();
 
 	}
 
@@ -20,6 +20,8 @@
 
 #include "glew/glew.h"
 
+#include "Classes/GLHandle/GLHandle.h"
+#include "Structs/SkinVertex/SkinVertex.h"
 #include "Structs/Vertex/Vertex.h"
 
 namespace aladdin_3d {
@@ -28,7 +30,8 @@ namespace aladdin_3d {
 	 * @brief Implementation of a VBO class.
 	 *
 	 * Implementation of a VBO class that will allow us to bind it to the
-	 * OpenGL pipe, destroy it or deactivate it.
+	 * OpenGL pipe, destroy it or deactivate it. It owns its OpenGL object, so it
+	 * can be moved but not copied, and frees it when it is destroyed.
 	 *
 	 * @author Borja García Quiroga <garcaqub@tcd.ie>
 	 */
@@ -36,6 +39,13 @@ namespace aladdin_3d {
 
 	public:
 
+		/**
+		 * @brief Constructs an empty Vertex Buffer Object.
+		 *
+		 * Constructs a Vertex Buffer Object that owns no buffer.
+		 */
+		VBO();
+
 		/**
 		 * @brief Constructs a Vertex Buffer Object.
 		 *
@@ -45,6 +55,20 @@ namespace aladdin_3d {
 		 */
 		VBO(const std::vector<Vertex> &vertices);
 
+		/**
+		 * @brief Constructs a skinning Vertex Buffer Object.
+		 *
+		 * Constructs a Vertex Buffer Object and links the skinning attributes of some vertices.
+		 *
+		 * @param skin Skinning attributes that will be linked.
+		 */
+		VBO(const std::vector<SkinVertex> &skin);
+
+		VBO(VBO&&) = default;
+		VBO &operator=(VBO&&) = default;
+		VBO(const VBO&) = delete;
+		VBO &operator=(const VBO&) = delete;
+
 		/**
 		 * @brief Binds the VBO.
 		 *
@@ -55,7 +79,7 @@ namespace aladdin_3d {
 		/**
 		 * @brief Removes the VBO.
 		 *
-		 * Removes the VBO from OpenGL.
+		 * Removes the VBO from OpenGL. It does nothing if it was already removed.
 		 */
 		void remove();
 
@@ -68,7 +92,7 @@ namespace aladdin_3d {
 
 	private:
 
-		GLuint ID; // GL ID of the VBO.
+		GLHandle ID; // GL ID of the VBO.
 
 	};
 
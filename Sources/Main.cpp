@@ -18,43 +18,98 @@
 #include <math.h>
 
 #include <algorithm>
+#include <cassert>
 #include <chrono>
+#include <iomanip>
 #include <iostream>
+#include <memory>
 #include <random>
+#include <thread>
 #include <vector>
 
 #include "glew/glew.h"
 #include "freeglut/freeglut.h"
 #include <glm/gtx/string_cast.hpp>
+#include "glm/gtc/constants.hpp"
 
+#include "Classes/AllocationCounter/AllocationCounter.h"
+#include "Classes/AnimationTexture/AnimationTexture.h"
+#include "Classes/Animator/Animator.h"
+#include "Classes/Benchmark/Benchmark.h"
 #include "Classes/Camera/Camera.h"
+#include "Classes/Crowd/Crowd.h"
+#include "Classes/EntityStore/EntityStore.h"
 #include "Classes/Light/Light.h"
 #include "Classes/Object/Object.h"
+#include "Classes/ResourceTracker/ResourceTracker.h"
+#include "Classes/ScopedTimer/ScopedTimer.h"
 #include "Classes/Shader/Shader.h"
+#include "Structs/AnimationChannel/AnimationChannel.h"
+#include "Structs/AnimationClip/AnimationClip.h"
+#include "Structs/AssetMemory/AssetMemory.h"
 #include "Structs/BoundingBox/BoundingBox.h"
 
+size_t addObject(const aladdin_3d::Object &object, unsigned int shader, unsigned int object_class, unsigned int flags) {
+
+	objects.push_back(object);
+
+	// The objects do not move once placed, so their bounds and matrices are taken only once.
+	aladdin_3d::BoundingBox bounds = objects.back().getWorldBoundingBox();
+
+	// Only the objects that move with the world can be hidden behind the buildings.
+	size_t candidate = aladdin_3d::EntityStore::no_candidate;
+
+	if (flags & aladdin_3d::EntityStore::in_world)
+		candidate = occlusion_culler.addCandidate(bounds);
+
+	size_t entity = entities.add(objects.size() - 1, shader, object_class, flags, bounds, (bounds.min + bounds.max) / 2.0f, candidate);
+
+	const std::vector<aladdin_3d::Geometry> &geometries = objects.back().getGeometries();
+
+	for (size_t i = 0; i < geometries.size(); i++)
+		entities.addTransform(geometries[i].getTransforms(), geometries[i].getNormalTransforms());
+
+	return entity;
+
+}
+
 void clean() {
 
-	// Delete all the shaders.
-	for (size_t i = 0; i < shaders.size(); i++)
-		shaders[i].remove();
+	// Stop the workers.
+	thread_pool.stop();
+
+	// Report the last render mode.
+	reportRenderMode();
+
+	// Dump the profiler statistics.
+	if (profiler.getFrames() > 0) {
+
+		if (!profiler.writeCSV("profile.csv") || !profiler.writeJSON("profile.json"))
+			std::cerr << "Warning - The profiler statistics could not be written." << std::endl;
+
+	}
+
+	// Save the recorded input.
+	if (!recording_file.empty() && !input_recording.save(recording_file.c_str()))
+		std::cerr << "Warning - The input recording could not be written." << std::endl;
 
 }
 
 void createObstacles() {
 
-	// Load the box object.
+	// Load the box object. Only its bounds are needed on the CPU.
 	aladdin_3d::Object box("Models/Box/Box.gltf", "GLTF");
+	box.releaseCPUData();
 
 	// Generate the basic spaces.
 	float box_z = corridor_length - 3;
 	float box_dist = 1.0;
+	std::vector<float> box_positions;
 
 	while (box_z >= 5) {
 
 		// Append a new box position.
-		obstacles_positions.push_back(box_z);
-		obstacles_type.push_back("box");
+		box_positions.push_back(box_z);
 
 		// Calculate the new box.
 		box_z -= box_dist;
@@ -62,34 +117,42 @@ void createObstacles() {
 
 	}
 
-	// Get the bounding box.
+	// Get the bounding box, with the transforms of the model nodes.
 	aladdin_3d::BoundingBox bb = box.getBoundingBox();
 
 	// Get the object info the object.
 	glm::vec3 centre = (bb.min + bb.max) / 2.0f;
 	glm::vec3 size = bb.max - bb.min;
 
+	// The boxes are one unit wide.
+	float box_scale = 1.0f / size.x;
+
 	// Add the boxes to the scenario.
-	for (size_t i = 0; i < obstacles_positions.size(); i++) {
+	obstacles.reserve(box_positions.size());
+
+	for (size_t i = 0; i < box_positions.size(); i++) {
 
 		// Copy the original box.
 		aladdin_3d::Object box_copy = box;
 
-		// Put the box in its right position.
-		box_copy.translate(0.0f, size.y * 0.25f, obstacles_positions[i]);
+		// Put the box in its right position, resting on the floor.
+		box_copy.translate(0.0f, size.y * box_scale / 2.0f, box_positions[i]);
 
 		// Scale the box.
-		box_copy.scale(0.5f, 0.5f, 0.5f);
+		box_copy.scale(box_scale, box_scale, box_scale);
 
 		// Center the box in 0,0.
-		box_copy.translate(-centre.x, -centre.x, -centre.z);
+		box_copy.translate(-centre.x, -centre.y, -centre.z);
 
-		// Append the box.
-		objects.push_back(box_copy);
-		object_shader.push_back(0);
+		// Append the box, the character can hit it.
+		size_t entity = addObject(box_copy, 0, obstacles_class, aladdin_3d::EntityStore::in_world | aladdin_3d::EntityStore::obstacle);
+		obstacles.add(aladdin_3d::ObstacleSystem::BOX, entities.getBounds(entity), entities.getPosition(entity).z);
 
 	}
 
+	// The boxes were placed from the door backwards, the collisions need them in order.
+	obstacles.sort();
+
 }
 
 void createFloor() {
@@ -139,17 +202,18 @@ void createFloor() {
 	std::vector<GLuint> indices{0, 1, 2, 3, 4, 5};
 
 	// Create the textures.
-	aladdin_3d::Texture base_texture("Textures/sand.png", "baseColor", 0);
-	aladdin_3d::Texture specular_map("Textures/black.png", "specularMap", 1);
-	std::vector<aladdin_3d::Texture> textures{base_texture, specular_map};
+	auto base_texture = std::make_shared<aladdin_3d::Texture>("Textures/sand.png", "baseColor", 0);
+	auto specular_map = std::make_shared<aladdin_3d::Texture>("Textures/black.png", "specularMap", 1);
+	std::vector<std::shared_ptr<aladdin_3d::Texture>> textures{base_texture, specular_map};
 
 	// Create the geometry.
 	aladdin_3d::Geometry floor_geom(vertices, indices, textures);
 	aladdin_3d::Object floor(std::vector<aladdin_3d::Geometry>{floor_geom});
+	floor.setName("Floor");
+	floor.releaseCPUData();
 
 	// Add the objects to the list.
-	objects.push_back(floor);
-	object_shader.push_back(0);
+	addObject(floor, 0, floor_class, aladdin_3d::EntityStore::in_world);
 
 }
 
@@ -200,17 +264,103 @@ void createLives() {
 	std::vector<GLuint> indices{ 0, 1, 2, 3, 4, 5 };
 
 	// Create the textures.
-	aladdin_3d::Texture base_texture("Textures/hearts.png", "baseColor", 0);
-	aladdin_3d::Texture specular_map("Textures/black.png", "specularMap", 1);
-	std::vector<aladdin_3d::Texture> textures{ base_texture, specular_map };
+	auto base_texture = std::make_shared<aladdin_3d::Texture>("Textures/hearts.png", "baseColor", 0);
+	auto specular_map = std::make_shared<aladdin_3d::Texture>("Textures/black.png", "specularMap", 1);
+	std::vector<std::shared_ptr<aladdin_3d::Texture>> textures{ base_texture, specular_map };
 
 	// Create the geometry.
 	aladdin_3d::Geometry lives_geom(vertices, indices, textures);
 	aladdin_3d::Object lives_obj(std::vector<aladdin_3d::Geometry>{lives_geom});
+	lives_obj.setName("Lives");
+	lives_obj.releaseCPUData();
 
 	// Add the objects to the list.
-	objects.push_back(lives_obj);
-	object_shader.push_back(2);
+	addObject(lives_obj, 2, hud_class, 0);
+
+}
+
+void buildBroadphase() {
+
+	broadphase.clear();
+	broadphase.reserve(obstacles.size() + 1);
+
+	// The obstacles never move, they only stop the characters and the guards.
+	for (size_t i = 0; i < obstacles.size(); i++)
+		broadphase.add(obstacles.getBounds(i), aladdin_3d::Broadphase::obstacle, aladdin_3d::Broadphase::character | aladdin_3d::Broadphase::guard);
+
+	// The character is moved to where it runs on every tick.
+	character_bounds = characters[0].getWorldBoundingBox();
+	character_proxy = broadphase.add(character_bounds, aladdin_3d::Broadphase::character,
+		aladdin_3d::Broadphase::obstacle | aladdin_3d::Broadphase::pickup | aladdin_3d::Broadphase::guard);
+
+	// The hits of the character are followed along its whole run and jump.
+	swept_collision = aladdin_3d::SweptCollision(velocity, jump_velocity, gravity, jump_clearance, hit_cooldown);
+
+}
+
+void buildFlowField() {
+
+	flow_field = aladdin_3d::FlowField(glm::vec2(-corridor_width / 2.0f, 0.0f), glm::vec2(corridor_width / 2.0f, corridor_length),
+		flow_cell_size, flow_segment_length);
+
+	for (size_t i = 0; i < entities.size(); i++) {
+
+		if (entities.getFlags(i) & aladdin_3d::EntityStore::obstacle)
+			flow_field.addObstacle(entities.getBounds(i), guard_radius);
+
+	}
+
+	flow_field.build(thread_pool);
+
+}
+
+aladdin_3d::AnimationClip createRunCycle(aladdin_3d::Object &character, const glm::vec3 &hip) {
+
+	// The legs do a whole swing back and forth in every cycle.
+	const float frequency = 6.0f;
+	const float max_angle = 45.0f;
+	const int keys = 32;
+
+	aladdin_3d::AnimationClip clip;
+	clip.name = "Run";
+	clip.duration = 2.0f * glm::pi<float>() / frequency;
+
+	for (int j = 1; j <= 2; j++) {
+
+		glm::vec3 rest_translation;
+		glm::quat rest_rotation;
+		glm::vec3 rest_scale;
+		character.getTransforms(j, &rest_translation, &rest_rotation, &rest_scale);
+
+		aladdin_3d::AnimationChannel translation;
+		translation.node = character.getGeometryNode(j);
+		translation.path = aladdin_3d::Animator::translation;
+
+		aladdin_3d::AnimationChannel rotation = translation;
+		rotation.path = aladdin_3d::Animator::rotation;
+
+		// The character is turned 90 degrees, so in its coordinates the legs swing around Z.
+		for (int k = 0; k <= keys; k++) {
+
+			float time = clip.duration * k / keys;
+			float angle = sin(time * frequency) * max_angle;
+			float swing = j == 1 ? -angle : angle;
+			glm::quat turn = glm::angleAxis(glm::radians(swing), glm::vec3(0.0f, 0.0f, -1.0f));
+			glm::quat key = turn * rest_rotation;
+
+			translation.times.push_back(time);
+			translation.values.push_back(glm::vec4(hip - turn * hip + turn * rest_translation, 0.0f));
+			rotation.times.push_back(time);
+			rotation.values.push_back(glm::vec4(key.x, key.y, key.z, key.w));
+
+		}
+
+		clip.channels.push_back(translation);
+		clip.channels.push_back(rotation);
+
+	}
+
+	return clip;
 
 }
 
@@ -222,45 +372,219 @@ void display() {
 	// Clean the back buffer and depth buffer
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-	// Get the real current time.
-	auto current_time = std::chrono::system_clock::now();
-	double real_time = std::chrono::duration<double>(current_time.time_since_epoch()).count();
+	// Measure the frame.
+	frame_statistics.beginFrame();
+	profiler.beginFrame();
 
-	// Control time if the game is paused.
-	if (is_paused)
-		time_start = real_time - internal_time;
+	// Handle the input the simulation thread handed back.
+	applyInput();
 
-	// Transformthis into the internal time.
-	internal_time = real_time - time_start;
+	double alpha = 0.0;
+
+	if (fixed_timestep > 0.0) {
+
+		// Ask for the ticks of a fixed step and wait for them, so that the runs are reproducible.
+		profiler.beginCPU("Simulation");
+
+		unsigned long ticks = requested_ticks.load(std::memory_order_relaxed);
+		accumulator += fixed_timestep;
+
+		// The tolerance keeps frames that are a multiple of the tick from losing one to rounding.
+		while (accumulator >= simulation_timestep - 1e-9) {
+
+			ticks++;
+			accumulator -= simulation_timestep;
+
+		}
+
+		requested_ticks.store(ticks, std::memory_order_release);
+
+		state_buffer.read(simulation_state);
+		while (simulation_state.tick < ticks) {
+
+			std::this_thread::yield();
+			state_buffer.read(simulation_state);
+
+		}
+
+		profiler.endCPU("Simulation");
+
+		alpha = accumulator / simulation_timestep;
+
+	} else {
+
+		// Take the latest tick and see how far the real time went past it.
+		state_buffer.read(simulation_state);
+
+		auto current_time = std::chrono::steady_clock::now();
+		double real_time = std::chrono::duration<double>(current_time.time_since_epoch()).count();
+		alpha = (real_time - simulation_state.real_time) / simulation_timestep;
+
+	}
+
+	// Render between the last two ticks.
+	alpha = glm::clamp(alpha, 0.0, 1.0);
+	internal_time = simulation_state.previous_time + (simulation_state.time - simulation_state.previous_time) * alpha;
 
 	// Get the current camera;
-	aladdin_3d::Camera camera = cameras[current_camera];
+	aladdin_3d::Camera &camera = cameras[current_camera];
 	
 	// Updates and exports the camera matrix to the Vertex Shader
 	camera.update();
 
-	// Pass the time to all the shaders.
+	// Pass the time and the camera to all the shaders.
+	profiler.beginCPU("Uniforms");
+
 	for (size_t i = 0; i < shaders.size(); i++) {
 
 		shaders[i].activate();
 		shaders[i].passFloat("velocity", velocity);
 		shaders[i].passFloat("time", internal_time);
-		shaders[i].passInt("lives", lives);
+		shaders[i].passInt("lives", simulation_state.lives);
+		shaders[i].passCamera(camera);
+
+	}
+
+	profiler.endCPU("Uniforms");
+
+	// Cull the objects hidden behind the buildings. The shaders move the world instead
+	// of the camera, so the culler has to see the world moved as well.
+	if (occlusion_culling) {
+
+		aladdin_3d::ScopedTimer timer(profiler, "Culling");
+		glm::mat4 world_motion = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -velocity * (float)internal_time));
+		occlusion_culler.cull(camera.getCameraMatrix() * world_motion, thread_pool);
+
+	}
+
+	entities.updateVisibility(occlusion_culling ? &occlusion_culler : nullptr);
+
+	// Start a new region of the stream buffer and expose it to the shaders.
+	stream_buffer.beginFrame();
+	stream_buffer.bind();
+
+	// Compute the matrices of all the models in one pass before drawing them.
+	profiler.beginCPU("Transforms");
+	transform_batch.clear();
+	entities.stage(transform_batch);
+	transform_batch.compute(camera.getView(), stream_buffer);
+	stream_buffer.flush();
+	profiler.endCPU("Transforms");
+
+	// Get the order of the draws.
+	profiler.beginCPU("Sorting");
+	sortObjects(camera.getPosition());
+	profiler.endCPU("Sorting");
+
+	// Fill the depth buffer first, so that only the visible fragments get shaded.
+	if (depth_prepass) {
+
+		profiler.beginGPU("Depth pre-pass");
+		glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+
+		for (size_t i = 0; i < draw_order.size(); i++) {
+
+			size_t entity = draw_order[i].second;
+
+			if (entities.getFlags(entity) & aladdin_3d::EntityStore::in_world)
+				objects[entities.getMesh(entity)].drawDepth(shaders[depth_shader], entities.getDrawIndices(entity));
+
+		}
+
+		glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+		profiler.endGPU("Depth pre-pass");
+
+		// Only shade the fragments that won the pre-pass.
+		glDepthFunc(GL_EQUAL);
+		glDepthMask(GL_FALSE);
 
 	}
 
-	// Draw all the models.
-	for (size_t i = 0; i < objects.size(); i++) {
+	// Draw all the models, leaving the ones without pre-pass for later.
+	drawObjects(true);
 
-		objects[i].draw(shaders[object_shader[i]], camera);
+	if (depth_prepass) {
+
+		glDepthFunc(GL_LESS);
+		glDepthMask(GL_TRUE);
 
 	}
 
+	drawObjects(false);
+
 	// Draw all the characters.
+	profiler.beginGPU("Character");
 	displayCharacters();
+	profiler.endGPU("Character");
+
+	// Draw the guards behind them.
+	profiler.beginGPU("Guards");
+	displayCrowds();
+	profiler.endGPU("Guards");
+
+	// Show the profiler statistics on top.
+	if (profiler_overlay)
+		profiler.drawOverlay(WINDOW_HEIGHT);
+
+	// Let the GPU signal when it is done with this region.
+	stream_buffer.endFrame();
+
+	// Finish measuring the frame. The swap is counted in the next frame.
+	frame_statistics.endFrame();
+	profiler.endFrame();
+
+	// Once the frames settle down after a change, drawing one must not touch the heap.
+	if (steady_frames < warmup_frames)
+		steady_frames++;
+	else
+		assert(!aladdin_3d::AllocationCounter::isEnabled() || frame_statistics.getLastAllocations() == 0);
 
 	// Swap the back buffer with the front buffer.
+	profiler.beginCPU("Swap");
 	glutSwapBuffers();
+	profiler.endCPU("Swap");
+
+}
+
+void drawObjects(bool default_shader) {
+
+	// The objects are sorted by class, so every class is drawn in one go.
+	unsigned int current_class = object_classes;
+
+	for (size_t i = 0; i < draw_order.size(); i++) {
+
+		size_t entity = draw_order[i].second;
+		unsigned int shader = entities.getShader(entity);
+
+		if ((shader == 0) != default_shader)
+			continue;
+
+		if (entities.getClass(entity) != current_class) {
+
+			if (current_class != object_classes)
+				profiler.endGPU(object_class_names[current_class]);
+
+			current_class = entities.getClass(entity);
+			profiler.beginGPU(object_class_names[current_class]);
+
+		}
+
+		objects[entities.getMesh(entity)].draw(shaders[shader], entities.getDrawIndices(entity));
+
+	}
+
+	if (current_class != object_classes)
+		profiler.endGPU(object_class_names[current_class]);
+
+}
+
+void sortObjects(glm::vec3 camera_position) {
+
+	// The shaders move the world instead of the camera, so move the camera the other way.
+	glm::vec3 position = camera_position + glm::vec3(0.0f, 0.0f, velocity * (float)internal_time);
+
+	// The objects of every class stay together so that the profiler can time them.
+	entities.sort(position, front_to_back, &draw_order);
 
 }
 
@@ -270,98 +594,191 @@ void displayCharacters() {
 	glutPostRedisplay();
 
 	// Get the current camera;
-	aladdin_3d::Camera camera = cameras[current_camera];
+	aladdin_3d::Camera &camera = cameras[current_camera];
 
 	// Updates and exports the camera matrix to the Vertex Shader
 	camera.update();
 
+	// Iterate through the characters.
+	for (size_t i = 0; i < characters.size(); i++) {
+
+		// Get the character and its shader.
+		aladdin_3d::Object &character = characters[i];
+		aladdin_3d::Shader &char_shader = shaders[character_shader[i]];
+
+		// Pass some things to the character to jump.
+		char_shader.activate();
+		char_shader.passFloat("jump_start", simulation_state.jump_start);
+		char_shader.passFloat("jump_velocity", jump_velocity);
+		char_shader.passFloat("gravity", gravity);
+		char_shader.passFloat("last_hit", simulation_state.last_hit);
+
+		// The run cycle is baked, so the shader poses the character from the time alone.
+		character_animations[i].bind(char_shader);
+
+		// Compute the matrices of the char and draw it.
+		transform_batch.clear();
+		character.stage(transform_batch);
+		transform_batch.compute(camera.getView(), stream_buffer);
+		stream_buffer.flush();
+		character.draw(char_shader);
+
+	}
+
+}
+
+void displayCrowds() {
+
+	// Get the current camera;
+	aladdin_3d::Camera &camera = cameras[current_camera];
+
+	for (size_t i = 0; i < crowds.size(); i++) {
+
+		// Move the guards, advance the clips that are due and stream all of them at once.
+		profiler.beginCPU("Crowd");
+		crowds[i].steer(flow_field, (float)internal_time, velocity, guard_speed);
+		crowds[i].update((float)internal_time, camera.getPosition());
+		crowds[i].upload(camera.getView(), stream_buffer);
+		stream_buffer.flush();
+		profiler.endCPU("Crowd");
+
+		crowds[i].draw(shaders[guard_shader], character_animations[0]);
+
+	}
+
+}
+
+void simulate() {
+
+	// Handle the input of this tick.
+	pollInput();
+
+	// Move the time forward.
+	previous_simulation_time = simulation_time;
+
+	if (!is_paused)
+		simulation_time += simulation_timestep;
+
+	simulation_tick++;
+
 	// Check what's going on with the jumps.
-	float jump_time = internal_time - jump_start;
+	float jump_time = simulation_time - jump_start;
 	float char_y = jump_velocity * jump_time + 0.5 * gravity * jump_time * jump_time;
 
 	// Get the current x.
-	float char_z = velocity * internal_time;
+	float char_z = velocity * simulation_time;
 
 	// Set winner if is further the door.
 	if (char_z >= corridor_length)
 		is_paused = true;
 
+	// Find the obstacles along the part of the corridor run in this tick.
+	broadphase.move(character_proxy, swept_collision.getSweptBounds(character_bounds, previous_simulation_time, simulation_time));
+	broadphase.update();
+
+	// Take every hit of the tick, at the moment it happened.
+	double hit_time = 0.0;
+
+	while (lives > 0 && swept_collision.findHit(broadphase, character_proxy, previous_simulation_time, simulation_time,
+		jump_start, last_hit, &hit_time)) {
+
+		lives--;
+		last_hit = hit_time;
+
+	}
+
 	// If has reached the gound, end the jump.
 	if (char_y <= 0.0f)
 		jump_start = -1.0f;
 
-	// If now there is an obstacle.
-	for (size_t i = 0; i < obstacles_positions.size() && lives > 0; i++) {
+	// If there are no lives left, pause again.
+	if (lives <= 0)
+		is_paused = true;
+
+}
+
+void runSimulation() {
+
+	auto tick_duration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(simulation_timestep));
+	auto max_delay = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(max_frame_time));
+	auto next_tick = std::chrono::steady_clock::now();
+
+	while (simulation_running.load(std::memory_order_acquire)) {
 
-		// If this position is before, pass.
-		if (obstacles_positions[i] > char_z - 0.5 && obstacles_positions[i] < char_z + 0.5) {
+		if (fixed_timestep > 0.0) {
 
-			if (internal_time - last_hit >= 1.0 && char_y < 0.5) {
+			// Step in lockstep with the renderer, waiting until it asks for another tick.
+			if (simulation_tick >= requested_ticks.load(std::memory_order_acquire)) {
 
-				lives--;
-				last_hit = internal_time;
+				std::this_thread::sleep_for(std::chrono::microseconds(100));
+				continue;
 
 			}
 
+		} else {
+
+			// Keep the real rate, giving up on the ticks that fell too far behind.
+			std::this_thread::sleep_until(next_tick);
+			next_tick += tick_duration;
+
+			auto now = std::chrono::steady_clock::now();
+			if (now - next_tick > max_delay)
+				next_tick = now;
+
 		}
 
+		simulate();
+		publishState();
+
 	}
 
-	// If there are no lives left, pause again.
-	if (lives <= 0)
-		is_paused = true;
+}
 
-	// Iterate through the characters.
-	for (size_t i = 0; i < characters.size(); i++) {
+void publishState() {
 
-		// Get the character.
-		aladdin_3d::Object character = characters[i];
+	aladdin_3d::SimulationState state;
+	state.tick = simulation_tick;
+	state.time = simulation_time;
+	state.previous_time = previous_simulation_time;
+	state.paused = is_paused;
+	state.jump_start = jump_start;
+	state.last_hit = last_hit;
+	state.lives = lives;
 
-		// Get the centre and size of the legs.
-		aladdin_3d::BoundingBox bb_legs = character.getGeometries()[1].getBoundingBox();
-		glm::vec3 leg_size = bb_legs.max - bb_legs.min;
+	// The renderer cannot read the collision structures, so it gets their size here.
+	state.obstacle_count = obstacles.size();
+	state.obstacle_bytes = obstacles.getCPUBytes();
+	state.proxy_count = broadphase.size();
+	state.broadphase_bytes = broadphase.getCPUBytes();
 
-		// Calculate the angle.
-		float angle = sin(internal_time * 6) * 45.0;
+	auto current_time = std::chrono::steady_clock::now();
+	state.real_time = std::chrono::duration<double>(current_time.time_since_epoch()).count();
 
-		// Move the legs.
-		character.translate(1, 0, leg_size.y, 0);
-		character.rotate(1, 1.0f, 0.0f, 0.0f, -angle);
-		character.translate(1, 0, -leg_size.y, 0);
+	state_buffer.publish(state);
 
-		character.translate(2, 0, leg_size.y, 0);
-		character.rotate(2, 1.0f, 0.0f, 0.0f, angle);
-		character.translate(2, 0, -leg_size.y, 0);
+}
 
-		// Apply 90 rotations to the characters.
-		character.rotate(0.0f, 1.0f, 0.0f, -90.0);
+void startSimulation() {
 
-		// Get the centre and size of the character.
-		aladdin_3d::BoundingBox bb = character.getBoundingBox();
-		glm::vec3 centre = (bb.min + bb.max) / 2.0f;
-		glm::vec3 size = bb.max - bb.min;
+	// The renderer starts from the initial state.
+	publishState();
+	state_buffer.read(simulation_state);
 
-		// Center the object and get it in the right position.
-		character.translate(-centre.x, 0, -centre.z);
+	simulation_running.store(true, std::memory_order_release);
+	simulation_thread = std::thread(runSimulation);
 
-		// Get the character shader.
-		aladdin_3d::Shader char_shader = shaders[character_shader[i]];
+}
 
-		// Pass some things to the character to jump.
-		char_shader.activate();
-		char_shader.passFloat("jump_start", jump_start);
-		char_shader.passFloat("jump_velocity", jump_velocity);
-		char_shader.passFloat("gravity", gravity);
-		char_shader.passFloat("last_hit", last_hit);
+void stopSimulation() {
 
-		// Draw the char.
-		character.draw(char_shader, camera);
+	simulation_running.store(false, std::memory_order_release);
 
-	}
+	if (simulation_thread.joinable())
+		simulation_thread.join();
 
 }
 
-void handleSpecialEvents(int key, int x, int y) {
+void handleSpecialEvents(int key) {
 
 	// Make sure GLUT will refresh.
 	glutPostRedisplay();
@@ -369,34 +786,34 @@ void handleSpecialEvents(int key, int x, int y) {
 	// Top arrow will move front.
 	if (key == GLUT_KEY_UP) {
 
-		handleKeyEvents('w', x, y);
+		handleKeyEvents('w');
 
 	}
 
 	// Top arrow will move front.
 	if (key == GLUT_KEY_DOWN) {
 
-		handleKeyEvents('s', x, y);
+		handleKeyEvents('s');
 
 	}
 
 	// Right arrow will move right.
 	if (key == GLUT_KEY_RIGHT) {
 
-		handleKeyEvents('d', x, y);
+		handleKeyEvents('d');
 
 	}
 
 	// Left arrow will move left.
 	if (key == GLUT_KEY_LEFT) {
 
-		handleKeyEvents('a', x, y);
+		handleKeyEvents('a');
 
 	}
 
 }
 
-void handleKeyEvents(unsigned char key, int x, int y) {
+void handleKeyEvents(unsigned char key) {
 
 	// Handle keyboard events.
 
@@ -520,11 +937,52 @@ void handleKeyEvents(unsigned char key, int x, int y) {
 
 	}
 
+	// Key O will toggle the occlusion culling.
+	if (key == 'o') {
+
+		occlusion_culling = !occlusion_culling;
+
+	}
+
+	// Key Z will toggle the depth pre-pass.
+	if (key == 'z') {
+
+		reportRenderMode();
+		depth_prepass = !depth_prepass;
+
+	}
+
+	// Key X will toggle the front to back sorting.
+	if (key == 'x') {
+
+		reportRenderMode();
+		front_to_back = !front_to_back;
+
+	}
+
+	// Key M will print the memory used by the assets.
+	if (key == 'm') {
+
+		reportMemory();
+
+	}
+
+	// Key I will show/hide the profiler statistics.
+	if (key == 'i') {
+
+		profiler_overlay = !profiler_overlay;
+
+	}
+
+}
+
+void handleGameKey(unsigned char key) {
+
 	// Key P will pause/play the game.
 	if (key == 'p') {
 
 		// Get the current x.
-		float char_z = velocity * internal_time;
+		float char_z = velocity * simulation_time;
 
 		// Set winner if is further the door.
 		if (char_z >= corridor_length || lives <= 0) {
@@ -544,12 +1002,12 @@ void handleKeyEvents(unsigned char key, int x, int y) {
 
 		if (is_paused) {
 
-			handleKeyEvents('p', x, y);
+			handleGameKey('p');
 
 		} else {
 
 			if (jump_start == -1)
-				jump_start = internal_time;
+				jump_start = simulation_time;
 
 		}
 
@@ -557,7 +1015,124 @@ void handleKeyEvents(unsigned char key, int x, int y) {
 
 }
 
-float initBuildings(std::vector<aladdin_3d::Object> base_objects, std::vector<int> building_guide, float x_scale) {
+void handleInputEvent(aladdin_3d::InputEvent event) {
+
+	// Pausing and jumping belong to the simulation, the rest goes back to the renderer.
+	if (!event.special && (event.key == 'p' || event.key == ' ')) {
+
+		handleGameKey(event.key);
+
+	} else {
+
+		event.tick = (uint32_t)simulation_tick;
+
+		if (!render_input_queue.push(event))
+			std::cerr << "Warning - An input event was dropped." << std::endl;
+
+	}
+
+}
+
+void onClose() {
+
+	// Stop the simulation before anything it uses goes away.
+	stopSimulation();
+
+	// Delete the objects, the shaders, the stream buffer and the queries. They own
+	// their OpenGL objects, so these are freed right here, while the context is current.
+	objects.clear();
+	entities.clear();
+	obstacles.clear();
+	broadphase.clear();
+	characters.clear();
+	character_animations.clear();
+	crowds.clear();
+	shaders.clear();
+	stream_buffer.remove();
+	frame_statistics.remove();
+	profiler.remove();
+
+	// Everything should be gone by now.
+	if (aladdin_3d::ResourceTracker::getTotalCount() > 0) {
+
+		std::cerr << "Warning - Some OpenGL resources were not released:";
+
+		for (unsigned int i = 0; i < aladdin_3d::ResourceTracker::types; i++)
+			std::cerr << " " << aladdin_3d::ResourceTracker::getName(i) << " " << aladdin_3d::ResourceTracker::getCount(i) << ".";
+
+		std::cerr << std::endl;
+
+	}
+
+}
+
+void onKeyEvent(unsigned char key, int, int) {
+
+	aladdin_3d::InputEvent event = { 0, 0, key };
+
+	if (!input_queue.push(event))
+		std::cerr << "Warning - An input event was dropped." << std::endl;
+
+}
+
+void onSpecialEvent(int key, int, int) {
+
+	aladdin_3d::InputEvent event = { 0, 1, (uint8_t)key };
+
+	if (!input_queue.push(event))
+		std::cerr << "Warning - An input event was dropped." << std::endl;
+
+}
+
+void pollInput() {
+
+	// Live input would break the replay, so it is dropped until the replay is over.
+	bool live = !replaying || input_recording.isFinished();
+
+	aladdin_3d::InputEvent event;
+
+	while (input_queue.pop(event)) {
+
+		if (!live)
+			continue;
+
+		if (!recording_file.empty())
+			input_recording.record(simulation_tick, event.special != 0, event.key);
+
+		handleInputEvent(event);
+
+	}
+
+	// Feed the recorded events through the same path as the live input.
+	if (replaying) {
+
+		while (input_recording.poll(simulation_tick, event))
+			handleInputEvent(event);
+
+	}
+
+}
+
+void applyInput() {
+
+	aladdin_3d::InputEvent event;
+
+	while (render_input_queue.pop(event)) {
+
+		// Whatever the key does may need memory for a few frames.
+		steady_frames = 0;
+
+		if (event.special)
+			handleSpecialEvents(event.key);
+		else
+			handleKeyEvents(event.key);
+
+	}
+
+}
+
+float initBuildings(const std::vector<aladdin_3d::Object> &base_objects, const std::vector<aladdin_3d::BoundingBox> &occluders,
+	const std::vector<bool> &has_occluder, std::vector<int> building_guide, float x_scale) {
 
 	// Get the separation.
 	const float separation = 1.0f;
@@ -608,9 +1183,12 @@ float initBuildings(std::vector<aladdin_3d::Object> base_objects, std::vector<in
 		building.translate(-size.x / 2.0f, 0, size.z / 2.0f);
 		building.translate(-centre.x, 0, -centre.z);
 
+		// Its solid part will hide what is behind it.
+		if (has_occluder[ind])
+			occlusion_culler.addOccluder(building.transformBoundingBox(occluders[ind]));
+
 		// Add the objects to the list.
-		objects.push_back(building);
-		object_shader.push_back(0);
+		addObject(building, 0, buildings_class, aladdin_3d::EntityStore::in_world);
 
 		// Add the size and separation so that the next building will get it as cumulative.
 		displacement += (size.z + separation);
@@ -635,7 +1213,7 @@ void initElements() {
 	shader.activate();
 	shader.passLight(sun);
 
-	shaders.push_back(shader);
+	shaders.push_back(std::move(shader));
 
 	// Get the shaders.
 	aladdin_3d::Shader shader_character("Shaders/character.vert", "Shaders/character.frag");
@@ -644,7 +1222,7 @@ void initElements() {
 	shader_character.activate();
 	shader_character.passLight(sun);
 
-	shaders.push_back(shader_character);
+	shaders.push_back(std::move(shader_character));
 
 	// Get the shaders.
 	aladdin_3d::Shader shader_lives("Shaders/lives.vert", "Shaders/lives.frag");
@@ -652,7 +1230,22 @@ void initElements() {
 	// Pass the light to the shader.
 	shader_lives.activate();
 
-	shaders.push_back(shader_lives);
+	shaders.push_back(std::move(shader_lives));
+
+	// Get the shader for the depth pre-pass.
+	aladdin_3d::Shader shader_depth("Shaders/depth.vert", "Shaders/depth.frag");
+	depth_shader = shaders.size();
+	shaders.push_back(std::move(shader_depth));
+
+	// Get the shader of the guards, which draws a whole crowd at once.
+	aladdin_3d::Shader shader_guard("Shaders/guard.vert", "Shaders/character.frag");
+
+	// Pass the light to the shader.
+	shader_guard.activate();
+	shader_guard.passLight(sun);
+
+	guard_shader = shaders.size();
+	shaders.push_back(std::move(shader_guard));
 
 	// Creates the first camera object
 	aladdin_3d::Camera camera1(glm::vec3(0.0f, 2.0f, -2.0f), glm::vec3(0.0f, 0.0f, 1.0f), 45.0f, 0.1f, 300.0f, WINDOW_WIDTH, WINDOW_HEIGHT);
@@ -673,7 +1266,7 @@ void initElements() {
 	base_objects.push_back(aladdin_3d::Object("Models/building_4/building_4.gltf", "GLTF"));
 
 	// Generate the random guides for the objects.
-	const int num_of_each = 100;
+	const int num_of_each = buildings_per_type;
 	std::vector<int> right_building_guide(num_of_each * base_objects.size(), 0);
 	for (size_t i = 0; i < right_building_guide.size(); i++) right_building_guide[i] = i / num_of_each;
 
@@ -681,14 +1274,24 @@ void initElements() {
 	std::vector<int> left_building_guide = right_building_guide;
 
 	// Shuffle the buildings.
-	unsigned seed = std::chrono::system_clock::now().time_since_epoch().count();
-	std::shuffle(right_building_guide.begin(), right_building_guide.end(), std::default_random_engine(seed));
-	seed = std::chrono::system_clock::now().time_since_epoch().count();
-	std::shuffle(left_building_guide.begin(), left_building_guide.end(), std::default_random_engine(seed));
+	std::shuffle(right_building_guide.begin(), right_building_guide.end(), std::default_random_engine(world_seed));
+	std::shuffle(left_building_guide.begin(), left_building_guide.end(), std::default_random_engine(world_seed + 1));
+
+	// Find the solid part of every building to use it as occluder, while the meshes
+	// are still there. Only the GPU copies are needed after that.
+	std::vector<aladdin_3d::BoundingBox> building_occluders(base_objects.size());
+	std::vector<bool> has_occluder(base_objects.size());
+
+	for (size_t i = 0; i < base_objects.size(); i++) {
+
+		has_occluder[i] = aladdin_3d::OcclusionCuller::fitOccluder(base_objects[i], &building_occluders[i]);
+		base_objects[i].releaseCPUData();
+
+	}
 
 	// Pass the objects to include them in the object.
-	corridor_length = initBuildings(base_objects, right_building_guide, 1.0f);
-	corridor_length = initBuildings(base_objects, left_building_guide, -1.0f);
+	corridor_length = initBuildings(base_objects, building_occluders, has_occluder, right_building_guide, 1.0f);
+	corridor_length = initBuildings(base_objects, building_occluders, has_occluder, left_building_guide, -1.0f);
 
 	// Add the wall at the end.
 	aladdin_3d::Object wall("Models/wall/wall.gltf", "GLTF");
@@ -705,9 +1308,15 @@ void initElements() {
 	wall.translate(-size.x / 2.0f, 0, size.z / 2.0f);
 	wall.translate(-centre.x, 0, -centre.z);
 
+	// The wall hides everything behind it.
+	aladdin_3d::BoundingBox wall_occluder;
+	if (aladdin_3d::OcclusionCuller::fitOccluder(wall, &wall_occluder))
+		occlusion_culler.addOccluder(wall.transformBoundingBox(wall_occluder));
+
+	wall.releaseCPUData();
+
 	// Add the objects to the list.
-	objects.push_back(wall);
-	object_shader.push_back(0);
+	addObject(wall, 0, buildings_class, aladdin_3d::EntityStore::in_world);
 
 	// Create the floor.
 	createFloor();
@@ -731,9 +1340,66 @@ void initElements() {
 	
 	// Create the final object and append it to the objects.
 	aladdin_3d::Object character(new_geom);
+	character.setName("Character");
+	character.releaseCPUData();
 	characters.push_back(character);
 	character_shader.push_back(1);
 
+	// Measure the characters once and bake their run cycles. Every part becomes a joint,
+	// so that posing a character only changes its palette.
+	for (size_t i = 0; i < characters.size(); i++) {
+
+		aladdin_3d::BoundingBox bb = characters[i].getBoundingBox();
+		glm::vec3 centre = (bb.min + bb.max) / 2.0f;
+
+		// The legs swing from their top.
+		aladdin_3d::BoundingBox bb_legs = characters[i].getGeometries()[1].getBoundingBox();
+		glm::vec3 hip = glm::vec3(centre.x, bb_legs.max.y - bb_legs.min.y, centre.z);
+
+		// Turn the character 90 degrees and center it once, the legs are posed below it.
+		characters[i].rotate(0.0f, 1.0f, 0.0f, -90.0f);
+		characters[i].translate(-centre.x, 0.0f, -centre.z);
+		characters[i].bindRigidSkin();
+
+		auto clip = std::make_shared<const aladdin_3d::AnimationClip>(createRunCycle(characters[i], hip));
+		character_animators.push_back(aladdin_3d::Animator(clip));
+
+		// Bake the run cycle once, so that playing it costs nothing on the CPU.
+		character_animations.push_back(aladdin_3d::AnimationTexture(characters[i], character_animators.back(), animation_frames));
+
+	}
+
+	// Find the contacts of the character with the obstacles.
+	buildBroadphase();
+
+	// The guards are copies of the character, running the same cycle behind it.
+	aladdin_3d::Crowd guards(characters[0], character_animations[0]);
+	guards.populate(guard_count, guard_front, guard_row_size, guard_spacing);
+	crowds.push_back(guards);
+
+	// Start the workers, the main thread works too.
+	unsigned int cores = std::thread::hardware_concurrency();
+	thread_pool.start(cores > 1 ? cores - 1 : 0);
+
+	// Lead the guards around the obstacles.
+	buildFlowField();
+
+	// Count the draws of a frame to size the stream buffer.
+	size_t draws = 0;
+	for (size_t i = 0; i < objects.size(); i++)
+		draws += objects[i].getGeometryCount();
+	for (size_t i = 0; i < characters.size(); i++)
+		draws += characters[i].getGeometryCount();
+	for (size_t i = 0; i < crowds.size(); i++)
+		draws += crowds[i].getDraws();
+
+	// Create the stream buffer for the per-draw matrices.
+	stream_buffer = aladdin_3d::StreamBuffer(draws);
+
+	// Make room for a whole frame up front, so that drawing one never allocates.
+	transform_batch.reserve(draws);
+	draw_order.reserve(entities.size());
+
 }
 
 void initEnvironment(int argc, char** argv) {
@@ -756,8 +1422,11 @@ void initEnvironment(int argc, char** argv) {
 	glutDisplayFunc(display);
 
 	// Tell what function handles the events.
-	glutSpecialFunc(handleSpecialEvents);
-	glutKeyboardFunc(handleKeyEvents);
+	glutSpecialFunc(onSpecialEvent);
+	glutKeyboardFunc(onKeyEvent);
+
+	// Release the OpenGL objects while the window and its context still exist.
+	glutCloseFunc(onClose);
 
 	// Initialize GLEW and OpenGL.
 	GLenum res = glewInit();
@@ -776,19 +1445,494 @@ void initEnvironment(int argc, char** argv) {
 	// Enables the Depth Buffer
 	glEnable(GL_DEPTH_TEST);
 
+	// Return from the main loop when the window is closed, so that the rest gets cleaned.
+	glutSetOption(GLUT_ACTION_ON_WINDOW_CLOSE, GLUT_ACTION_GLUTMAINLOOP_RETURNS);
+
+}
+
+void reportMemory() {
+
+	// Group the objects by the asset they come from.
+	std::vector<aladdin_3d::AssetMemory> assets;
+
+	auto add = [&assets](aladdin_3d::Object &object) {
+
+		for (size_t i = 0; i < assets.size(); i++) {
+
+			if (assets[i].name == object.getName()) {
+
+				assets[i].instances++;
+				assets[i].cpu_bytes += object.getCPUBytes();
+				return;
+
+			}
+
+		}
+
+		// The meshes are shared, so they only count for the first object.
+		aladdin_3d::AssetMemory asset;
+		asset.name = object.getName();
+		asset.instances = 1;
+		asset.cpu_bytes = object.getCPUBytes() + object.getSharedCPUBytes();
+		asset.gpu_bytes = object.getGPUBytes();
+		assets.push_back(asset);
+
+	};
+
+	for (size_t i = 0; i < objects.size(); i++)
+		add(objects[i]);
+
+	for (size_t i = 0; i < characters.size(); i++)
+		add(characters[i]);
+
+	// The components of the entities live apart from their meshes.
+	aladdin_3d::AssetMemory components;
+	components.name = "Entity components";
+	components.cpu_bytes = entities.getCPUBytes();
+	assets.push_back(components);
+
+	// The obstacles keep their own sorted copy for the collisions. It belongs to the
+	// simulation thread, so the sizes come from its last snapshot.
+	aladdin_3d::AssetMemory obstacle_index;
+	obstacle_index.name = "Obstacle index";
+	obstacle_index.instances = simulation_state.obstacle_count;
+	obstacle_index.cpu_bytes = simulation_state.obstacle_bytes;
+	assets.push_back(obstacle_index);
+
+	// So does the broadphase, with a proxy per obstacle and character.
+	aladdin_3d::AssetMemory proxies;
+	proxies.name = "Broadphase";
+	proxies.instances = simulation_state.proxy_count;
+	proxies.cpu_bytes = simulation_state.broadphase_bytes;
+	assets.push_back(proxies);
+
+	// The guards share the meshes of the character, they only add their own state.
+	aladdin_3d::AssetMemory guards;
+	guards.name = "Guard crowds";
+
+	for (size_t i = 0; i < crowds.size(); i++) {
+
+		guards.instances += crowds[i].getCount();
+		guards.cpu_bytes += crowds[i].getCPUBytes();
+
+	}
+
+	assets.push_back(guards);
+
+	// Their flow field only lives on the CPU.
+	aladdin_3d::AssetMemory flow;
+	flow.name = "Flow field";
+	flow.cpu_bytes = flow_field.getCPUBytes();
+	assets.push_back(flow);
+
+	// The baked run cycles only live on the GPU.
+	aladdin_3d::AssetMemory animations;
+	animations.name = "Baked animations";
+
+	for (size_t i = 0; i < character_animations.size(); i++)
+		animations.gpu_bytes += character_animations[i].getGPUBytes();
+
+	assets.push_back(animations);
+
+	// Print them in KiB.
+	aladdin_3d::AssetMemory total;
+	std::cout << "Memory per asset:" << std::endl;
+	std::cout << std::fixed << std::setprecision(1);
+	std::cout << "  " << std::left << std::setw(40) << "Asset" << std::right << std::setw(10) << "Objects";
+	std::cout << std::setw(14) << "CPU KiB" << std::setw(14) << "GPU KiB" << std::endl;
+
+	for (size_t i = 0; i < assets.size(); i++) {
+
+		std::cout << "  " << std::left << std::setw(40) << assets[i].name << std::right << std::setw(10) << assets[i].instances;
+		std::cout << std::setw(14) << assets[i].cpu_bytes / 1024.0 << std::setw(14) << assets[i].gpu_bytes / 1024.0 << std::endl;
+
+		total.instances += assets[i].instances;
+		total.cpu_bytes += assets[i].cpu_bytes;
+		total.gpu_bytes += assets[i].gpu_bytes;
+
+	}
+
+	std::cout << "  " << std::left << std::setw(40) << "Total" << std::right << std::setw(10) << total.instances;
+	std::cout << std::setw(14) << total.cpu_bytes / 1024.0 << std::setw(14) << total.gpu_bytes / 1024.0 << std::endl;
+
+	// The assets may share textures, so the live resources give the real totals.
+	std::cout << "Live OpenGL resources:" << std::endl;
+	std::cout << "  " << std::left << std::setw(40) << "Type" << std::right << std::setw(10) << "Count";
+	std::cout << std::setw(14) << "GPU KiB" << std::endl;
+
+	for (unsigned int i = 0; i < aladdin_3d::ResourceTracker::types; i++) {
+
+		std::cout << "  " << std::left << std::setw(40) << aladdin_3d::ResourceTracker::getName(i) << std::right;
+		std::cout << std::setw(10) << aladdin_3d::ResourceTracker::getCount(i);
+		std::cout << std::setw(14) << aladdin_3d::ResourceTracker::getBytes(i) / 1024.0 << std::endl;
+
+	}
+
+	std::cout << std::defaultfloat << std::setprecision(6);
+
+}
+
+void reportRenderMode() {
+
+	// Nothing to report without frames.
+	if (frame_statistics.getFrames() == 0)
+		return;
+
+	std::cout << "Depth pre-pass " << (depth_prepass ? "on" : "off") << ", front to back " << (front_to_back ? "on" : "off") << ": ";
+	std::cout << frame_statistics.getFrames() << " frames, " << frame_statistics.getAverageCPUTime() << " ms CPU, ";
+	std::cout << frame_statistics.getAverageGPUTime() << " ms GPU";
+
+	if (aladdin_3d::AllocationCounter::isEnabled())
+		std::cout << ", " << frame_statistics.getAverageAllocations() << " heap allocations";
+
+	if (frame_statistics.hasFragments())
+		std::cout << ", " << (long long)frame_statistics.getAverageFragments() << " fragment shader invocations";
+
+	std::cout << " per frame." << std::endl;
+
+	// Start measuring the next mode.
+	frame_statistics.reset();
+
+}
+
+void runBenchmark(unsigned int frames) {
+
+	// Render into a framebuffer object, so that the window is never needed.
+	GLuint framebuffer = 0;
+	GLuint renderbuffers[2] = {};
+
+	glGenFramebuffers(1, &framebuffer);
+	glGenRenderbuffers(2, renderbuffers);
+
+	glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[0]);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, WINDOW_WIDTH, WINDOW_HEIGHT);
+	glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[1]);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, WINDOW_WIDTH, WINDOW_HEIGHT);
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffers[0]);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, renderbuffers[1]);
+
+	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+
+		std::cerr << "Error 121-1004 - The benchmark framebuffer is not complete." << std::endl;
+		exit(1);
+
+	}
+
+	// Start running, as if P had been pressed. A replay presses it by itself, and a
+	// benchmark that runs after another one is already running.
+	if (!replaying && simulation_state.paused) {
+
+		aladdin_3d::InputEvent start = { 0, 0, 'p' };
+		input_queue.push(start);
+
+	}
+
+	std::vector<double> frame_times;
+	frame_times.reserve(frames);
+	double draw_calls = 0.0;
+	double triangles = 0.0;
+	double allocations = 0.0;
+	double posed = 0.0;
+	size_t guards = 0;
+	unsigned long steady_allocations = 0;
+
+	for (unsigned int i = 0; i < frames; i++) {
+
+		aladdin_3d::Geometry::resetCounters();
+		auto start = std::chrono::steady_clock::now();
+
+		// Wait for the GPU so that the time of the frame includes its rendering.
+		display();
+		glFinish();
+
+		auto end = std::chrono::steady_clock::now();
+		frame_times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+		draw_calls += aladdin_3d::Geometry::getDrawCalls();
+		triangles += aladdin_3d::Geometry::getTriangles();
+		allocations += frame_statistics.getLastAllocations();
+
+		for (size_t j = 0; j < crowds.size(); j++)
+			posed += crowds[j].getPosedCount();
+
+		if (i >= warmup_frames)
+			steady_allocations += frame_statistics.getLastAllocations();
+
+	}
+
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	glDeleteRenderbuffers(2, renderbuffers);
+	glDeleteFramebuffers(1, &framebuffer);
+
+	// Nothing to report without frames.
+	if (frames == 0)
+		return;
+
+	// Nearest-rank percentiles of the frame times.
+	std::vector<double> sorted = frame_times;
+	std::sort(sorted.begin(), sorted.end());
+
+	auto percentile = [&sorted](double p) {
+
+		size_t rank = (size_t)ceil(p / 100.0 * sorted.size());
+		return sorted[rank > 0 ? rank - 1 : 0];
+
+	};
+
+	double total = 0.0;
+	for (size_t i = 0; i < frame_times.size(); i++)
+		total += frame_times[i];
+
+	std::cout << "Benchmark: " << frames << " frames of " << fixed_timestep * 1000.0 << " ms, seed " << world_seed << ", ";
+	std::cout << WINDOW_WIDTH << "x" << WINDOW_HEIGHT << ", " << (const char*)glGetString(GL_RENDERER) << "." << std::endl;
+	std::cout << "  Frame time: avg " << total / frames << ", min " << sorted.front() << ", p50 " << percentile(50.0);
+	std::cout << ", p90 " << percentile(90.0) << ", p99 " << percentile(99.0) << ", max " << sorted.back() << " ms." << std::endl;
+	std::cout << "  Draw calls: " << draw_calls / frames << " per frame." << std::endl;
+	std::cout << "  Triangles:  " << triangles / frames << " per frame." << std::endl;
+	for (size_t i = 0; i < crowds.size(); i++)
+		guards += crowds[i].getCount();
+
+	if (guards > 0)
+		std::cout << "  Guards posed: " << posed / frames << " of " << guards << " per frame." << std::endl;
+
+	if (aladdin_3d::AllocationCounter::isEnabled())
+		std::cout << "  Allocations: " << allocations / frames << " per frame, " << steady_allocations << " after the first " << warmup_frames << " frames." << std::endl;
+	else
+		std::cout << "  Allocations: not counted, build with ALADDIN_3D_COUNT_ALLOCATIONS to count them." << std::endl;
+
+	reportMemory();
+
+}
+
+void runCrowdBenchmark(unsigned int frames) {
+
+	for (size_t i = 0; i < sizeof(crowd_sizes) / sizeof(crowd_sizes[0]); i++) {
+
+		for (size_t j = 0; j < crowds.size(); j++)
+			crowds[j].populate(crowd_sizes[i], guard_front, guard_row_size, guard_spacing);
+
+		// Growing the crowd allocates, so the frames have to settle down again.
+		steady_frames = 0;
+
+		std::cout << "Crowd of " << crowd_sizes[i] << " guards:" << std::endl;
+		runBenchmark(frames);
+
+	}
+
 }
 
 int main(int argc, char** argv) {
 
+	// The world is different every run unless a seed is given.
+	world_seed = (unsigned int)std::chrono::system_clock::now().time_since_epoch().count();
+
+	bool benchmark = false;
+	bool crowd_benchmark = false;
+	bool seeded = false;
+	unsigned int benchmark_frames = 0;
+	std::string replay_file;
+
+	for (int i = 1; i < argc; i++) {
+
+		std::string argument = argv[i];
+
+		// Run the transform micro-benchmark instead of the game if asked to.
+		if (argument == "--bench-transforms") {
+
+			aladdin_3d::Benchmark::transforms(10000, 1000);
+			return 0;
+
+		}
+
+		// Run the broadphase micro-benchmark at growing scene sizes if asked to.
+		if (argument == "--bench-broadphase") {
+
+			aladdin_3d::Benchmark::broadphase(1000, 600);
+			aladdin_3d::Benchmark::broadphase(10000, 600);
+			aladdin_3d::Benchmark::broadphase(100000, 60);
+			return 0;
+
+		}
+
+		// Check that the collisions do not depend on the tick rate if asked to.
+		if (argument == "--check-collisions")
+			return aladdin_3d::Benchmark::collisions(1000.0f) ? 0 : 1;
+
+		// Run the entity micro-benchmark at growing scene sizes if asked to.
+		if (argument == "--bench-entities") {
+
+			aladdin_3d::Benchmark::entities(1000, 1000);
+			aladdin_3d::Benchmark::entities(10000, 100);
+			aladdin_3d::Benchmark::entities(100000, 10);
+			return 0;
+
+		}
+
+		// Run the flow field micro-benchmark at growing corridor lengths if asked to.
+		if (argument == "--bench-flow") {
+
+			aladdin_3d::Benchmark::flowField(500.0f, 1000);
+			aladdin_3d::Benchmark::flowField(2000.0f, 1000);
+			aladdin_3d::Benchmark::flowField(8000.0f, 1000);
+			return 0;
+
+		}
+
+		// Measure the bounds of the buildings if asked to. The models need OpenGL.
+		if (argument == "--bench-bounds") {
+
+			initEnvironment(argc, argv);
+			aladdin_3d::Benchmark::bounds({ "Models/building_1/building_1.gltf", "Models/building_2/building_2.gltf",
+				"Models/building_3/building_3.gltf", "Models/building_4/building_4.gltf" }, 1000);
+			return 0;
+
+		}
+
+		// Run the batch maths micro-benchmark at growing batch sizes if asked to.
+		if (argument == "--bench-maths") {
+
+			aladdin_3d::Benchmark::maths(1000, 10000);
+			aladdin_3d::Benchmark::maths(100000, 100);
+			return 0;
+
+		}
+
+		// Run the transform update micro-benchmark at growing scene sizes if asked to.
+		if (argument == "--bench-graph") {
+
+			aladdin_3d::Benchmark::sceneGraph(100, 1000);
+			aladdin_3d::Benchmark::sceneGraph(10000, 100);
+			return 0;
+
+		}
+
+		// Render a fixed number of frames offscreen and report their cost.
+		if (argument == "--bench")
+			benchmark = true;
+
+		// Render the frames once for every crowd size instead.
+		if (argument == "--bench-guards") {
+
+			benchmark = true;
+			crowd_benchmark = true;
+
+		}
+
+		// The options take the next argument as their value.
+		if (i + 1 >= argc)
+			continue;
+
+		if (argument == "--frames") {
+
+			benchmark_frames = (unsigned int)std::stoul(argv[++i]);
+
+		} else if (argument == "--seed") {
+
+			world_seed = (unsigned int)std::stoul(argv[++i]);
+			seeded = true;
+
+		} else if (argument == "--dt") {
+
+			fixed_timestep = std::stod(argv[++i]);
+
+		} else if (argument == "--guards") {
+
+			guard_count = (unsigned int)std::stoul(argv[++i]);
+
+		} else if (argument == "--buildings") {
+
+			buildings_per_type = (unsigned int)std::max(1ul, std::stoul(argv[++i]));
+
+		} else if (argument == "--record") {
+
+			recording_file = argv[++i];
+
+		} else if (argument == "--replay") {
+
+			replay_file = argv[++i];
+
+		}
+
+	}
+
+	// Make room for the largest crowd from the start.
+	if (crowd_benchmark)
+		guard_count = crowd_sizes[sizeof(crowd_sizes) / sizeof(crowd_sizes[0]) - 1];
+
+	// The benchmark is deterministic by default.
+	if (benchmark && !seeded)
+		world_seed = 1;
+
+	// The replayed events are not recorded again.
+	if (!replay_file.empty() && !recording_file.empty()) {
+
+		std::cerr << "Warning - The input cannot be recorded while replaying." << std::endl;
+		recording_file.clear();
+
+	}
+
+	// A replay runs with the seed and the timestep it was recorded with.
+	if (!replay_file.empty()) {
+
+		if (!input_recording.load(replay_file.c_str())) {
+
+			std::cerr << "Error 121-1005 - The input recording could not be read." << std::endl;
+			exit(1);
+
+		}
+
+		replaying = true;
+		world_seed = input_recording.getSeed();
+
+		if (input_recording.getTimestep() != simulation_timestep)
+			std::cerr << "Warning - The input was recorded with another simulation rate." << std::endl;
+
+	}
+
+	if (benchmark && fixed_timestep <= 0.0)
+		fixed_timestep = 1.0 / 60.0;
+
+	// Benchmark the whole recording by default.
+	if (benchmark && replaying && benchmark_frames == 0)
+		benchmark_frames = (unsigned int)ceil((input_recording.getLastTick() + 1) * simulation_timestep / fixed_timestep);
+
+	if (benchmark_frames == 0)
+		benchmark_frames = 600;
+
+	if (!recording_file.empty()) {
+
+		input_recording.setSeed(world_seed);
+		input_recording.setTimestep(simulation_timestep);
+
+	}
+
 	// Initialise the environment.
 	initEnvironment(argc, argv);
 
 	// Initialise the objects and elements.
 	initElements();
 
-	// Init the initial time.
-	auto current_time = std::chrono::system_clock::now();
-	time_start = std::chrono::duration<double>(current_time.time_since_epoch()).count();
+	// Start simulating.
+	startSimulation();
+
+	// Run the benchmark instead of the game, without showing the window.
+	if (benchmark) {
+
+		glutHideWindow();
+
+		if (crowd_benchmark)
+			runCrowdBenchmark(benchmark_frames);
+		else
+			runBenchmark(benchmark_frames);
+
+		onClose();
+		clean();
+
+		return 0;
+
+	}
 
 	// Main loop.
 	glutMainLoop();
@@ -23,38 +23,137 @@
 #include <vector>
 #include <string>
 #include <ctime>
+#include <utility>
+#include <atomic>
+#include <thread>
 
+#include "Classes/AnimationTexture/AnimationTexture.h"
+#include "Classes/Animator/Animator.h"
+#include "Classes/Broadphase/Broadphase.h"
 #include "Classes/Camera/Camera.h"
+#include "Classes/Crowd/Crowd.h"
+#include "Classes/EntityStore/EntityStore.h"
+#include "Classes/FlowField/FlowField.h"
+#include "Classes/FrameStatistics/FrameStatistics.h"
+#include "Classes/InputQueue/InputQueue.h"
+#include "Classes/InputRecording/InputRecording.h"
 #include "Classes/Object/Object.h"
+#include "Classes/ObstacleSystem/ObstacleSystem.h"
+#include "Classes/OcclusionCuller/OcclusionCuller.h"
+#include "Classes/Profiler/Profiler.h"
 #include "Classes/Shader/Shader.h"
+#include "Classes/StateBuffer/StateBuffer.h"
+#include "Classes/StreamBuffer/StreamBuffer.h"
+#include "Classes/SweptCollision/SweptCollision.h"
+#include "Classes/ThreadPool/ThreadPool.h"
+#include "Classes/TransformBatch/TransformBatch.h"
+#include "Structs/AnimationClip/AnimationClip.h"
+#include "Structs/SimulationState/SimulationState.h"
 
 std::vector<aladdin_3d::Camera> cameras;	/// Holds all the existing cameras.
 unsigned int current_camera = 0;			/// Current camera activated.
 std::vector<aladdin_3d::Object> characters;	/// Holds all the displayed characters.
-std::vector<aladdin_3d::Object> objects;	/// Holds all the displayed objects.
+std::vector<aladdin_3d::Object> objects;	/// Holds the meshes of all the displayed objects.
+aladdin_3d::EntityStore entities;			/// Holds the components of all the displayed objects.
+aladdin_3d::ObstacleSystem obstacles;		/// Holds the obstacles sorted along the corridor. Simulation thread only once running.
+aladdin_3d::Broadphase broadphase;			/// Finds the contacts between the character and the obstacles. Simulation thread only once running.
+size_t character_proxy = 0;					/// Proxy of the character in the broadphase.
+aladdin_3d::BoundingBox character_bounds;	/// Bounds of the character standing at the origin.
+aladdin_3d::SweptCollision swept_collision;	/// Finds when the character hits the obstacles during a tick.
 std::vector<unsigned int> character_shader;	/// Holds all the relationships between shaders and characters.
-std::vector<unsigned int> object_shader;	/// Holds all the relationships between shaders and objects.
+std::vector<aladdin_3d::Animator> character_animators;	/// Plays the run cycle of every character.
+std::vector<aladdin_3d::AnimationTexture> character_animations;	/// Run cycle of every character, baked into a texture.
+std::vector<aladdin_3d::Crowd> crowds;		/// Holds the crowds of guards chasing the characters.
+unsigned int guard_shader = 0;				/// Index of the shader of the guards.
+unsigned int guard_count = 20;				/// Number of guards chasing the character.
+aladdin_3d::FlowField flow_field;			/// Leads the guards around the obstacles.
 std::vector<aladdin_3d::Shader> shaders;	/// Holds all the initialized shanders.
+aladdin_3d::StreamBuffer stream_buffer;		/// Streams the per-draw matrices to the shaders.
+aladdin_3d::TransformBatch transform_batch;	/// Computes the per-draw matrices of a frame in one pass.
+aladdin_3d::OcclusionCuller occlusion_culler;	/// Culls the objects hidden behind the buildings.
+aladdin_3d::ThreadPool thread_pool;			/// Workers for the parallel stages of a frame.
+bool occlusion_culling = true;				/// Control if the occlusion culling is enabled.
+aladdin_3d::FrameStatistics frame_statistics;	/// Measures the cost of the frames.
+std::vector<std::pair<float, size_t>> draw_order;	/// Entities to draw this frame, with their sorting key.
+unsigned int depth_shader = 0;				/// Index of the depth pre-pass shader.
+bool depth_prepass = false;					/// Control if the depth pre-pass is enabled.
+bool front_to_back = true;					/// Control if the objects are drawn front to back.
+aladdin_3d::Profiler profiler;				/// Measures the cost of every pass of the frames.
+bool profiler_overlay = false;				/// Control if the profiler statistics are shown.
 int window = 0;								/// Window ID.
-std::vector<float> obstacles_positions;		/// The positions of the obstacles in the game.
-std::vector<std::string> obstacles_type;	/// The type of the obstacles in the game.
-double internal_time = 0;					/// Time that will rule everything in the game.
-double time_start = 0;						/// Time that will count as the beginning.
-bool is_paused = true;						/// Control if the game is paused.
-float jump_start = -1.0f;					/// The time point where the jump started.
-int lives = 3;								/// Current lives of the player.
+double internal_time = 0;					/// Time that will rule everything in the game, interpolated between ticks.
+double simulation_time = 0;					/// Game time at the last simulation tick. Simulation thread only.
+double previous_simulation_time = 0;		/// Game time at the tick before the last one. Simulation thread only.
+double accumulator = 0;						/// Fixed time waiting to be simulated.
+bool is_paused = true;						/// Control if the game is paused. Simulation thread only.
+float jump_start = -1.0f;					/// The time point where the jump started. Simulation thread only.
+int lives = 3;								/// Current lives of the player. Simulation thread only.
 float corridor_length = 0;					/// Max length of the corridor.
-double last_hit = -10;						/// The moment when the character hit an obstacle the last time.
+double last_hit = -10;						/// The moment when the character hit an obstacle the last time. Simulation thread only.
+unsigned int world_seed = 0;				/// Seed of the world generation.
+unsigned int buildings_per_type = 100;		/// Number of buildings of every type on each side of the corridor.
+double fixed_timestep = 0.0;				/// Time advanced every frame, or 0 to follow the real clock.
+unsigned long simulation_tick = 0;			/// Number of simulation ticks so far. Simulation thread only.
+aladdin_3d::SimulationState simulation_state;	/// Latest snapshot of the game, as seen by the renderer.
+aladdin_3d::StateBuffer state_buffer;		/// Hands the snapshots from the simulation thread to the renderer.
+aladdin_3d::InputQueue input_queue;			/// Key events going to the simulation thread.
+aladdin_3d::InputQueue render_input_queue;	/// Key events the simulation thread hands back to the renderer.
+std::thread simulation_thread;				/// Thread that runs the simulation.
+std::atomic<bool> simulation_running(false);	/// Control if the simulation thread keeps running.
+std::atomic<unsigned long> requested_ticks(0);	/// Ticks the renderer waits for when the timestep is fixed.
+aladdin_3d::InputRecording input_recording;	/// Key events being recorded or replayed.
+std::string recording_file;					/// File the key events are recorded to, if any.
+bool replaying = false;						/// Control if the key events come from a recording.
+unsigned int steady_frames = 0;				/// Frames drawn since the last key event.
 
 const float velocity = 5.0;				/// The usual running speed of a person in m/s.
 const float jump_velocity = 4.0f;			/// The initial velocity of the jump.
 const float gravity = -10.0f;				/// This is just the gravity, in case we wanted another value.
+const float jump_clearance = 0.5f;			/// Height the feet need to clear the obstacles.
+const double hit_cooldown = 1.0;			/// Time after a hit when the character cannot be hit again.
+const double simulation_timestep = 1.0 / 120.0;	/// Duration of a simulation tick.
+const double max_frame_time = 0.25;			/// Longest frame that is simulated, to avoid falling behind forever.
+const unsigned int warmup_frames = 3;		/// Frames after a key event that may still allocate memory.
+const GLsizei animation_frames = 64;		/// Frames baked from every run cycle.
 const glm::vec4 fog(0.9, 0.7, 0.4, 1.0);	// This is just the fog color.
+const glm::vec3 guard_front(0.0f, 0.0f, -1.5f);	/// Centre of the first row of guards, relative to the character.
+const size_t guard_row_size = 4;			/// Number of guards in every row.
+const float guard_spacing = 1.0f;			/// Distance between the guards.
+const float guard_speed = 6.0f;				/// Running speed of the guards, a bit faster than the character to catch up.
+const float guard_radius = 0.3f;			/// Distance the guards keep from the obstacles.
+const float corridor_width = 4.0f;			/// Width of the corridor between the buildings.
+const float flow_cell_size = 0.5f;			/// Size of the cells of the flow field.
+const float flow_segment_length = 32.0f;	/// Length of the corridor segments solved on their own.
+const unsigned int crowd_sizes[] = { 10, 100, 1000 };	/// Numbers of guards measured by the crowd benchmark.
+
+const unsigned int buildings_class = 0;		/// Class of the buildings and the wall.
+const unsigned int obstacles_class = 1;		/// Class of the obstacles.
+const unsigned int floor_class = 2;			/// Class of the floor.
+const unsigned int hud_class = 3;			/// Class of the lives HUD.
+const unsigned int object_classes = 4;		/// Number of object classes.
+const char *const object_class_names[object_classes] = { "Buildings", "Obstacles", "Floor", "HUD" };	/// Names of the object classes.
+
+/**
+ * @brief Add an object to the scene.
+ *
+ * Add the mesh of an object and an entity with its components and the world
+ * matrices of its geometries. If the object moves with the world, it is also a
+ * candidate for the occlusion culling. The object has to be fully placed already.
+ *
+ * @param object The object.
+ * @param shader The index of the shader of the object.
+ * @param object_class The class of the object.
+ * @param flags The flags of the entity.
+ *
+ * @returns The index of the entity.
+ */
+size_t addObject(const aladdin_3d::Object &object, unsigned int shader, unsigned int object_class, unsigned int flags);
 
 /**
  * @brief Clean everything to end the program.
  *
- * Clean everything to end the program.
+ * Clean everything to end the program. The OpenGL objects must have been released
+ * by onClose already.
  */
 void clean();
 
@@ -72,6 +171,21 @@ void createObstacles();
  */
 void createLives();
 
+/**
+ * @brief Build the broadphase.
+ *
+ * Add the obstacles and the character to the broadphase that finds their contacts.
+ */
+void buildBroadphase();
+
+/**
+ * @brief Build the flow field.
+ *
+ * Cover the corridor with the flow field that leads the guards around the obstacles,
+ * and solve it on the workers.
+ */
+void buildFlowField();
+
 /**
  * This function generates the floor.
  * 
@@ -79,6 +193,19 @@ void createLives();
  */
 void createFloor();
 
+/**
+ * @brief Create the run cycle of a character.
+ *
+ * Bake the swing of the legs of a character into an animation clip, turning them
+ * around the hip from their rest transforms in opposite directions.
+ *
+ * @param character The character, with the body and both legs as its geometries.
+ * @param hip The point the legs swing around, in the coordinates of the character.
+ *
+ * @returns The clip.
+ */
+aladdin_3d::AnimationClip createRunCycle(aladdin_3d::Object &character, const glm::vec3 &hip);
+
 /**
  * @brief Display the elements.
  *
@@ -86,6 +213,25 @@ void createFloor();
  */
 void display();
 
+/**
+ * @brief Draw the objects of a pass.
+ *
+ * Draw the objects in the draw order, timing every class of objects on the GPU.
+ *
+ * @param default_shader Whether to draw the objects with the default shader or the rest.
+ */
+void drawObjects(bool default_shader);
+
+/**
+ * @brief Sorts the objects to draw.
+ * 
+ * Fills the draw order with the objects that were not culled, sorted front to back
+ * if enabled.
+ * 
+ * @param camera_position The position of the camera.
+ */
+void sortObjects(glm::vec3 camera_position);
+
 /**
  * @brief Display the characters.
  * 
@@ -93,26 +239,139 @@ void display();
  */
 void displayCharacters();
 
+/**
+ * @brief Display the crowds.
+ *
+ * Advance the clips of the guards that are due, stream the matrices and clip times of
+ * every guard and draw each crowd with instanced calls, posed from the baked run cycle.
+ */
+void displayCrowds();
+
+/**
+ * @brief Simulate a tick.
+ *
+ * Advance the game by one fixed simulation tick: handle the input, move the time
+ * forward, resolve the jumps and the hits, and check if the game is over. It runs
+ * on the simulation thread.
+ */
+void simulate();
+
+/**
+ * @brief Run the simulation thread.
+ *
+ * Simulate ticks at a fixed real rate, or in lockstep with the renderer when the
+ * timestep is fixed, and publish a snapshot after every tick.
+ */
+void runSimulation();
+
+/**
+ * @brief Publish the game state.
+ *
+ * Publish a snapshot of the game state for the renderer.
+ */
+void publishState();
+
+/**
+ * @brief Start the simulation thread.
+ *
+ * Publish the initial state and start the simulation thread.
+ */
+void startSimulation();
+
+/**
+ * @brief Stop the simulation thread.
+ *
+ * Stop the simulation thread and wait for it.
+ */
+void stopSimulation();
+
 /**
  * @brief Handles the Freeglut events.
  *
  * Handles the freeglut events.
  */
-void handleSpecialEvents(int key, int x, int y);
+void handleSpecialEvents(int key);
 
 /**
  * @brief Handles the key events.
  *
  * Handles the freeglut key events.
  */
-void handleKeyEvents(unsigned char key, int x, int y);
+void handleKeyEvents(unsigned char key);
+
+/**
+ * @brief Handles the game keys.
+ *
+ * Handles the keys that change the game state, pausing and jumping. It runs on the
+ * simulation thread.
+ */
+void handleGameKey(unsigned char key);
+
+/**
+ * @brief Handles an input event.
+ *
+ * Handles a game key on the simulation thread, and hands any other event back to
+ * the renderer. It runs on the simulation thread.
+ *
+ * @param event The event.
+ */
+void handleInputEvent(aladdin_3d::InputEvent event);
+
+/**
+ * @brief Releases the OpenGL objects.
+ *
+ * Stops the simulation and releases everything that lives in the OpenGL context.
+ * Freeglut calls it when the window is closed, before the context is destroyed and
+ * the main loop returns.
+ */
+void onClose();
+
+/**
+ * @brief Receives the key events.
+ *
+ * Receives the freeglut key events and sends them to the simulation thread.
+ */
+void onKeyEvent(unsigned char key, int, int);
+
+/**
+ * @brief Receives the Freeglut events.
+ *
+ * Receives the freeglut special events and sends them to the simulation thread.
+ */
+void onSpecialEvent(int key, int, int);
+
+/**
+ * @brief Handles the input of a tick.
+ *
+ * Handles the live and the recorded events of the current simulation tick, and
+ * records them. It runs on the simulation thread.
+ */
+void pollInput();
+
+/**
+ * @brief Applies the input handed back to the renderer.
+ *
+ * Handles the events the simulation thread did not handle itself, such as the
+ * camera moves.
+ */
+void applyInput();
 
 /**
  * @brief Init the buildings.
  * 
- * Init the buildings.
+ * Init the buildings. The base objects may have released their CPU data already, so
+ * their occluders are fitted beforehand.
+ *
+ * @param base_objects The buildings to copy.
+ * @param occluders The occluder of every building, in its local coordinates.
+ * @param has_occluder Whether every building has an occluder.
+ * @param building_guide The index of the building at every position.
+ * @param x_scale The scale that puts the buildings on one side or the other.
+ *
+ * @returns The length of the corridor.
  */
-float initBuildings(std::vector<aladdin_3d::Object> base_objects, std::vector<int> building_guide, float x_scale);
+float initBuildings(const std::vector<aladdin_3d::Object> &base_objects, const std::vector<aladdin_3d::BoundingBox> &occluders,
+	const std::vector<bool> &has_occluder, std::vector<int> building_guide, float x_scale);
 
 /**
  * @brief Init the elements of the program
@@ -128,6 +387,42 @@ void initElements();
  */
 void initEnvironment(int argc, char** argv);
 
+/**
+ * @brief Reports the memory used by the assets.
+ *
+ * Prints the bytes every asset uses in main memory, its copies plus the meshes they
+ * share, and on the GPU. The collision structures belong to the simulation thread,
+ * so their sizes come from its last snapshot.
+ */
+void reportMemory();
+
+/**
+ * @brief Reports the cost of the current render mode.
+ * 
+ * Prints the frame statistics measured with the current render mode and starts a new measurement.
+ */
+void reportRenderMode();
+
+/**
+ * @brief Run the benchmark.
+ *
+ * Render a number of frames into a framebuffer object, advancing the time by a fixed
+ * step, and print the frame time percentiles, draw calls and triangles per frame.
+ *
+ * @param frames The number of frames to render.
+ */
+void runBenchmark(unsigned int frames);
+
+/**
+ * @brief Run the crowd benchmark.
+ *
+ * Run the benchmark once for every crowd size, with that many guards chasing the
+ * character.
+ *
+ * @param frames The number of frames to render at every size.
+ */
+void runCrowdBenchmark(unsigned int frames);
+
 /**
  * @brief Main function.
  * 
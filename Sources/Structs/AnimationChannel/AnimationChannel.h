@@ -0,0 +1,43 @@
+/**
+ * @file AnimationChannel.h
+ * @brief AnimationChannel struct header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+
+#ifndef ALADDIN_3D_STRUCT_ANIMATIONCHANNEL_H_
+#define ALADDIN_3D_STRUCT_ANIMATIONCHANNEL_H_
+
+#include <vector>
+
+#include "glm/glm.hpp"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief A channel of an animation.
+	 *
+	 * This Struct holds the keyframes that animate one transform of one node. The
+	 * translations and scales use the first three components of the values, while the
+	 * rotations are quaternions stored as x, y, z and w, every key on the same side as
+	 * the previous one so that they can be blended linearly.
+	 */
+	struct AnimationChannel {
+		int node = -1;						/// Index of the animated node.
+		unsigned int path = 0;				/// Transform it animates, one of the paths of the Animator.
+		std::vector<float> times;			/// Time of every key in seconds, in increasing order.
+		std::vector<glm::vec4> values;		/// Value of every key.
+	};
+
+} // namespace aladdin_3d
+
+#endif //!ALADDIN_3D_STRUCT_ANIMATIONCHANNEL_H_
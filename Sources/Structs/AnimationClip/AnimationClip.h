@@ -0,0 +1,41 @@
+/**
+ * @file AnimationClip.h
+ * @brief AnimationClip struct header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+
+#ifndef ALADDIN_3D_STRUCT_ANIMATIONCLIP_H_
+#define ALADDIN_3D_STRUCT_ANIMATIONCLIP_H_
+
+#include <string>
+#include <vector>
+
+#include "Structs/AnimationChannel/AnimationChannel.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief An animation clip.
+	 *
+	 * This Struct holds a named animation as a set of channels, each of them moving
+	 * one transform of one node. The clip loops after its duration.
+	 */
+	struct AnimationClip {
+		std::string name;							/// Name of the animation.
+		float duration = 0.0f;						/// Length of the animation in seconds.
+		std::vector<AnimationChannel> channels;		/// Channels of the animation.
+	};
+
+} // namespace aladdin_3d
+
+#endif //!ALADDIN_3D_STRUCT_ANIMATIONCLIP_H_
@@ -0,0 +1,41 @@
+/**
+ * @file AssetMemory.h
+ * @brief AssetMemory struct header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_STRUCT_ASSETMEMORY_H_
+#define ALADDIN_3D_STRUCT_ASSETMEMORY_H_
+
+#include <stddef.h>
+
+#include <string>
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief The memory used by an asset.
+	 *
+	 * This Struct holds the memory used by all the objects that come from the same
+	 * asset. Every copy has its own transforms in main memory, while the meshes, in
+	 * main memory and on the GPU, are shared by all of them.
+	 */
+	struct AssetMemory {
+		std::string name;			/// Name of the asset.
+		size_t instances = 0;		/// Number of objects that use it.
+		size_t cpu_bytes = 0;		/// Bytes in main memory, the copies plus the shared meshes.
+		size_t gpu_bytes = 0;		/// Bytes on the GPU.
+	};
+
+} // namespace aladdin_3d
+
+#endif //!ALADDIN_3D_STRUCT_ASSETMEMORY_H_
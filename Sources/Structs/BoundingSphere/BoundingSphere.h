@@ -0,0 +1,36 @@
+/**
+ * @file BoundingSphere.h
+ * @brief BoundingSphere struct header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_STRUCT_BOUNDINGSPHERE_H_
+#define ALADDIN_3D_STRUCT_BOUNDINGSPHERE_H_
+
+#include "glm/glm.hpp"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief A bounding sphere struct.
+	 *
+	 * This Struct represents a sphere that contains an object. It is centred on
+	 * its bounding box, so it is not the smallest one, but it is close.
+	 */
+	struct BoundingSphere {
+		glm::vec3 centre = glm::vec3(0.0f);	/// Centre of the sphere.
+		float radius = 0.0f;				/// Radius of the sphere.
+	};
+
+} // namespace aladdin_3d
+
+#endif //!ALADDIN_3D_STRUCT_BOUNDINGSPHERE_H_
@@ -0,0 +1,37 @@
+/**
+ * @file ContactEvent.h
+ * @brief ContactEvent struct header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_STRUCT_CONTACTEVENT_H_
+#define ALADDIN_3D_STRUCT_CONTACTEVENT_H_
+
+#include <stddef.h>
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief A change in the contacts of the broadphase.
+	 *
+	 * This Struct holds a pair of proxies whose bounds started or stopped
+	 * overlapping in the last update. The first proxy is always the lower one.
+	 */
+	struct ContactEvent {
+		size_t first = 0;			/// Lower proxy of the pair.
+		size_t second = 0;			/// Higher proxy of the pair.
+		bool begin = false;			/// Whether the contact started or ended.
+	};
+
+} // namespace aladdin_3d
+
+#endif //!ALADDIN_3D_STRUCT_CONTACTEVENT_H_
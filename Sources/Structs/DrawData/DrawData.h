@@ -0,0 +1,37 @@
+/**
+ * @file DrawData.h
+ * @brief DrawData struct header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_STRUCT_DRAWDATA_H_
+#define ALADDIN_3D_STRUCT_DRAWDATA_H_
+
+#include "glm/glm.hpp"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief The per-draw data streamed to the shaders.
+	 *
+	 * This Struct holds the matrices that change with every draw. The shaders
+	 * read it from the stream buffer as 12 RGBA32F texels, one column per texel.
+	 */
+	struct DrawData {
+		glm::mat4 model;			/// Model matrix.
+		glm::mat4 model_view;		/// View matrix multiplied by the model matrix.
+		glm::mat4 normal_matrix;	/// Matrix that takes the normals to view space.
+	};
+
+} // namespace aladdin_3d
+
+#endif //!ALADDIN_3D_STRUCT_DRAWDATA_H_
@@ -0,0 +1,37 @@
+/**
+ * @file InputEvent.h
+ * @brief InputEvent struct header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_STRUCT_INPUTEVENT_H_
+#define ALADDIN_3D_STRUCT_INPUTEVENT_H_
+
+#include <stdint.h>
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief A recorded input event.
+	 *
+	 * This Struct holds a key event together with the simulation tick it has to be
+	 * handled in. It takes 6 bytes in a recording file.
+	 */
+	struct InputEvent {
+		uint32_t tick;		/// Tick the event is handled in.
+		uint8_t special;	/// Whether the key is a special key or a character.
+		uint8_t key;		/// The key.
+	};
+
+} // namespace aladdin_3d
+
+#endif //!ALADDIN_3D_STRUCT_INPUTEVENT_H_
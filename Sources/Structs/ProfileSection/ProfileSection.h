@@ -0,0 +1,53 @@
+/**
+ * @file ProfileSection.h
+ * @brief ProfileSection struct header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_STRUCT_PROFILESECTION_H_
+#define ALADDIN_3D_STRUCT_PROFILESECTION_H_
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "glew/glew.h"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief A section of the frame measured by the profiler.
+	 *
+	 * This Struct holds a named section of the frame, measured either on the CPU or
+	 * on the GPU, together with a rolling window of its last samples and the
+	 * statistics computed from them.
+	 */
+	struct ProfileSection {
+		std::string name;								/// Name of the section.
+		bool gpu = false;								/// Whether the section is measured on the GPU.
+		std::vector<GLuint> queries;					/// Begin and end timestamp queries of every frame in flight.
+		std::vector<unsigned long> query_frames;		/// Frame each pair of queries was issued in, 0 if none.
+		bool started = false;							/// Whether the section is running.
+		std::chrono::steady_clock::time_point start;	/// When the section started on the CPU.
+		double frame_time = 0.0;						/// CPU time spent in the section this frame.
+		bool measured = false;							/// Whether the section ran on the CPU this frame.
+		std::vector<float> samples;						/// Rolling window of samples in milliseconds.
+		size_t next = 0;								/// Where the next sample goes.
+		size_t count = 0;								/// Number of samples in the window.
+		float min = 0.0f;								/// Minimum of the window in milliseconds.
+		float average = 0.0f;							/// Average of the window in milliseconds.
+		float p99 = 0.0f;								/// 99th percentile of the window in milliseconds.
+	};
+
+} // namespace aladdin_3d
+
+#endif //!ALADDIN_3D_STRUCT_PROFILESECTION_H_
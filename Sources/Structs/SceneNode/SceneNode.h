@@ -0,0 +1,42 @@
+/**
+ * @file SceneNode.h
+ * @brief SceneNode struct header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+
+#ifndef ALADDIN_3D_STRUCT_SCENENODE_H_
+#define ALADDIN_3D_STRUCT_SCENENODE_H_
+
+#include "glm/glm.hpp"
+#include "glm/gtc/quaternion.hpp"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief A node of a model hierarchy.
+	 *
+	 * This Struct holds a node of a model as the loaders read it: its parent, its
+	 * transforms relative to the parent and the geometry it draws, if any. The nodes
+	 * of a model are listed with every parent before its children.
+	 */
+	struct SceneNode {
+		int parent = -1;										/// Index of the parent node, -1 for the roots.
+		glm::vec3 translation = glm::vec3(0.0f);				/// Translation relative to the parent.
+		glm::quat rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);	/// Rotation relative to the parent.
+		glm::vec3 scale = glm::vec3(1.0f);						/// Scale relative to the parent.
+		int geometry = -1;										/// Index of the geometry it draws, -1 if none.
+	};
+
+} // namespace aladdin_3d
+
+#endif //!ALADDIN_3D_STRUCT_SCENENODE_H_
@@ -0,0 +1,46 @@
+/**
+ * @file SimulationState.h
+ * @brief SimulationState struct header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_STRUCT_SIMULATIONSTATE_H_
+#define ALADDIN_3D_STRUCT_SIMULATIONSTATE_H_
+
+#include <stddef.h>
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief A snapshot of the game state.
+	 *
+	 * This Struct holds everything the renderer needs from a simulation tick. The
+	 * simulation thread publishes one after every tick and never changes it again.
+	 */
+	struct SimulationState {
+		unsigned long tick = 0;			/// Number of ticks simulated.
+		double time = 0.0;				/// Game time at this tick.
+		double previous_time = 0.0;		/// Game time at the tick before.
+		double real_time = 0.0;			/// Real time the tick was simulated at, in seconds.
+		bool paused = true;				/// Whether the game is paused.
+		float jump_start = -1.0f;		/// The time point where the jump started.
+		double last_hit = -10.0;		/// The moment when the character hit an obstacle the last time.
+		int lives = 3;					/// Current lives of the player.
+		size_t obstacle_count = 0;		/// Number of obstacles in the sorted index.
+		size_t obstacle_bytes = 0;		/// Bytes used by the sorted index of the obstacles.
+		size_t proxy_count = 0;			/// Number of proxies in the broadphase.
+		size_t broadphase_bytes = 0;	/// Bytes used by the broadphase.
+	};
+
+} // namespace aladdin_3d
+
+#endif //!ALADDIN_3D_STRUCT_SIMULATIONSTATE_H_
@@ -0,0 +1,40 @@
+/**
+ * @file Skin.h
+ * @brief Skin struct header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+
+#ifndef ALADDIN_3D_STRUCT_SKIN_H_
+#define ALADDIN_3D_STRUCT_SKIN_H_
+
+#include <vector>
+
+#include "glm/glm.hpp"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief The skin of a model.
+	 *
+	 * This Struct holds the joints of a skinned model, as indices of nodes, and the
+	 * inverse bind matrix of every joint, which takes the vertices from the space of
+	 * the mesh to the space of the joint.
+	 */
+	struct Skin {
+		std::vector<int> joints;				/// Node of every joint.
+		std::vector<glm::mat4> inverse_binds;	/// Inverse bind matrix of every joint.
+	};
+
+} // namespace aladdin_3d
+
+#endif //!ALADDIN_3D_STRUCT_SKIN_H_
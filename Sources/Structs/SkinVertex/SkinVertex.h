@@ -0,0 +1,37 @@
+/**
+ * @file SkinVertex.h
+ * @brief SkinVertex struct header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+
+#ifndef ALADDIN_3D_STRUCT_SKINVERTEX_H_
+#define ALADDIN_3D_STRUCT_SKINVERTEX_H_
+
+#include "glm/glm.hpp"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief The skinning attributes of a vertex.
+	 *
+	 * This Struct holds the joints that move a vertex of a skinned geometry and how
+	 * much each of them weighs. The joints are indices in the palette of the skin.
+	 */
+	struct SkinVertex {
+		glm::vec4 joints = glm::vec4(0.0f);		/// Indices of the joints that move the vertex.
+		glm::vec4 weights = glm::vec4(0.0f);	/// Weight of every joint, adding up to one.
+	};
+
+} // namespace aladdin_3d
+
+#endif //!ALADDIN_3D_STRUCT_SKINVERTEX_H_
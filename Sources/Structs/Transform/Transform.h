@@ -0,0 +1,38 @@
+/**
+ * @file Transform.h
+ * @brief Transform struct header file.
+ * @version 1.0.0 (2026-10-19)
+ * @date 2026-10-19
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef ALADDIN_3D_STRUCT_TRANSFORM_H_
+#define ALADDIN_3D_STRUCT_TRANSFORM_H_
+
+#include "glm/glm.hpp"
+#include "glm/gtc/quaternion.hpp"
+
+namespace aladdin_3d {
+
+	/**
+	 * @brief A transform struct.
+	 *
+	 * This Struct holds an affine transform without shear in ten floats: it scales,
+	 * then rotates and then translates.
+	 */
+	struct Transform {
+		glm::vec3 translation = glm::vec3(0.0f);					/// Translation.
+		glm::quat rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);	/// Rotation, normalized.
+		glm::vec3 scale = glm::vec3(1.0f);						/// Scale on each axis.
+	};
+
+} // namespace aladdin_3d
+
+#endif //!ALADDIN_3D_STRUCT_TRANSFORM_H_